@@ -0,0 +1,361 @@
+#include "bench_baseline.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace bench {
+
+// ───────────────────────────────────────────────────────────────────────────────
+// Minimalny czytnik JSON – wystarczy do dokumentów, które pisze crout-bench
+namespace {
+
+struct Json {
+    enum Kind { Null, Bool, Number, String, Array, Object } kind = Null;
+    bool boolean = false;
+    double number = 0;
+    std::string string;
+    std::vector<Json> array;
+    std::vector<std::pair<std::string, Json>> object;
+
+    const Json *find(const std::string &k) const
+    {
+        for (const auto &kv : object)
+            if (kv.first == k)
+                return &kv.second;
+        return nullptr;
+    }
+
+    std::string str(const std::string &k) const
+    {
+        const Json *v = find(k);
+        return v && v->kind == String ? v->string : std::string();
+    }
+
+    double num(const std::string &k) const
+    {
+        const Json *v = find(k);
+        return v && v->kind == Number ? v->number : 0.0;
+    }
+};
+
+class JsonReader {
+public:
+    explicit JsonReader(const std::string &s) : s_(s) {}
+
+    Json document()
+    {
+        Json v = value();
+        skip();
+        if (pos_ != s_.size())
+            error("trailing characters");
+        return v;
+    }
+
+private:
+    [[noreturn]] void error(const std::string &what) const
+    {
+        throw std::runtime_error("Invalid benchmark JSON at offset " + std::to_string(pos_) + ": " + what + ".");
+    }
+
+    void skip()
+    {
+        while (pos_ < s_.size() && std::isspace(static_cast<unsigned char>(s_[pos_])))
+            ++pos_;
+    }
+
+    bool accept(char c)
+    {
+        skip();
+        if (pos_ < s_.size() && s_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c)
+    {
+        if (!accept(c))
+            error(std::string("expected '") + c + "'");
+    }
+
+    bool keyword(const char *w)
+    {
+        const std::size_t len = std::char_traits<char>::length(w);
+        if (s_.compare(pos_, len, w) != 0)
+            return false;
+        pos_ += len;
+        return true;
+    }
+
+    Json value()
+    {
+        skip();
+        if (pos_ >= s_.size())
+            error("unexpected end");
+        Json v;
+        const char c = s_[pos_];
+        if (c == '{') {
+            ++pos_;
+            v.kind = Json::Object;
+            if (accept('}'))
+                return v;
+            do {
+                skip();
+                std::string k = text();
+                expect(':');
+                v.object.emplace_back(std::move(k), value());
+            } while (accept(','));
+            expect('}');
+        } else if (c == '[') {
+            ++pos_;
+            v.kind = Json::Array;
+            if (accept(']'))
+                return v;
+            do
+                v.array.push_back(value());
+            while (accept(','));
+            expect(']');
+        } else if (c == '"') {
+            v.kind = Json::String;
+            v.string = text();
+        } else if (keyword("true")) {
+            v.kind = Json::Bool;
+            v.boolean = true;
+        } else if (keyword("false")) {
+            v.kind = Json::Bool;
+        } else if (keyword("null")) {
+            v.kind = Json::Null;
+        } else {
+            const char *begin = s_.c_str() + pos_;
+            char *end = nullptr;
+            v.kind = Json::Number;
+            v.number = std::strtod(begin, &end);
+            if (end == begin)
+                error("unexpected character");
+            pos_ += std::size_t(end - begin);
+        }
+        return v;
+    }
+
+    // Napis; \uXXXX spoza ASCII zamieniany na '?' – klucze i liczby są ASCII
+    std::string text()
+    {
+        if (pos_ >= s_.size() || s_[pos_] != '"')
+            error("expected string");
+        ++pos_;
+        std::string out;
+        while (pos_ < s_.size() && s_[pos_] != '"') {
+            char c = s_[pos_++];
+            if (c == '\\') {
+                if (pos_ >= s_.size())
+                    break;
+                c = s_[pos_++];
+                switch (c) {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'u': {
+                    if (pos_ + 4 > s_.size())
+                        error("bad escape");
+                    const long code = std::strtol(s_.substr(pos_, 4).c_str(), nullptr, 16);
+                    out += code < 0x80 ? char(code) : '?';
+                    pos_ += 4;
+                    break;
+                }
+                default: out += c;
+                }
+            } else {
+                out += c;
+            }
+        }
+        if (pos_ >= s_.size())
+            error("unterminated string");
+        ++pos_;
+        return out;
+    }
+
+    const std::string &s_;
+    std::size_t pos_ = 0;
+};
+
+double median(std::vector<double> v)
+{
+    std::sort(v.begin(), v.end());
+    const std::size_t n = v.size();
+    return n % 2 ? v[n / 2] : 0.5 * (v[n / 2 - 1] + v[n / 2]);
+}
+
+// Mediana próby losowanej ze zwracaniem z v; buf – bufor roboczy
+double resampledMedian(const std::vector<double> &v, std::mt19937_64 &rng, std::vector<double> &buf)
+{
+    std::uniform_int_distribution<std::size_t> pick(0, v.size() - 1);
+    buf.resize(v.size());
+    for (auto &x : buf)
+        x = v[pick(rng)];
+    const std::size_t n = buf.size();
+    std::nth_element(buf.begin(), buf.begin() + n / 2, buf.end());
+    const double upper = buf[n / 2];
+    if (n % 2)
+        return upper;
+    return 0.5 * (*std::max_element(buf.begin(), buf.begin() + n / 2) + upper);
+}
+} // anonymous
+// ───────────────────────────────────────────────────────────────────────────────
+
+BenchRun parseRun(const std::string &json)
+{
+    const Json doc = JsonReader(json).document();
+    if (doc.kind != Json::Object || doc.str("tool") != "crout-bench")
+        throw std::runtime_error("Not a crout-bench result document.");
+
+    BenchRun run;
+    run.version = doc.str("version");
+    run.timestamp = doc.str("timestamp");
+    if (const Json *host = doc.find("host")) {
+        run.cpu = host->str("cpu");
+        run.buildType = host->str("build_type");
+    }
+    const Json *results = doc.find("results");
+    if (!results || results->kind != Json::Array)
+        throw std::runtime_error("Benchmark document has no results.");
+
+    for (const Json &r : results->array) {
+        BenchCase c;
+        if (r.find("primitive"))
+            c.key = "primitive/" + r.str("primitive") + "/" + r.str("type") + "/p="
+                    + std::to_string(long(r.num("precision")));
+        else
+            c.key = r.str("solver") + "/" + r.str("type") + "/" + r.str("matrix") + "/n="
+                    + std::to_string(long(r.num("n"))) + "/p=" + std::to_string(long(r.num("precision")));
+        c.error = r.str("error");
+        if (const Json *s = r.find("samples_ns"))
+            for (const Json &x : s->array)
+                if (x.kind == Json::Number)
+                    c.samples.push_back(x.number);
+        if (c.error.empty() && c.samples.empty())
+            throw std::runtime_error("Benchmark case '" + c.key + "' has no samples.");
+        run.cases.push_back(std::move(c));
+    }
+    return run;
+}
+
+BenchRun loadRun(const std::string &path)
+{
+    std::ifstream f(path);
+    if (!f)
+        throw std::runtime_error("Cannot open '" + path + "'.");
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return parseRun(ss.str());
+}
+
+std::string baselinePath(const std::string &dir, const std::string &name)
+{
+    const bool valid = !name.empty() && name[0] != '.'
+                       && std::all_of(name.begin(), name.end(), [](char c) {
+                              return std::isalnum(static_cast<unsigned char>(c)) || c == '.' || c == '_' || c == '-';
+                          });
+    if (!valid)
+        throw std::invalid_argument("Invalid baseline name '" + name + "'.");
+    return (dir.empty() ? std::string(".") : dir) + "/" + name + ".json";
+}
+
+const char *verdictName(Verdict v)
+{
+    switch (v) {
+    case Verdict::Unchanged: return "unchanged";
+    case Verdict::Faster:    return "faster";
+    case Verdict::Slower:    return "slower";
+    case Verdict::Failed:    return "failed";
+    case Verdict::New:       return "new";
+    case Verdict::Missing:   return "missing";
+    }
+    return "";
+}
+
+std::vector<CaseComparison> compareRuns(const BenchRun &base, const BenchRun &current,
+                                        const CompareOptions &options)
+{
+    std::map<std::string, const BenchCase *> baseCases;
+    for (const auto &c : base.cases)
+        baseCases[c.key] = &c;
+
+    std::mt19937_64 rng(options.seed);
+    std::vector<double> bufBase, bufCur, ratios;
+    const double tail = 0.5 * (1.0 - options.confidence);
+
+    std::vector<CaseComparison> out;
+    for (const auto &cur : current.cases) {
+        CaseComparison cmp;
+        cmp.key = cur.key;
+        const auto it = baseCases.find(cur.key);
+        const BenchCase *b = it == baseCases.end() ? nullptr : it->second;
+        if (it != baseCases.end())
+            baseCases.erase(it);
+
+        if (!b || !b->error.empty()) {
+            // nowy przypadek albo w bazie też się nie liczył – nie ma z czym porównać
+            cmp.verdict = b && !cur.error.empty() ? Verdict::Unchanged : Verdict::New;
+            if (cur.error.empty())
+                cmp.currentMedian = median(cur.samples);
+            out.push_back(cmp);
+            continue;
+        }
+        cmp.baseMedian = median(b->samples);
+        if (!cur.error.empty()) {
+            cmp.verdict = Verdict::Failed;
+            out.push_back(cmp);
+            continue;
+        }
+        cmp.currentMedian = median(cur.samples);
+        cmp.ratio = cmp.currentMedian / cmp.baseMedian;
+
+        ratios.clear();
+        for (int k = 0; k < options.resamples; ++k)
+            ratios.push_back(resampledMedian(cur.samples, rng, bufCur) / resampledMedian(b->samples, rng, bufBase));
+        std::sort(ratios.begin(), ratios.end());
+        const auto at = [&](double q) {
+            const std::size_t i = std::size_t(std::lround(q * double(ratios.size() - 1)));
+            return ratios[std::min(i, ratios.size() - 1)];
+        };
+        cmp.low = at(tail);
+        cmp.high = at(1.0 - tail);
+
+        if (cmp.ratio > 1.0 + options.threshold && cmp.low > 1.0)
+            cmp.verdict = Verdict::Slower;
+        else if (cmp.ratio < 1.0 / (1.0 + options.threshold) && cmp.high < 1.0)
+            cmp.verdict = Verdict::Faster;
+        out.push_back(cmp);
+    }
+
+    // w bazie, ale nie w tym przebiegu (inny zestaw opcji) – tylko informacja
+    for (const auto &kv : baseCases) {
+        CaseComparison cmp;
+        cmp.key = kv.first;
+        cmp.verdict = Verdict::Missing;
+        if (kv.second->error.empty())
+            cmp.baseMedian = median(kv.second->samples);
+        out.push_back(cmp);
+    }
+    return out;
+}
+
+bool hasRegression(const std::vector<CaseComparison> &cmp)
+{
+    return std::any_of(cmp.begin(), cmp.end(), [](const CaseComparison &c) {
+        return c.verdict == Verdict::Slower || c.verdict == Verdict::Failed;
+    });
+}
+
+} // namespace bench
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/**
+ * Wynik crout-bench wczytany z dokumentu JSON – tylko to, co potrzebne
+ * do porównania: klucz przypadku i surowe próbki ns/op.
+ */
+struct BenchCase {
+    std::string key;              // "general/double/spd/n=64/p=53", "primitive/IMul/interval/p=128"
+    std::vector<double> samples;  // ns na rozwiązanie
+    std::string error;            // niepusty, gdy solver rzucił wyjątek
+};
+
+struct BenchRun {
+    std::string version, timestamp, cpu, buildType;
+    std::vector<BenchCase> cases;
+};
+
+// Parsuje dokument crout-bench; std::runtime_error przy błędnym JSON
+BenchRun parseRun(const std::string &json);
+BenchRun loadRun(const std::string &path);
+
+// Ścieżka bazy o nazwie name w katalogu dir (name: litery, cyfry, . _ -);
+// std::invalid_argument przy niedozwolonej nazwie
+std::string baselinePath(const std::string &dir, const std::string &name);
+
+enum class Verdict {
+    Unchanged,  // w granicach progu albo różnica nieistotna statystycznie
+    Faster,
+    Slower,     // regresja: mediana wolniejsza o > próg i przedział ufności > 1
+    Failed,     // w bazie się liczyło, teraz wyjątek – też regresja
+    New,        // brak w bazie
+    Missing     // brak w bieżącym przebiegu
+};
+
+const char *verdictName(Verdict v);
+
+struct CaseComparison {
+    std::string key;
+    double baseMedian = 0, currentMedian = 0;
+    // stosunek median bieżąca / bazowa i bootstrapowy przedział ufności
+    double ratio = 0, low = 0, high = 0;
+    Verdict verdict = Verdict::Unchanged;
+};
+
+struct CompareOptions {
+    double threshold = 0.05;   // względny próg regresji mediany
+    double confidence = 0.95;  // poziom przedziału ufności
+    int resamples = 2000;      // próby bootstrapu
+    std::uint64_t seed = 1;    // bootstrap jest deterministyczny
+};
+
+/**
+ * Porównuje przypadki o tych samych kluczach. Stosunek median ma przedział
+ * ufności z bootstrapu percentylowego (niezależne losowanie ze zwracaniem
+ * z obu zestawów próbek); przypadek jest regresją, gdy stosunek przekracza
+ * 1 + threshold, a cały przedział leży powyżej 1 – szum pojedynczej próbki
+ * nie blokuje budowania, trwałe spowolnienie tak.
+ */
+std::vector<CaseComparison> compareRuns(const BenchRun &base, const BenchRun &current,
+                                        const CompareOptions &options);
+
+// true, gdy któryś przypadek to Slower albo Failed
+bool hasRegression(const std::vector<CaseComparison> &cmp);
+
+} // namespace bench
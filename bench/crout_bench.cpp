@@ -0,0 +1,1213 @@
+// crout-bench – pomiary solverów Crouta z biblioteki croutsolver.
+//
+// Dla każdej kombinacji solver (general, symmetric, tridiagonal) × typ ×
+// macierz × n × precyzja generuje powtarzalny układ (std::mt19937_64 z
+// ziarnem zależnym od przypadku), rozgrzewa solver jednym rozwiązaniem
+// i mierzy --reps próbek. Próbka to tyle rozwiązań z rzędu, by trwała co
+// najmniej --min-time; czas na rozwiązanie to czas próbki / liczba rozwiązań.
+//
+// Na przypadek raportowane są: mediana, minimum, średnia i odchylenie ns/op,
+// GFLOP/s (nominalna liczba działań rozkładu i podstawień / mediana; dla typów
+// wielokrotnej precyzji to działania w tym typie), alokacje operator new
+// i GMP/MPFR na rozwiązanie, szczytowe RSS procesu w trakcie przypadku
+// (VmHWM zerowane przed przypadkiem przez /proc/self/clear_refs) i residuum
+// względne ‖Ax − b‖∞ / (‖A‖∞‖x‖∞ + ‖b‖∞) policzone w double – na wypadek,
+// gdyby szybsza wersja liczyła źle.
+//
+// Gdzie jądro pozwala (perf_counters.h), próbki liczą też liczniki sprzętowe:
+// cykle, instrukcje, chybienia LLC i działania FP na rozwiązanie, z nich IPC
+// i intensywność arytmetyczna (działania / bajty z DRAM) do wykresów roofline.
+// Bez liczników pole "perf" ma null, a host.perf mówi dlaczego.
+//
+// Wynik: jeden dokument JSON (stdout albo -o) z opisem maszyny, konfiguracją
+// i tablicą "results" z surowymi próbkami, do porównań między wersjami.
+// Postęp idzie na stderr.
+//
+// --suite primitives zamiast solverów mierzy działania przedziałowe
+// z interval.hpp i koszt jednej zmiany trybu zaokrąglania (interval_primitives.h).
+//
+// --save-baseline NAZWA zapisuje ten dokument jako bazę w --baseline-dir;
+// --compare NAZWA|PLIK porównuje przebieg (albo wczytany przez --load) z bazą
+// (bench_baseline.h) i kończy się kodem 1, gdy któryś przypadek zwolnił
+// ponad --threshold – do blokowania wolnych budowań w potoku akceptacji.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+#include <mpfr.h>
+#include "mpreal.h"
+#include "interval.hpp"
+#include "multi_double.hpp"
+#include "float128.hpp"
+#include "utils/mp_arena.h"
+#include "bench/bench_baseline.h"
+#include "bench/interval_primitives.h"
+#include "bench/perf_counters.h"
+
+#include "solver/crout_types.h"
+#include "solver/general/crout_general_double.h"
+#include "solver/general/crout_general_mpreal.h"
+#include "solver/general/crout_general_interval.h"
+#include "solver/general/crout_general_multidouble.h"
+#include "solver/general/crout_general_float128.h"
+#include "solver/symmetric/crout_symmetric_double.h"
+#include "solver/symmetric/crout_symmetric_mpreal.h"
+#include "solver/symmetric/crout_symmetric_interval.h"
+#include "solver/symmetric/crout_symmetric_multidouble.h"
+#include "solver/symmetric/crout_symmetric_float128.h"
+#include "solver/tridiagonal/crout_tridiagonal_double.h"
+#include "solver/tridiagonal/crout_tridiagonal_mpreal.h"
+#include "solver/tridiagonal/crout_tridiagonal_interval.h"
+#include "solver/tridiagonal/crout_tridiagonal_multidouble.h"
+#include "solver/tridiagonal/crout_tridiagonal_float128.h"
+
+#ifndef CROUT_VERSION
+#define CROUT_VERSION "unknown"
+#endif
+#ifndef CROUT_BUILD_TYPE
+#define CROUT_BUILD_TYPE "unknown"
+#endif
+
+namespace IA = interval_arithmetic;
+using mpfr::mpreal;
+
+// ─────────────────────────── licznik alokacji ───────────────────────────────
+// Zastępuje globalny operator new całego programu, więc liczy też alokacje
+// biblioteki (std::vector wyników, magazyny Ops). new[] i nothrow idą przez
+// te operatory; wersje z align_val_t liczą AlignedAllocator (interval_array.hpp)
+// i MpMatrix (utils/mp_matrix.cpp).
+
+namespace {
+std::atomic<std::uint64_t> gAllocations{0};
+std::atomic<std::uint64_t> gAllocatedBytes{0};
+
+// Poza linią: po wstawieniu free() do std::allocator GCC widzi parę
+// operator new / free i zgłasza fałszywe -Wmismatched-new-delete
+[[gnu::noinline]] void *countedAlloc(std::size_t size, std::size_t align)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    gAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (size == 0)
+        size = 1;
+    // aligned_alloc wymaga rozmiaru będącego wielokrotnością wyrównania
+    void *p = align <= alignof(std::max_align_t)
+                  ? std::malloc(size)
+                  : std::aligned_alloc(align, (size + align - 1) / align * align);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+[[gnu::noinline]] void countedFree(void *p) noexcept { std::free(p); }
+} // anonymous
+
+void *operator new(std::size_t size) { return countedAlloc(size, 0); }
+void *operator new(std::size_t size, std::align_val_t al) { return countedAlloc(size, std::size_t(al)); }
+
+void operator delete(void *p) noexcept { countedFree(p); }
+void operator delete(void *p, std::size_t) noexcept { countedFree(p); }
+void operator delete(void *p, std::align_val_t) noexcept { countedFree(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept { countedFree(p); }
+
+namespace {
+
+enum class SolverKind { General, Symmetric, Tridiagonal };
+enum class DataType { Double, DoubleDouble, QuadDouble, Float128, Mpreal, Interval, IntervalDouble };
+enum class MatrixType { Spd, DiagDominant, Hilbert, Poisson };
+
+enum class Suite { Solvers, Primitives };
+
+struct Options {
+    Suite suite = Suite::Solvers;
+    std::vector<SolverKind> solvers{SolverKind::General, SolverKind::Symmetric, SolverKind::Tridiagonal};
+    std::vector<DataType> types{DataType::Double, DataType::Mpreal, DataType::Interval};
+    bool typesSet = false;
+    std::vector<MatrixType> matrices{MatrixType::Spd, MatrixType::DiagDominant, MatrixType::Hilbert,
+                                     MatrixType::Poisson};
+    std::vector<int> sizes{16, 64, 256};            // general, symmetric
+    std::vector<int> triSizes{1000, 100000};       // tridiagonal
+    std::vector<int> precisions{64, 128, 256};     // mpreal, interval
+    int reps = 5;
+    double minTime = 0.05;  // s na próbkę
+    std::uint64_t seed = 1;
+    bool arena = true;
+    bool perf = true;
+    std::string perfFp;  // zdarzenia FP dla PerfCounters ("" = wykryj)
+    bool quiet = false;
+    std::string output;
+    // bazy wyników
+    std::string baselineDir = "bench-baselines";
+    std::string saveBaseline;  // nazwa
+    std::string compare;       // nazwa albo ścieżka .json
+    std::string load;          // porównaj zapisany dokument zamiast mierzyć
+    std::string report;        // porównanie jako JSON
+    bench::CompareOptions compareOptions;
+};
+
+const char *name(SolverKind k)
+{
+    switch (k) {
+    case SolverKind::General:     return "general";
+    case SolverKind::Symmetric:   return "symmetric";
+    case SolverKind::Tridiagonal: return "tridiagonal";
+    }
+    return "";
+}
+
+const char *name(DataType t)
+{
+    switch (t) {
+    case DataType::Double:         return "double";
+    case DataType::DoubleDouble:   return "dd";
+    case DataType::QuadDouble:     return "qd";
+    case DataType::Float128:       return "float128";
+    case DataType::Mpreal:         return "mpreal";
+    case DataType::Interval:       return "interval";
+    case DataType::IntervalDouble: return "interval-double";
+    }
+    return "";
+}
+
+const char *name(MatrixType m)
+{
+    switch (m) {
+    case MatrixType::Spd:          return "spd";
+    case MatrixType::DiagDominant: return "dd";
+    case MatrixType::Hilbert:      return "hilbert";
+    case MatrixType::Poisson:      return "poisson";
+    }
+    return "";
+}
+
+void usage(std::ostream &os)
+{
+    os << "Użycie: crout-bench [opcje]\n"
+          "  --suite S           solvers (domyślnie) albo primitives – działania\n"
+          "                      IAdd/ISub/IMul/IDiv/DIAdd i SetRounding dla typów\n"
+          "                      interval i interval-double (-t, -p, -r, --min-time)\n"
+          "  -s, --solvers L     general,symmetric,tridiagonal (domyślnie wszystkie)\n"
+          "  -t, --types L       double,dd,qd,float128,mpreal,interval,interval-double\n"
+          "                      (domyślnie double,mpreal,interval)\n"
+          "  -g, --matrices L    spd,dd,hilbert,poisson (domyślnie wszystkie pasujące:\n"
+          "                      general – spd,dd,hilbert; symmetric – spd,hilbert;\n"
+          "                      tridiagonal – poisson,dd)\n"
+          "  -n, --sizes L       n dla general/symmetric (domyślnie 16,64,256)\n"
+          "  --tri-sizes L       n dla tridiagonal (domyślnie 1000,100000)\n"
+          "  -p, --precisions L  bity mpreal/interval (domyślnie 64,128,256)\n"
+          "  -r, --reps N        próbki na przypadek (domyślnie 5)\n"
+          "  --min-time S        minimalny czas próbki w sekundach (domyślnie 0.05)\n"
+          "  --seed N            ziarno generatorów (domyślnie 1)\n"
+          "  --quick             -n 16,64 --tri-sizes 1000 -p 128 -r 3\n"
+          "  --no-arena          typy MPFR bez areny GMP (utils/mp_arena.h)\n"
+          "  --no-perf           bez liczników sprzętowych perf_event\n"
+          "  --perf-fp L         zdarzenia działań FP: rCONFIG[*WAGA],... (szesnastkowo,\n"
+          "                      jak perf stat) albo none; domyślnie Intel FP_ARITH\n"
+          "  -o, --output PLIK   JSON do pliku zamiast stdout\n"
+          "  -q, --quiet         bez postępu na stderr\n"
+          "\n"
+          "Bazy wyników:\n"
+          "  --baseline-dir DIR  katalog baz (domyślnie $CROUT_BENCH_BASELINES\n"
+          "                      albo ./bench-baselines)\n"
+          "  --save-baseline N   zapisz wynik jako bazę N (DIR/N.json)\n"
+          "  --compare N|PLIK    porównaj z bazą N albo plikiem .json; kod wyjścia 1,\n"
+          "                      gdy któryś przypadek zwolnił albo przestał się liczyć\n"
+          "  --load PLIK         porównaj zapisany wynik zamiast mierzyć\n"
+          "  --threshold PROC    próg regresji mediany w % (domyślnie 5)\n"
+          "  --confidence P      poziom przedziału ufności (domyślnie 0.95)\n"
+          "  --report PLIK       wynik porównania jako JSON\n"
+          "  -h, --help\n"
+          "\n"
+          "Kody wyjścia: 0 – bez regresji, 1 – regresja, 2 – błąd.\n";
+}
+
+[[noreturn]] void fail(const std::string &msg)
+{
+    std::cerr << "crout-bench: " << msg << "\n";
+    std::exit(2);
+}
+
+std::vector<std::string> splitList(const std::string &s)
+{
+    std::vector<std::string> out;
+    std::stringstream ss(s);
+    for (std::string item; std::getline(ss, item, ',');)
+        if (!item.empty())
+            out.push_back(item);
+    if (out.empty())
+        fail("empty list '" + s + "'");
+    return out;
+}
+
+std::vector<int> parseInts(const std::string &opt, const std::string &s)
+{
+    std::vector<int> out;
+    for (const auto &item : splitList(s)) {
+        char *end = nullptr;
+        const long v = std::strtol(item.c_str(), &end, 10);
+        if (*end || v <= 0 || v > (1L << 30))
+            fail("invalid value for " + opt + ": '" + item + "'");
+        out.push_back(int(v));
+    }
+    return out;
+}
+
+double parseReal(const std::string &opt, const std::string &v, double lo, double hi)
+{
+    char *end = nullptr;
+    const double x = std::strtod(v.c_str(), &end);
+    if (*end || !(x >= lo && x <= hi))
+        fail("invalid value for " + opt + ": '" + v + "'");
+    return x;
+}
+
+Options parseArgs(int argc, char **argv)
+{
+    Options o;
+    if (const char *dir = std::getenv("CROUT_BENCH_BASELINES"))
+        o.baselineDir = dir;
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc)
+                fail("missing value for " + a);
+            return argv[++i];
+        };
+        if (a == "-h" || a == "--help") {
+            usage(std::cout);
+            std::exit(0);
+        } else if (a == "--suite") {
+            const std::string v = value();
+            if (v == "solvers")         o.suite = Suite::Solvers;
+            else if (v == "primitives") o.suite = Suite::Primitives;
+            else fail("unknown suite '" + v + "'");
+        } else if (a == "-s" || a == "--solvers") {
+            o.solvers.clear();
+            for (const auto &v : splitList(value())) {
+                if (v == "general")          o.solvers.push_back(SolverKind::General);
+                else if (v == "symmetric")   o.solvers.push_back(SolverKind::Symmetric);
+                else if (v == "tridiagonal") o.solvers.push_back(SolverKind::Tridiagonal);
+                else fail("unknown solver '" + v + "'");
+            }
+        } else if (a == "-t" || a == "--types") {
+            o.types.clear();
+            o.typesSet = true;
+            for (const auto &v : splitList(value())) {
+                if (v == "double")               o.types.push_back(DataType::Double);
+                else if (v == "dd")              o.types.push_back(DataType::DoubleDouble);
+                else if (v == "qd")              o.types.push_back(DataType::QuadDouble);
+                else if (v == "mpreal")          o.types.push_back(DataType::Mpreal);
+                else if (v == "interval")        o.types.push_back(DataType::Interval);
+                else if (v == "interval-double") o.types.push_back(DataType::IntervalDouble);
+#ifdef CROUT_HAVE_FLOAT128
+                else if (v == "float128")        o.types.push_back(DataType::Float128);
+#endif
+                else fail("unknown type '" + v + "'");
+            }
+        } else if (a == "-g" || a == "--matrices") {
+            o.matrices.clear();
+            for (const auto &v : splitList(value())) {
+                if (v == "spd")          o.matrices.push_back(MatrixType::Spd);
+                else if (v == "dd")      o.matrices.push_back(MatrixType::DiagDominant);
+                else if (v == "hilbert") o.matrices.push_back(MatrixType::Hilbert);
+                else if (v == "poisson") o.matrices.push_back(MatrixType::Poisson);
+                else fail("unknown matrix '" + v + "'");
+            }
+        } else if (a == "-n" || a == "--sizes") {
+            o.sizes = parseInts(a, value());
+        } else if (a == "--tri-sizes") {
+            o.triSizes = parseInts(a, value());
+        } else if (a == "-p" || a == "--precisions") {
+            o.precisions = parseInts(a, value());
+        } else if (a == "-r" || a == "--reps") {
+            o.reps = parseInts(a, value()).front();
+        } else if (a == "--min-time") {
+            o.minTime = parseReal(a, value(), 0, 60);
+        } else if (a == "--seed") {
+            o.seed = std::uint64_t(parseInts(a, value()).front());
+        } else if (a == "--quick") {
+            o.sizes = {16, 64};
+            o.triSizes = {1000};
+            o.precisions = {128};
+            o.reps = 3;
+        } else if (a == "--no-arena") {
+            o.arena = false;
+        } else if (a == "--no-perf") {
+            o.perf = false;
+        } else if (a == "--perf-fp") {
+            o.perfFp = value();
+        } else if (a == "-o" || a == "--output") {
+            o.output = value();
+        } else if (a == "-q" || a == "--quiet") {
+            o.quiet = true;
+        } else if (a == "--baseline-dir") {
+            o.baselineDir = value();
+        } else if (a == "--save-baseline") {
+            o.saveBaseline = value();
+        } else if (a == "--compare") {
+            o.compare = value();
+        } else if (a == "--load") {
+            o.load = value();
+        } else if (a == "--threshold") {
+            o.compareOptions.threshold = parseReal(a, value(), 0, 1000) / 100.0;
+        } else if (a == "--confidence") {
+            o.compareOptions.confidence = parseReal(a, value(), 0.5, 0.999);
+        } else if (a == "--report") {
+            o.report = value();
+        } else {
+            fail("unknown option '" + a + "'");
+        }
+    }
+    if (o.suite == Suite::Primitives) {
+        if (!o.typesSet)
+            o.types = {DataType::Interval, DataType::IntervalDouble};
+        o.types.erase(std::remove_if(o.types.begin(), o.types.end(), [](DataType t) {
+                          return t != DataType::Interval && t != DataType::IntervalDouble;
+                      }), o.types.end());
+        if (o.types.empty())
+            fail("--suite primitives needs -t interval and/or interval-double");
+    }
+    if (!o.load.empty() && o.compare.empty())
+        fail("--load requires --compare");
+    if (!o.report.empty() && o.compare.empty())
+        fail("--report requires --compare");
+    if (!o.compare.empty() && o.compare == o.saveBaseline)
+        fail("--compare and --save-baseline name the same baseline");
+    try {
+        if (!o.saveBaseline.empty())
+            bench::baselinePath(o.baselineDir, o.saveBaseline);
+    } catch (const std::exception &e) {
+        fail(e.what());
+    }
+    if (!o.compare.empty() && o.reps < 3 && o.load.empty() && !o.quiet)
+        std::cerr << "crout-bench: warning: fewer than 3 samples per case, comparison will rarely be significant\n";
+    return o;
+}
+
+// ─────────────────────────────── typy ───────────────────────────────────────
+
+template <typename T> struct IsInterval : std::false_type {};
+template <typename T> struct IsInterval<IA::Interval<T>> : std::true_type {};
+
+template <typename T>
+constexpr bool usesMpfr()
+{
+    return std::is_same<T, mpreal>::value || std::is_same<T, IA::Interval<mpreal>>::value;
+}
+
+// Bity mantysy typu (MPFR: bieżąca domyślna precyzja)
+template <typename T>
+long mantissaBits()
+{
+    if constexpr (usesMpfr<T>())
+        return mpreal::get_default_prec();
+    else if constexpr (std::is_same<T, multidouble::DoubleDouble>::value)
+        return 106;
+    else if constexpr (std::is_same<T, multidouble::QuadDouble>::value)
+        return 212;
+#ifdef CROUT_HAVE_FLOAT128
+    else if constexpr (std::is_same<T, __float128>::value)
+        return 113;
+#endif
+    else
+        return 53;
+}
+
+// Element num / den w typie T; num dokładne w double. Przedziały: najwęższe
+// zawierające num / den.
+template <typename T>
+T makeValue(double num, long den)
+{
+    if constexpr (std::is_same<T, double>::value) {
+        return num / double(den);
+    } else if constexpr (std::is_same<T, mpreal>::value) {
+        mpreal v(num);
+        mpfr_div_si(v.mpfr_ptr(), v.mpfr_srcptr(), den, MPFR_RNDN);
+        return v;
+    } else if constexpr (std::is_same<T, multidouble::DoubleDouble>::value
+                         || std::is_same<T, multidouble::QuadDouble>::value) {
+        mpreal v(num, 512);
+        mpfr_div_si(v.mpfr_ptr(), v.mpfr_srcptr(), den, MPFR_RNDN);
+        return T(v);
+#ifdef CROUT_HAVE_FLOAT128
+    } else if constexpr (std::is_same<T, __float128>::value) {
+        return __float128(num) / __float128(den);
+#endif
+    } else {
+        using E = decltype(T().a);
+        const long bits = std::is_same<E, mpreal>::value ? mpreal::get_default_prec() : 53;
+        mpfr_t lo, hi;
+        mpfr_init2(lo, bits);
+        mpfr_init2(hi, bits);
+        mpfr_set_d(lo, num, MPFR_RNDD);
+        mpfr_set_d(hi, num, MPFR_RNDU);
+        mpfr_div_si(lo, lo, den, MPFR_RNDD);
+        mpfr_div_si(hi, hi, den, MPFR_RNDU);
+        T v;
+        if constexpr (std::is_same<E, mpreal>::value)
+            v = T(mpreal(lo), mpreal(hi));
+        else
+            v = T(mpfr_get_d(lo, MPFR_RNDD), mpfr_get_d(hi, MPFR_RNDU));
+        mpfr_clear(lo);
+        mpfr_clear(hi);
+        return v;
+    }
+}
+
+// Przybliżenie w double (przedziały: środek) – do residuum
+template <typename T>
+double toDouble(const T &v)
+{
+    if constexpr (std::is_same<T, double>::value)
+        return v;
+    else if constexpr (std::is_same<T, mpreal>::value)
+        return v.toDouble();
+    else if constexpr (std::is_same<T, multidouble::DoubleDouble>::value
+                       || std::is_same<T, multidouble::QuadDouble>::value)
+        return v.toDouble();
+#ifdef CROUT_HAVE_FLOAT128
+    else if constexpr (std::is_same<T, __float128>::value)
+        return double(v);
+#endif
+    else
+        return 0.5 * (toDouble(v.a) + toDouble(v.b));
+}
+
+// ───────────────────────────── generatory ───────────────────────────────────
+// Elementy jako num / den z num dokładnym w double, żeby każdy typ dostał
+// ten sam układ (Hilbert: 1 / (i + j + 1) zaokrąglone dopiero w typie T).
+
+struct Entry {
+    double num;
+    long den;
+};
+
+struct DenseSystem {
+    int n = 0;
+    std::vector<Entry> A;  // wierszami
+    std::vector<double> b;
+};
+
+struct TridiagonalSystem {
+    std::vector<double> a, d, c, b;
+};
+
+std::uint64_t caseSeed(std::uint64_t seed, MatrixType m, int n)
+{
+    return seed * 0x9e3779b97f4a7c15ull ^ (std::uint64_t(m) << 32) ^ std::uint64_t(n);
+}
+
+DenseSystem denseSystem(MatrixType m, int n, std::uint64_t seed)
+{
+    std::mt19937_64 rng(caseSeed(seed, m, n));
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    DenseSystem s;
+    s.n = n;
+    s.A.assign(std::size_t(n) * n, Entry{0.0, 1});
+    auto at = [&](int i, int j) -> Entry & { return s.A[std::size_t(i) * n + j]; };
+    switch (m) {
+    case MatrixType::Spd:
+        // symetryczna, ściśle diagonalnie dominująca z dodatnią przekątną
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < i; ++j)
+                at(i, j) = at(j, i) = Entry{u(rng), 1};
+            at(i, i) = Entry{double(n), 1};
+        }
+        break;
+    case MatrixType::DiagDominant:
+        // niesymetryczna, przekątna ±n na przemian
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j)
+                at(i, j) = Entry{i == j ? (i % 2 ? -double(n) : double(n)) : u(rng), 1};
+        break;
+    case MatrixType::Hilbert:
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j)
+                at(i, j) = Entry{1.0, long(i + j + 1)};
+        break;
+    case MatrixType::Poisson:
+        for (int i = 0; i < n; ++i) {
+            at(i, i) = Entry{2.0, 1};
+            if (i > 0)
+                at(i, i - 1) = at(i - 1, i) = Entry{-1.0, 1};
+        }
+        break;
+    }
+    s.b.resize(n);
+    for (auto &v : s.b)
+        v = u(rng);
+    return s;
+}
+
+TridiagonalSystem tridiagonalSystem(MatrixType m, int n, std::uint64_t seed)
+{
+    std::mt19937_64 rng(caseSeed(seed, m, n));
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    TridiagonalSystem s;
+    s.a.resize(n - 1);
+    s.c.resize(n - 1);
+    s.d.resize(n);
+    s.b.resize(n);
+    if (m == MatrixType::Poisson) {
+        std::fill(s.a.begin(), s.a.end(), -1.0);
+        std::fill(s.c.begin(), s.c.end(), -1.0);
+        std::fill(s.d.begin(), s.d.end(), 2.0);
+    } else {
+        for (int i = 0; i + 1 < n; ++i) {
+            s.a[i] = u(rng);
+            s.c[i] = u(rng);
+        }
+        for (int i = 0; i < n; ++i)
+            s.d[i] = i % 2 ? -4.0 : 4.0;
+    }
+    for (auto &v : s.b)
+        v = u(rng);
+    return s;
+}
+
+bool applies(SolverKind k, MatrixType m)
+{
+    switch (k) {
+    case SolverKind::General:     return m != MatrixType::Poisson;
+    case SolverKind::Symmetric:   return m == MatrixType::Spd || m == MatrixType::Hilbert;
+    case SolverKind::Tridiagonal: return m == MatrixType::Poisson || m == MatrixType::DiagDominant;
+    }
+    return false;
+}
+
+// Nominalna liczba działań: rozkład + oba podstawienia
+double flops(SolverKind k, double n)
+{
+    switch (k) {
+    case SolverKind::General:     return 2.0 * n * n * n / 3.0 + 2.0 * n * n;
+    case SolverKind::Symmetric:   return n * n * n / 3.0 + 2.0 * n * n;
+    case SolverKind::Tridiagonal: return 8.0 * n;
+    }
+    return 0;
+}
+
+// ───────────────────────────── pomiar ───────────────────────────────────────
+
+#ifdef __linux__
+// Zeruje szczytowe RSS procesu (Linux ≥ 4.0); false, gdy niedostępne
+bool resetPeakRss()
+{
+    std::ofstream f("/proc/self/clear_refs");
+    f << "5";
+    f.close();
+    return bool(f);
+}
+
+long peakRssKb()
+{
+    std::ifstream f("/proc/self/status");
+    for (std::string line; std::getline(f, line);)
+        if (line.compare(0, 6, "VmHWM:") == 0)
+            return std::strtol(line.c_str() + 6, nullptr, 10);
+    rusage ru{};
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+#else
+bool resetPeakRss() { return false; }
+long peakRssKb() { return 0; }
+#endif
+
+struct Measurement {
+    std::vector<double> samples;  // ns na rozwiązanie
+    std::uint64_t iterations = 0; // rozwiązań na próbkę
+    double allocations = 0, allocatedBytes = 0, mpAllocations = 0;
+    long peakRss = 0;
+    bench::PerfSample perf;       // na rozwiązanie, ze wszystkich próbek
+};
+
+// Liczniki sprzętowe procesu (main); nullptr przy --no-perf
+bench::PerfCounters *gPerf = nullptr;
+
+struct CaseResult {
+    SolverKind solver;
+    DataType type;
+    MatrixType matrix;
+    int n;
+    long precision;
+    Measurement m;
+    double residual;
+    std::string error;  // wyjątek solvera (np. przedział z zerem przy źle uwarunkowanej macierzy)
+};
+
+std::uint64_t mpAllocationCount()
+{
+    const auto s = utils::MpArena::threadStats();
+    return s.arenaAllocations + s.mallocAllocations;
+}
+
+// solve() zwraca x; wołane z areną MPFR jak w crout-cli
+template <typename T, typename Solve>
+Measurement measure(const Options &o, Solve solve, std::vector<double> &x)
+{
+    using Clock = std::chrono::steady_clock;
+    auto once = [&]() {
+        if constexpr (usesMpfr<T>()) {
+            utils::MpArenaScope arena;
+            return solve();
+        } else {
+            return solve();
+        }
+    };
+
+    Measurement m;
+    resetPeakRss();
+
+    // rozgrzanie, wynik do residuum i kalibracja liczby rozwiązań na próbkę
+    const auto t0 = Clock::now();
+    {
+        const std::vector<T> xs = once();
+        x.clear();
+        for (const auto &v : xs)
+            x.push_back(toDouble(v));
+    }
+    const double first = std::chrono::duration<double>(Clock::now() - t0).count();
+    m.iterations = first >= o.minTime ? 1 : std::uint64_t(std::ceil(o.minTime / std::max(first, 1e-9)));
+    m.iterations = std::min<std::uint64_t>(m.iterations, 1000000);
+
+    const std::uint64_t news0 = gAllocations.load(), bytes0 = gAllocatedBytes.load();
+    const std::uint64_t mp0 = mpAllocationCount();
+    if (gPerf)
+        gPerf->start();
+    for (int r = 0; r < o.reps; ++r) {
+        const auto s = Clock::now();
+        for (std::uint64_t k = 0; k < m.iterations; ++k)
+            once();
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - s).count();
+        m.samples.push_back(ns / double(m.iterations));
+    }
+    const double ops = double(m.iterations) * o.reps;
+    if (gPerf) {
+        m.perf = gPerf->stop();
+        m.perf /= ops;
+    }
+    m.allocations = double(gAllocations.load() - news0) / ops;
+    m.allocatedBytes = double(gAllocatedBytes.load() - bytes0) / ops;
+    m.mpAllocations = double(mpAllocationCount() - mp0) / ops;
+    m.peakRss = peakRssKb();
+    return m;
+}
+
+double denseResidual(const DenseSystem &s, const std::vector<double> &x)
+{
+    double r = 0, a = 0, xn = 0, bn = 0;
+    for (int i = 0; i < s.n; ++i) {
+        double ri = s.b[i], ai = 0;
+        for (int j = 0; j < s.n; ++j) {
+            const Entry &e = s.A[std::size_t(i) * s.n + j];
+            const double v = e.num / double(e.den);
+            ri -= v * x[j];
+            ai += std::fabs(v);
+        }
+        r = std::max(r, std::fabs(ri));
+        a = std::max(a, ai);
+        xn = std::max(xn, std::fabs(x[i]));
+        bn = std::max(bn, std::fabs(s.b[i]));
+    }
+    return r / (a * xn + bn);
+}
+
+double tridiagonalResidual(const TridiagonalSystem &s, const std::vector<double> &x)
+{
+    const std::size_t n = s.d.size();
+    double r = 0, a = 0, xn = 0, bn = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        double ri = s.b[i] - s.d[i] * x[i], ai = std::fabs(s.d[i]);
+        if (i > 0) {
+            ri -= s.a[i - 1] * x[i - 1];
+            ai += std::fabs(s.a[i - 1]);
+        }
+        if (i + 1 < n) {
+            ri -= s.c[i] * x[i + 1];
+            ai += std::fabs(s.c[i]);
+        }
+        r = std::max(r, std::fabs(ri));
+        a = std::max(a, ai);
+        xn = std::max(xn, std::fabs(x[i]));
+        bn = std::max(bn, std::fabs(s.b[i]));
+    }
+    return r / (a * xn + bn);
+}
+
+template <typename T>
+std::vector<T> convert(const std::vector<double> &v)
+{
+    std::vector<T> out;
+    out.reserve(v.size());
+    for (double e : v)
+        out.push_back(makeValue<T>(e, 1));
+    return out;
+}
+
+template <typename T>
+CaseResult runCase(const Options &o, SolverKind k, DataType type, MatrixType mt, int n)
+{
+    CaseResult r{k, type, mt, n, mantissaBits<T>(), {}, 0, {}};
+    std::vector<double> x;
+    if (k == SolverKind::Tridiagonal) {
+        const TridiagonalSystem s = tridiagonalSystem(mt, n, o.seed);
+        const std::vector<T> a = convert<T>(s.a), d = convert<T>(s.d), c = convert<T>(s.c), b = convert<T>(s.b);
+        r.m = measure<T>(o, [&] {
+            return solver::tridiagonal::solveCroutTridiagonal(solver::Span<const T>(a), solver::Span<const T>(d),
+                                                              solver::Span<const T>(c),
+                                                              solver::Span<const T>(b)).x;
+        }, x);
+        r.residual = tridiagonalResidual(s, x);
+    } else {
+        const DenseSystem s = denseSystem(mt, n, o.seed);
+        std::vector<T> A;
+        A.reserve(s.A.size());
+        for (const Entry &e : s.A)
+            A.push_back(makeValue<T>(e.num, e.den));
+        const std::vector<T> b = convert<T>(s.b);
+        const solver::MatrixView<const T> Av(A.data(), n);
+        const solver::Span<const T> bv(b);
+        if (k == SolverKind::General)
+            r.m = measure<T>(o, [&] { return solver::general::solveCroutGeneral(Av, bv).x; }, x);
+        else
+            r.m = measure<T>(o, [&] { return solver::symmetric::solveCroutSymmetric(Av, bv).x; }, x);
+        r.residual = denseResidual(s, x);
+    }
+    return r;
+}
+
+// ───────────────────────────── statystyka ───────────────────────────────────
+
+struct Summary {
+    double median, min, mean, stddev;
+};
+
+Summary summarize(std::vector<double> v)
+{
+    std::sort(v.begin(), v.end());
+    Summary s{};
+    const std::size_t n = v.size();
+    s.median = n % 2 ? v[n / 2] : 0.5 * (v[n / 2 - 1] + v[n / 2]);
+    s.min = v.front();
+    for (double x : v)
+        s.mean += x;
+    s.mean /= double(n);
+    for (double x : v)
+        s.stddev += (x - s.mean) * (x - s.mean);
+    s.stddev = n > 1 ? std::sqrt(s.stddev / double(n - 1)) : 0.0;
+    return s;
+}
+
+// ─────────────────────────────── JSON ───────────────────────────────────────
+
+std::string jsonEscape(const std::string &s)
+{
+    std::string out;
+    for (char ch : s) {
+        switch (ch) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(ch) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof buf, "\\u%04x", ch);
+                out += buf;
+            } else {
+                out += ch;
+            }
+        }
+    }
+    return out;
+}
+
+std::string number(double v)
+{
+    if (!std::isfinite(v))
+        return "null";
+    char buf[32];
+    std::snprintf(buf, sizeof buf, "%.6g", v);
+    return buf;
+}
+
+std::string cpuModel()
+{
+    std::ifstream f("/proc/cpuinfo");
+    for (std::string line; std::getline(f, line);)
+        if (line.compare(0, 10, "model name") == 0) {
+            const auto colon = line.find(':');
+            return colon == std::string::npos ? line : line.substr(line.find_first_not_of(' ', colon + 1));
+        }
+    return "unknown";
+}
+
+std::string timestamp()
+{
+    const std::time_t t = std::time(nullptr);
+    char buf[32];
+    std::strftime(buf, sizeof buf, "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&t));
+    return buf;
+}
+
+std::string compiler()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+// Typy liczone na jednostce FP; MPFR i __float128 to arytmetyka całkowita,
+// więc intensywność arytmetyczna bierze wtedy nominalną liczbę działań
+bool hardwareFp(DataType t)
+{
+    return t == DataType::Double || t == DataType::DoubleDouble || t == DataType::QuadDouble
+           || t == DataType::IntervalDouble;
+}
+
+// Liczniki na rozwiązanie; ns – średni czas rozwiązania z tych samych próbek
+std::string perfJson(const CaseResult &r, double ns)
+{
+    const bench::PerfSample &p = r.m.perf;
+    const bool measured = hardwareFp(r.type) && std::isfinite(p.fpOps);
+    const double work = measured ? p.fpOps : flops(r.solver, r.n);
+    const double bytes = p.llcMisses * 64.0;
+    return "{\"cycles\":" + number(p.cycles) + ",\"instructions\":" + number(p.instructions)
+           + ",\"ipc\":" + number(p.instructions / p.cycles) + ",\"llc_misses\":" + number(p.llcMisses)
+           + ",\"dram_bytes\":" + number(bytes) + ",\"fp_ops\":" + number(p.fpOps)
+           + ",\"gflops_hw\":" + number(p.fpOps / ns)
+           + ",\"arithmetic_intensity\":" + number(bytes > 0 ? work / bytes : NAN)
+           + ",\"ai_flops\":\"" + (measured ? "measured" : "nominal")
+           + "\",\"multiplexed\":" + (p.multiplexed ? "true" : "false") + "}";
+}
+
+std::string resultJson(const CaseResult &r)
+{
+    if (!r.error.empty())
+        return "{\"solver\":\"" + std::string(name(r.solver)) + "\",\"type\":\"" + name(r.type)
+               + "\",\"matrix\":\"" + name(r.matrix) + "\",\"n\":" + std::to_string(r.n)
+               + ",\"precision\":" + std::to_string(r.precision) + ",\"error\":\"" + jsonEscape(r.error)
+               + "\"}";
+    const Summary s = summarize(r.m.samples);
+    std::string j = "{\"solver\":\"" + std::string(name(r.solver)) + "\",\"type\":\"" + name(r.type)
+                    + "\",\"matrix\":\"" + name(r.matrix) + "\",\"n\":" + std::to_string(r.n)
+                    + ",\"precision\":" + std::to_string(r.precision)
+                    + ",\"iterations\":" + std::to_string(r.m.iterations)
+                    + ",\"ns_per_op\":" + number(s.median) + ",\"ns_min\":" + number(s.min)
+                    + ",\"ns_mean\":" + number(s.mean) + ",\"ns_stddev\":" + number(s.stddev)
+                    + ",\"gflops\":" + number(flops(r.solver, r.n) / s.median)
+                    + ",\"allocs_per_op\":" + number(r.m.allocations)
+                    + ",\"alloc_bytes_per_op\":" + number(r.m.allocatedBytes)
+                    + ",\"mp_allocs_per_op\":" + number(r.m.mpAllocations)
+                    + ",\"peak_rss_kb\":" + std::to_string(r.m.peakRss)
+                    + (gPerf ? ",\"perf\":" + perfJson(r, s.mean) : std::string())
+                    + ",\"residual\":" + number(r.residual) + ",\"samples_ns\":[";
+    for (std::size_t i = 0; i < r.m.samples.size(); ++i)
+        j += (i ? "," : "") + number(r.m.samples[i]);
+    return j + "]}";
+}
+
+// switchNs – mediana SetRounding tego typu i precyzji (0: nieznana)
+std::string primitiveJson(const bench::PrimitiveResult &r, double switchNs)
+{
+    const Summary s = summarize(r.samples);
+    std::string j = "{\"primitive\":\"" + r.primitive + "\",\"type\":\"" + r.type
+                    + "\",\"precision\":" + std::to_string(r.precision)
+                    + ",\"iterations\":" + std::to_string(r.iterations)
+                    + ",\"ns_per_op\":" + number(s.median) + ",\"ns_min\":" + number(s.min)
+                    + ",\"ns_mean\":" + number(s.mean) + ",\"ns_stddev\":" + number(s.stddev)
+                    + ",\"rounding_switches\":" + std::to_string(r.switches)
+                    + ",\"switch_share\":" + number(switchNs > 0 ? r.switches * switchNs / s.median : NAN)
+                    + ",\"samples_ns\":[";
+    for (std::size_t i = 0; i < r.samples.size(); ++i)
+        j += (i ? "," : "") + number(r.samples[i]);
+    return j + "]}";
+}
+
+std::string documentJson(const Options &o, const std::vector<std::string> &results)
+{
+    std::string j = "{\n\"tool\":\"crout-bench\",\"version\":\"" CROUT_VERSION "\",\"timestamp\":\"" + timestamp()
+                    + "\",\n\"host\":{\"cpu\":\"" + jsonEscape(cpuModel()) + "\",\"threads\":"
+                    + std::to_string(std::thread::hardware_concurrency()) + ",\"compiler\":\""
+                    + jsonEscape(compiler()) + "\",\"build_type\":\"" CROUT_BUILD_TYPE "\",\"perf\":\""
+                    + jsonEscape(gPerf ? gPerf->status() : "disabled") + "\"},\n"
+                    + "\"config\":{\"suite\":\"" + (o.suite == Suite::Primitives ? "primitives" : "solvers")
+                    + "\",\"reps\":" + std::to_string(o.reps)
+                    + ",\"min_time\":" + number(o.minTime) + ",\"seed\":" + std::to_string(o.seed)
+                    + ",\"mp_arena\":" + (o.arena ? "true" : "false") + ",\"rss_per_case\":"
+                    + (resetPeakRss() ? "true" : "false")
+                    + "},\n\"results\":[\n";
+    for (std::size_t i = 0; i < results.size(); ++i)
+        j += results[i] + (i + 1 < results.size() ? ",\n" : "\n");
+    return j + "]}\n";
+}
+
+// ───────────────────────────── przebieg ─────────────────────────────────────
+
+CaseResult runTyped(const Options &o, SolverKind k, DataType t, MatrixType m, int n)
+{
+    switch (t) {
+    case DataType::Double:         return runCase<double>(o, k, t, m, n);
+    case DataType::DoubleDouble:   return runCase<multidouble::DoubleDouble>(o, k, t, m, n);
+    case DataType::QuadDouble:     return runCase<multidouble::QuadDouble>(o, k, t, m, n);
+    case DataType::Mpreal:         return runCase<mpreal>(o, k, t, m, n);
+    case DataType::Interval:       return runCase<IA::Interval<mpreal>>(o, k, t, m, n);
+    case DataType::IntervalDouble: return runCase<IA::Interval<double>>(o, k, t, m, n);
+    case DataType::Float128:
+#ifdef CROUT_HAVE_FLOAT128
+        return runCase<__float128>(o, k, t, m, n);
+#endif
+        break;
+    }
+    fail("unsupported scalar type");
+}
+
+std::vector<std::string> runSolvers(const Options &o)
+{
+    std::vector<CaseResult> results;
+    for (SolverKind k : o.solvers)
+        for (DataType t : o.types) {
+            const bool mp = t == DataType::Mpreal || t == DataType::Interval;
+            const std::vector<int> precisions = mp ? o.precisions : std::vector<int>{0};
+            for (int p : precisions) {
+                if (mp)
+                    IA::Interval<mpreal>::SetPrecision(static_cast<IA::IAPrecision>(p));
+                for (MatrixType m : o.matrices) {
+                    if (!applies(k, m))
+                        continue;
+                    for (int n : k == SolverKind::Tridiagonal ? o.triSizes : o.sizes) {
+                        if (k == SolverKind::Tridiagonal && n < 2)
+                            continue;
+                        if (!o.quiet)
+                            std::cerr << name(k) << ' ' << name(t) << (mp ? "/" + std::to_string(p) : "")
+                                      << ' ' << name(m) << " n=" << n << " ... " << std::flush;
+                        try {
+                            results.push_back(runTyped(o, k, t, m, n));
+                        } catch (const std::exception &e) {
+                            results.push_back(CaseResult{k, t, m, n, mp ? p : 0, Measurement{}, 0, e.what()});
+                        }
+                        if (!o.quiet) {
+                            const CaseResult &r = results.back();
+                            if (r.error.empty()) {
+                                std::cerr << number(summarize(r.m.samples).median) << " ns/op";
+                                if (std::isfinite(r.m.perf.cycles) && std::isfinite(r.m.perf.instructions))
+                                    std::cerr << ", IPC " << number(r.m.perf.instructions / r.m.perf.cycles);
+                                std::cerr << "\n";
+                            }
+                            else
+                                std::cerr << "error: " << r.error << "\n";
+                        }
+                    }
+                }
+            }
+        }
+    std::vector<std::string> out;
+    for (const auto &r : results)
+        out.push_back(resultJson(r));
+    return out;
+}
+
+// Udział zmian trybu: switches × koszt SetRounding / czas działania
+std::vector<std::string> runPrimitives(const Options &o)
+{
+    bench::PrimitiveOptions po;
+    po.intervalMpreal = std::count(o.types.begin(), o.types.end(), DataType::Interval) > 0;
+    po.intervalDouble = std::count(o.types.begin(), o.types.end(), DataType::IntervalDouble) > 0;
+    po.precisions = o.precisions;
+    po.reps = o.reps;
+    po.minTime = o.minTime;
+    po.seed = o.seed;
+
+    const auto results = bench::runIntervalPrimitives(po, [&](const bench::PrimitiveResult &r) {
+        if (!o.quiet)
+            std::cerr << r.primitive << ' ' << r.type << '/' << r.precision << " ... "
+                      << number(summarize(r.samples).median) << " ns/op\n";
+    });
+
+    auto switchNs = [&](const bench::PrimitiveResult &r) {
+        for (const auto &q : results)
+            if (q.primitive == "SetRounding" && q.type == r.type && q.precision == r.precision)
+                return summarize(q.samples).median;
+        return 0.0;
+    };
+    std::vector<std::string> out;
+    if (!o.quiet)
+        std::cerr << "\nprimitive        type/prec              ns/op  switches  switch share\n";
+    for (const auto &r : results) {
+        const double sw = switchNs(r);
+        out.push_back(primitiveJson(r, sw));
+        if (!o.quiet) {
+            const double med = summarize(r.samples).median;
+            char line[160];
+            std::snprintf(line, sizeof line, "%-16s %-20s %10.4g  %8d  %11.1f%%\n", r.primitive.c_str(),
+                          (r.type + "/" + std::to_string(r.precision)).c_str(), med, r.switches,
+                          sw > 0 ? 100.0 * r.switches * sw / med : 0.0);
+            std::cerr << line;
+        }
+    }
+    return out;
+}
+
+// ─────────────────────────── bazy wyników ───────────────────────────────────
+
+void writeFile(const std::string &path, const std::string &text)
+{
+    std::ofstream f(path);
+    f << text;
+    if (!f)
+        fail("cannot write '" + path + "'");
+}
+
+void saveBaseline(const Options &o, const std::string &doc)
+{
+    const std::string path = bench::baselinePath(o.baselineDir, o.saveBaseline);
+    std::error_code ec;
+    std::filesystem::create_directories(o.baselineDir, ec);
+    if (ec)
+        fail("cannot create '" + o.baselineDir + "': " + ec.message());
+    writeFile(path, doc);
+    if (!o.quiet)
+        std::cerr << "crout-bench: baseline '" << o.saveBaseline << "' saved to " << path << "\n";
+}
+
+// Ścieżka .json albo nazwa bazy w --baseline-dir
+std::string comparePath(const Options &o)
+{
+    const std::string &c = o.compare;
+    if (c.find('/') != std::string::npos || (c.size() > 5 && c.compare(c.size() - 5, 5, ".json") == 0))
+        return c;
+    return bench::baselinePath(o.baselineDir, c);
+}
+
+std::string comparisonJson(const Options &o, const bench::BenchRun &base,
+                           const std::vector<bench::CaseComparison> &cmp)
+{
+    std::string j = "{\"baseline\":\"" + jsonEscape(o.compare) + "\",\"baseline_version\":\""
+                    + jsonEscape(base.version) + "\",\"baseline_timestamp\":\"" + jsonEscape(base.timestamp)
+                    + "\",\"threshold\":" + number(o.compareOptions.threshold)
+                    + ",\"confidence\":" + number(o.compareOptions.confidence)
+                    + ",\"regression\":" + (bench::hasRegression(cmp) ? "true" : "false") + ",\"cases\":[\n";
+    for (std::size_t i = 0; i < cmp.size(); ++i) {
+        const auto &c = cmp[i];
+        j += "{\"case\":\"" + jsonEscape(c.key) + "\",\"verdict\":\"" + bench::verdictName(c.verdict)
+             + "\",\"base_ns\":" + number(c.baseMedian) + ",\"current_ns\":" + number(c.currentMedian)
+             + ",\"ratio\":" + number(c.ratio) + ",\"ci_low\":" + number(c.low)
+             + ",\"ci_high\":" + number(c.high) + "}" + (i + 1 < cmp.size() ? ",\n" : "\n");
+    }
+    return j + "]}\n";
+}
+
+// Tabela na stderr: zmiany zawsze, bez zmian tylko bez -q; zwraca kod wyjścia
+int compareWithBaseline(const Options &o, const std::string &doc)
+{
+    bench::BenchRun base, current;
+    try {
+        base = bench::loadRun(comparePath(o));
+        current = o.load.empty() ? bench::parseRun(doc) : bench::loadRun(o.load);
+    } catch (const std::exception &e) {
+        fail(e.what());
+    }
+    if (base.cpu != current.cpu || base.buildType != current.buildType)
+        std::cerr << "crout-bench: warning: baseline from '" << base.cpu << "' (" << base.buildType
+                  << "), current run on '" << current.cpu << "' (" << current.buildType << ")\n";
+
+    const auto cmp = bench::compareRuns(base, current, o.compareOptions);
+    const int ci = int(std::lround(o.compareOptions.confidence * 100));
+    int slower = 0, failed = 0, faster = 0;
+    for (const auto &c : cmp) {
+        slower += c.verdict == bench::Verdict::Slower;
+        failed += c.verdict == bench::Verdict::Failed;
+        faster += c.verdict == bench::Verdict::Faster;
+        const bool changed = c.verdict != bench::Verdict::Unchanged;
+        if (o.quiet && !changed)
+            continue;
+        char line[256];
+        if (c.ratio > 0)
+            std::snprintf(line, sizeof line, "%-10s %-40s %12.4g -> %12.4g ns  x%.3f  [%.3f, %.3f] %d%%\n",
+                          bench::verdictName(c.verdict), c.key.c_str(), c.baseMedian, c.currentMedian, c.ratio,
+                          c.low, c.high, ci);
+        else
+            std::snprintf(line, sizeof line, "%-10s %s\n", bench::verdictName(c.verdict), c.key.c_str());
+        std::cerr << line;
+    }
+    std::cerr << "crout-bench: " << cmp.size() << " cases vs '" << o.compare << "': " << slower << " slower, "
+              << failed << " failed, " << faster << " faster (threshold "
+              << number(o.compareOptions.threshold * 100) << "%)\n";
+
+    if (!o.report.empty())
+        writeFile(o.report, comparisonJson(o, base, cmp));
+    return bench::hasRegression(cmp) ? 1 : 0;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    // arena GMP/MPFR – przed pierwszą alokacją mpreal, jak w crout-cli
+    utils::MpArena::install();
+    const Options o = parseArgs(argc, argv);
+    utils::MpArena::setEnabled(o.arena);
+
+    IA::Interval<mpreal>::Initialize();
+    IA::Interval<mpreal>::SetMode(IA::DINT_MODE);
+
+#ifndef NDEBUG
+    if (!o.quiet)
+        std::cerr << "crout-bench: warning: build without NDEBUG, timings are not representative\n";
+#endif
+    if (!o.load.empty())
+        return compareWithBaseline(o, std::string());
+
+    std::optional<bench::PerfCounters> perf;
+    if (o.perf && o.suite == Suite::Solvers) {
+        try {
+            perf.emplace(o.perfFp);
+        } catch (const std::exception &e) {
+            fail(e.what());
+        }
+        gPerf = &*perf;
+        if (!o.quiet)
+            std::cerr << "crout-bench: perf counters: " << perf->status() << "\n";
+    }
+
+    const std::string doc = documentJson(o, o.suite == Suite::Primitives ? runPrimitives(o) : runSolvers(o));
+    if (o.output.empty()) {
+        std::cout << doc << std::flush;
+        if (!std::cout)
+            fail("cannot write results");
+    } else {
+        writeFile(o.output, doc);
+    }
+    if (!o.saveBaseline.empty())
+        saveBaseline(o, doc);
+    return o.compare.empty() ? 0 : compareWithBaseline(o, doc);
+}
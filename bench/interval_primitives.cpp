@@ -0,0 +1,189 @@
+#include "interval_primitives.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fenv.h>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+#include "mpreal.h"
+#include "interval.hpp"
+#include "interval_rounding_fix.hpp"  // SetRounding<mpreal> przed pierwszym użyciem IAdd<mpreal>
+#include "utils/mp_arena.h"
+
+namespace IA = interval_arithmetic;
+using mpfr::mpreal;
+
+namespace bench {
+
+namespace {
+
+// Par argumentów na przebieg: dość, by gałęzie min/max IMul nie były
+// przewidywalne, i mało, by wszystko siedziało w L1 (dla double)
+constexpr std::size_t kPool = 256;
+
+template <typename T>
+struct Operands {
+    std::vector<IA::Interval<T>> x, y, yPositive, xImproper, out;
+};
+
+// Końce z [-2, 2] (y > 0 dla IDiv), szerokość ~1e-9 względnie
+template <typename T>
+Operands<T> makeOperands(std::uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> u(-2.0, 2.0), pos(0.5, 2.0);
+    auto interval = [&](double m) {
+        const double r = std::fabs(m) * 1e-9 + 1e-12;
+        return IA::Interval<T>(T(m - r), T(m + r));
+    };
+    Operands<T> o;
+    for (std::size_t i = 0; i < kPool; ++i) {
+        o.x.push_back(interval(u(rng)));
+        o.y.push_back(interval(u(rng)));
+        o.yPositive.push_back(interval(pos(rng)));
+        const IA::Interval<T> &x = o.x.back();
+        o.xImproper.push_back(IA::Interval<T>(x.b, x.a));
+        o.out.push_back(IA::Interval<T>());
+    }
+    return o;
+}
+
+template <typename T>
+constexpr bool isMpreal()
+{
+    return std::is_same<T, mpreal>::value;
+}
+
+// Jedna próbka: passes przebiegów body(); zwraca ns na działanie
+template <typename T, typename Body>
+double sample(std::uint64_t passes, std::size_t opsPerPass, Body &body)
+{
+    using Clock = std::chrono::steady_clock;
+    auto run = [&] {
+        const auto t0 = Clock::now();
+        for (std::uint64_t k = 0; k < passes; ++k)
+            body();
+        return std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+    };
+    double ns;
+    if constexpr (isMpreal<T>()) {
+        // jak w solverach: limby z areny, zwolnione bloki wracają na listy wolnych
+        utils::MpArenaScope arena;
+        ns = run();
+    } else {
+        ns = run();
+    }
+    return ns / (double(passes) * double(opsPerPass));
+}
+
+template <typename T, typename Body>
+PrimitiveResult measure(const PrimitiveOptions &o, const char *primitive, int switches, std::size_t opsPerPass,
+                        Body body)
+{
+    PrimitiveResult r;
+    r.primitive = primitive;
+    r.type = isMpreal<T>() ? "interval" : "interval-double";
+    r.precision = isMpreal<T>() ? long(mpreal::get_default_prec()) : 53L;
+    r.switches = switches;
+
+    // rozgrzanie i kalibracja: przebiegów na próbkę tyle, by trwała ≥ minTime
+    const double first = sample<T>(1, opsPerPass, body) * double(opsPerPass) * 1e-9;
+    std::uint64_t passes = first >= o.minTime ? 1 : std::uint64_t(std::ceil(o.minTime / std::max(first, 1e-9)));
+    passes = std::min<std::uint64_t>(passes, 100000000);
+    r.iterations = passes * opsPerPass;
+
+    for (int k = 0; k < o.reps; ++k)
+        r.samples.push_back(sample<T>(passes, opsPerPass, body));
+    return r;
+}
+
+template <typename T>
+void runType(const PrimitiveOptions &o, std::vector<PrimitiveResult> &out,
+             const std::function<void(const PrimitiveResult &)> &progress)
+{
+    using I = IA::Interval<T>;
+    Operands<T> v = makeOperands<T>(o.seed);
+    auto add = [&](PrimitiveResult r) {
+        if (progress)
+            progress(r);
+        out.push_back(std::move(r));
+    };
+    // każde działanie na kPool parach, wynik do out – kompilator nie może go pominąć
+    auto binary = [&](const char *primitive, I (*op)(const I &, const I &), const std::vector<I> &x,
+                      const std::vector<I> &y) {
+        add(measure<T>(o, primitive, 3, kPool, [&] {
+            for (std::size_t i = 0; i < kPool; ++i)
+                v.out[i] = op(x[i], y[i]);
+        }));
+    };
+
+    binary("IAdd", &IA::IAdd<T>, v.x, v.y);
+    binary("ISub", &IA::ISub<T>, v.x, v.y);
+    binary("IMul", &IA::IMul<T>, v.x, v.y);
+    binary("IDiv", &IA::IDiv<T>, v.x, v.yPositive);
+    binary("DIAdd", &IA::DIAdd<T>, v.x, v.y);
+    binary("DIAdd-improper", &IA::DIAdd<T>, v.xImproper, v.y);
+
+    // praca na końcach bez zmian trybu (bieżący: do najbliższej)
+    add(measure<T>(o, "raw-add", 0, kPool, [&] {
+        for (std::size_t i = 0; i < kPool; ++i) {
+            v.out[i].a = IA::RoundingBarrier(IA::RoundingBarrier(v.x[i].a) + v.y[i].a);
+            v.out[i].b = IA::RoundingBarrier(IA::RoundingBarrier(v.x[i].b) + v.y[i].b);
+        }
+    }));
+    add(measure<T>(o, "raw-mul", 0, kPool, [&] {
+        // ciało IMul bez SetRounding
+        for (std::size_t i = 0; i < kPool; ++i) {
+            const I &x = v.x[i], &y = v.y[i];
+            I &r = v.out[i];
+            for (T *end : {&r.a, &r.b}) {
+                const T x1y1 = IA::RoundingBarrier(IA::RoundingBarrier(x.a) * y.a);
+                const T x1y2 = IA::RoundingBarrier(IA::RoundingBarrier(x.a) * y.b);
+                const T x2y1 = IA::RoundingBarrier(IA::RoundingBarrier(x.b) * y.a);
+                *end = IA::RoundingBarrier(IA::RoundingBarrier(x.b) * y.b);
+                const bool lower = end == &r.a;
+                if (lower ? x2y1 < *end : x2y1 > *end)
+                    *end = x2y1;
+                if (lower ? x1y2 < *end : x1y2 > *end)
+                    *end = x1y2;
+                if (lower ? x1y1 < *end : x1y1 > *end)
+                    *end = x1y1;
+            }
+        }
+    }));
+
+    // Jedna zmiana trybu: na zmianę w dół i w górę, jak w IAdd; ostatnia
+    // przywraca do najbliższej poza pomiarem
+    constexpr std::size_t kSwitches = 64;
+    add(measure<T>(o, "SetRounding", 1, kSwitches, [&] {
+        for (std::size_t i = 0; i < kSwitches; i += 2) {
+            IA::SetRounding<T>(FE_DOWNWARD);
+            IA::SetRounding<T>(FE_UPWARD);
+        }
+    }));
+    IA::SetRounding<T>(FE_TONEAREST);
+}
+
+} // anonymous
+
+std::vector<PrimitiveResult> runIntervalPrimitives(const PrimitiveOptions &options,
+                                                   const std::function<void(const PrimitiveResult &)> &progress)
+{
+    std::vector<PrimitiveResult> out;
+    if (options.intervalDouble)
+        runType<double>(options, out, progress);
+    if (options.intervalMpreal) {
+        const mpfr_prec_t saved = mpreal::get_default_prec();
+        for (int p : options.precisions) {
+            mpreal::set_default_prec(p);
+            runType<mpreal>(options, out, progress);
+        }
+        mpreal::set_default_prec(saved);
+    }
+    return out;
+}
+
+} // namespace bench
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/**
+ * Mikropomiary działań z interval.hpp, na których stoi ścieżka przedziałowa
+ * solverów: IAdd, ISub, IMul, IDiv, DIAdd (dla przedziałów właściwych i dla
+ * niewłaściwych, gałąź Kaucher) oraz osobno jedna zmiana trybu zaokrąglania
+ * SetRounding<T> – dla Interval<mpreal> to mpreal::set_default_rnd,
+ * dla Interval<double> fesetround.
+ *
+ * Dla porównania mierzone są też same działania na końcach w bieżącym
+ * trybie, bez zmian zaokrąglania ("raw-add": dwa dodawania, "raw-mul":
+ * osiem mnożeń i wybór min/max jak w IMul). Czas działania ≈ praca na
+ * końcach + switches × koszt zmiany trybu – szacunek, bo zmiany w pętli
+ * SetRounding nie przeplatają się z działaniami jak wewnątrz IAdd.
+ */
+struct PrimitiveResult {
+    std::string primitive;        // "IAdd", "SetRounding", "raw-mul", ...
+    std::string type;             // "interval" (mpreal) albo "interval-double"
+    long precision = 0;           // bity mantysy końców
+    int switches = 0;             // wywołania SetRounding na jedno działanie
+    std::uint64_t iterations = 0; // działań na próbkę
+    std::vector<double> samples;  // ns na działanie
+};
+
+struct PrimitiveOptions {
+    bool intervalMpreal = true;
+    bool intervalDouble = true;
+    std::vector<int> precisions{64, 128, 256};  // tylko Interval<mpreal>
+    int reps = 5;
+    double minTime = 0.05;
+    std::uint64_t seed = 1;
+};
+
+// progress dostaje każdy wynik zaraz po pomiarze
+std::vector<PrimitiveResult> runIntervalPrimitives(const PrimitiveOptions &options,
+                                                   const std::function<void(const PrimitiveResult &)> &progress);
+
+} // namespace bench
@@ -0,0 +1,255 @@
+#include "perf_counters.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench {
+
+namespace {
+
+struct RawEvent {
+    std::uint64_t config;
+    double weight;
+};
+
+// "r1c7*1,r4c7*2" → zdarzenia surowe z wagami
+std::vector<RawEvent> parseRawEvents(const std::string &list)
+{
+    std::vector<RawEvent> out;
+    std::size_t pos = 0;
+    while (pos <= list.size()) {
+        const std::size_t comma = std::min(list.find(',', pos), list.size());
+        const std::string item = list.substr(pos, comma - pos);
+        pos = comma + 1;
+        if (item.empty())
+            continue;
+        const std::size_t star = item.find('*');
+        const std::string config = item.substr(0, star);
+        RawEvent e{0, 1.0};
+        try {
+            std::size_t used = 0;
+            if (config.size() < 2 || config[0] != 'r')
+                throw std::invalid_argument("");
+            e.config = std::stoull(config.substr(1), &used, 16);
+            if (used + 1 != config.size())
+                throw std::invalid_argument("");
+            if (star != std::string::npos)
+                e.weight = std::stod(item.substr(star + 1));
+        } catch (const std::exception &) {
+            throw std::invalid_argument("Invalid raw perf event '" + item + "' (expected rHEX[*WEIGHT]).");
+        }
+        out.push_back(e);
+    }
+    return out;
+}
+
+#ifdef __linux__
+
+std::string cpuInfoField(const char *key)
+{
+    std::ifstream f("/proc/cpuinfo");
+    const std::size_t len = std::strlen(key);
+    for (std::string line; std::getline(f, line);)
+        if (line.compare(0, len, key) == 0) {
+            const auto colon = line.find(':');
+            return colon == std::string::npos ? std::string() : line.substr(colon + 2);
+        }
+    return {};
+}
+
+// FP_ARITH_INST_RETIRED (zdarzenie 0xC7): scalar double, 128/256/512-bit packed double
+std::vector<RawEvent> intelDoubleFlops()
+{
+    return {{0x01c7, 1.0}, {0x04c7, 2.0}, {0x10c7, 4.0}, {0x40c7, 8.0}};
+}
+
+// Typ PMU dla zdarzeń surowych; na procesorach hybrydowych rdzenie P ("cpu_core")
+std::uint32_t rawPmuType()
+{
+    for (const char *path : {"/sys/bus/event_source/devices/cpu/type",
+                             "/sys/bus/event_source/devices/cpu_core/type"}) {
+        std::ifstream f(path);
+        std::uint32_t type;
+        if (f >> type)
+            return type;
+    }
+    return PERF_TYPE_RAW;
+}
+
+std::string paranoid()
+{
+    std::ifstream f("/proc/sys/kernel/perf_event_paranoid");
+    std::string v;
+    f >> v;
+    return v.empty() ? "?" : v;
+}
+
+// -1 i errno przy błędzie
+int openEvent(std::uint32_t type, std::uint64_t config)
+{
+    perf_event_attr a;
+    std::memset(&a, 0, sizeof a);
+    a.size = sizeof a;
+    a.type = type;
+    a.config = config;
+    a.disabled = 1;
+    a.exclude_kernel = 1;
+    a.exclude_hv = 1;
+    a.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return int(syscall(SYS_perf_event_open, &a, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+std::string reason(int err)
+{
+    switch (err) {
+    case EACCES:
+    case EPERM:
+        return "not permitted (perf_event_paranoid=" + paranoid() + ", needs <= 2 or CAP_PERFMON)";
+    case ENOENT:
+    case EOPNOTSUPP:
+    case ENODEV:
+    case EINVAL:
+        return "not supported here (" + std::string(std::strerror(err)) + ")";
+    case ENOSYS:
+        return "perf_event_open unavailable";
+    default:
+        return std::strerror(err);
+    }
+}
+
+#endif
+
+} // anonymous
+
+#ifdef __linux__
+
+PerfCounters::PerfCounters(const std::string &fpEvents)
+{
+    std::vector<std::string> opened, missing;
+    // 0 albo errno
+    auto add = [&](Kind kind, std::uint32_t type, std::uint64_t config, double weight = 1.0) -> int {
+        const int fd = openEvent(type, config);
+        if (fd >= 0)
+            counters_.push_back({fd, kind, weight});
+        return fd >= 0 ? 0 : errno;
+    };
+    auto single = [&](const char *name, Kind kind, std::uint32_t type, std::uint64_t config) {
+        if (const int err = add(kind, type, config))
+            missing.push_back(std::string(name) + ": " + reason(err));
+        else
+            opened.push_back(name);
+    };
+
+    single("cycles", Kind::Cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    single("instructions", Kind::Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+
+    const std::uint64_t llRead = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                 | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    if (add(Kind::LlcMisses, PERF_TYPE_HW_CACHE, llRead) == 0)
+        opened.push_back("llc-misses");
+    else
+        single("llc-misses", Kind::LlcMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+
+    std::vector<RawEvent> fp;
+    if (fpEvents == "none")
+        missing.push_back("fp-ops: disabled");
+    else if (!fpEvents.empty())
+        fp = parseRawEvents(fpEvents);
+    else if (cpuInfoField("vendor_id") == "GenuineIntel" && cpuInfoField("cpu family") == "6")
+        fp = intelDoubleFlops();
+    else
+        missing.push_back("fp-ops: no known event for this CPU (use --perf-fp)");
+
+    if (!fp.empty()) {
+        // wszystkie albo żadne – częściowa suma byłaby myląca
+        const std::size_t before = counters_.size();
+        const std::uint32_t type = rawPmuType();
+        int err = 0;
+        for (const RawEvent &e : fp)
+            if ((err = add(Kind::FpOps, type, e.config, e.weight)) != 0)
+                break;
+        if (err) {
+            for (std::size_t k = before; k < counters_.size(); ++k)
+                close(counters_[k].fd);
+            counters_.resize(before);
+            missing.push_back("fp-ops: " + reason(err));
+        } else {
+            opened.push_back("fp-ops");
+        }
+    }
+
+    for (std::size_t k = 0; k < opened.size(); ++k)
+        status_ += (k ? ", " : "") + opened[k];
+    if (opened.empty())
+        status_ = "no counters";
+    for (const auto &m : missing)
+        status_ += "; " + m;
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (const Counter &c : counters_)
+        close(c.fd);
+}
+
+void PerfCounters::start()
+{
+    for (const Counter &c : counters_) {
+        ioctl(c.fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(c.fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+PerfSample PerfCounters::stop()
+{
+    for (const Counter &c : counters_)
+        ioctl(c.fd, PERF_EVENT_IOC_DISABLE, 0);
+
+    PerfSample s;
+    auto accumulate = [](double &field, double v) { field = std::isnan(field) ? v : field + v; };
+    for (const Counter &c : counters_) {
+        std::uint64_t v[3];  // value, time enabled, time running
+        if (read(c.fd, v, sizeof v) != ssize_t(sizeof v) || v[2] == 0)
+            continue;  // licznik nie dostał czasu na PMU
+        double value = double(v[0]);
+        if (v[2] < v[1]) {
+            value *= double(v[1]) / double(v[2]);
+            s.multiplexed = true;
+        }
+        switch (c.kind) {
+        case Kind::Cycles:       accumulate(s.cycles, value); break;
+        case Kind::Instructions: accumulate(s.instructions, value); break;
+        case Kind::LlcMisses:    accumulate(s.llcMisses, value); break;
+        case Kind::FpOps:        accumulate(s.fpOps, value * c.weight); break;
+        }
+    }
+    return s;
+}
+
+#else
+
+PerfCounters::PerfCounters(const std::string &fpEvents)
+{
+    if (!fpEvents.empty() && fpEvents != "none")
+        parseRawEvents(fpEvents);
+    status_ = "no counters; perf_event is Linux-only";
+}
+
+PerfCounters::~PerfCounters() = default;
+void PerfCounters::start() {}
+PerfSample PerfCounters::stop() { return {}; }
+
+#endif
+
+} // namespace bench
@@ -0,0 +1,72 @@
+#pragma once
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/**
+ * Liczniki sprzętowe przez perf_event_open(2), tylko bieżący wątek i tylko
+ * przestrzeń użytkownika (wystarcza perf_event_paranoid ≤ 2):
+ *   cycles, instructions           – zdarzenia ogólne jądra,
+ *   llcMisses                      – chybienia odczytu w ostatnim poziomie
+ *                                    cache (LL read miss, inaczej cache-misses);
+ *                                    × 64 B to dolne oszacowanie ruchu z DRAM,
+ *   fpOps                          – działania zmiennoprzecinkowe double:
+ *                                    na Intelu FP_ARITH_INST_RETIRED (skalarne
+ *                                    i wektorowe 128/256/512 z wagą 1/2/4/8,
+ *                                    FMA liczone podwójnie), gdzie indziej
+ *                                    tylko z listą zdarzeń surowych.
+ *
+ * Każdy licznik otwierany jest osobno; niedostępne (brak PMU w maszynie
+ * wirtualnej, zakaz paranoid, nieznany procesor) zostają NaN, a status()
+ * mówi dlaczego. Gdy jądro przeplata liczniki, wartości są skalowane
+ * czasem enabled / running i sample.multiplexed = true.
+ */
+struct PerfSample {
+    double cycles = NAN;
+    double instructions = NAN;
+    double llcMisses = NAN;
+    double fpOps = NAN;
+    bool multiplexed = false;
+
+    PerfSample &operator/=(double d)
+    {
+        cycles /= d;
+        instructions /= d;
+        llcMisses /= d;
+        fpOps /= d;
+        return *this;
+    }
+};
+
+class PerfCounters {
+public:
+    // fpEvents: "" – wykryj procesor, "none" – bez fpOps, albo lista
+    // zdarzeń surowych "rCONFIG[*WAGA],..." (CONFIG szesnastkowo, jak w perf stat)
+    explicit PerfCounters(const std::string &fpEvents = std::string());
+    ~PerfCounters();
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    bool available() const { return !counters_.empty(); }
+    // np. "cycles, instructions, llc-misses; fp-ops: unsupported CPU"
+    const std::string &status() const { return status_; }
+
+    // Zeruje i włącza liczniki
+    void start();
+    // Wyłącza i zwraca sumy od start()
+    PerfSample stop();
+
+private:
+    enum class Kind { Cycles, Instructions, LlcMisses, FpOps };
+    struct Counter {
+        int fd;
+        Kind kind;
+        double weight;
+    };
+    std::vector<Counter> counters_;
+    std::string status_;
+};
+
+} // namespace bench
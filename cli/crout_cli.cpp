@@ -0,0 +1,962 @@
+// crout-cli – wsadowy solver Crouta bez Qt.
+//
+// Czyta zadania z plików (lub stdin), rozwiązuje je równolegle na wątkach
+// i wypisuje wyniki jako JSON Lines – jeden obiekt na zadanie, w kolejności
+// wejścia. Klient biblioteki croutsolver: zadania trzymane w std::vector
+// i przekazywane jako MatrixView/Span (solver/crout_types.h).
+//
+// Format wejścia (białe znaki dowolne, '#' do końca linii to komentarz):
+//   general / symmetric:  n, potem n·n elementów A wierszami, potem n elementów b
+//   tridiagonal:          n, potem a (n-1), d (n), c (n-1), b (n)
+// Elementy przedziałowe: "lo;hi" albo jedna liczba (najwęższe zawierające
+// ją przedziały przy bieżącej precyzji).
+//
+// Duże układy: --bin-matrix/--bin-rhs czytają jeden układ z plików binarnych
+// .crm (utils/matrix_file.h) przez mmap, --bin-solution zapisuje x tak samo.
+// --out-of-core rozkłada taką macierz kafelkami na dysku, w zadanej pamięci
+// (solver/outofcore/crout_outofcore.h); trójdiagonalną rozwiązuje strumieniowo
+// z x zapisywanym do --bin-solution.
+// --text-matrix/--text-rhs czytają go z Matrix Market albo CSV równolegle
+// (utils/text_matrix.h); --convert zapisuje taką macierz jako .crm.
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <mpfr.h>
+#include "mpreal.h"
+#include "interval.hpp"
+#include "interval_rounding_fix.hpp"
+#include "multi_double.hpp"
+#include "float128.hpp"
+#include "utils/instrumentation.h"
+#include "utils/mp_arena.h"
+#include "utils/trace.h"
+#include "utils/matrix_file.h"
+#include "utils/text_matrix.h"
+
+#include "solver/crout_types.h"
+#include "solver/outofcore/crout_outofcore.h"
+#include "solver/general/crout_general_double.h"
+#include "solver/general/crout_general_mpreal.h"
+#include "solver/general/crout_general_interval.h"
+#include "solver/general/crout_general_multidouble.h"
+#include "solver/general/crout_general_float128.h"
+#include "solver/symmetric/crout_symmetric_double.h"
+#include "solver/symmetric/crout_symmetric_mpreal.h"
+#include "solver/symmetric/crout_symmetric_interval.h"
+#include "solver/symmetric/crout_symmetric_multidouble.h"
+#include "solver/symmetric/crout_symmetric_float128.h"
+#include "solver/tridiagonal/crout_tridiagonal_double.h"
+#include "solver/tridiagonal/crout_tridiagonal_mpreal.h"
+#include "solver/tridiagonal/crout_tridiagonal_interval.h"
+#include "solver/tridiagonal/crout_tridiagonal_multidouble.h"
+#include "solver/tridiagonal/crout_tridiagonal_float128.h"
+
+namespace IA = interval_arithmetic;
+using mpfr::mpreal;
+
+namespace {
+
+enum class DataType { Double, DoubleDouble, QuadDouble, Float128, Mpreal, Interval, IntervalDouble };
+enum class MatrixKind { General, Symmetric, Tridiagonal };
+
+struct Options {
+    DataType type = DataType::Double;
+    MatrixKind kind = MatrixKind::General;
+    int precision = 0;  // bity mpreal; 0 = domyślne z Interval<mpreal>::Initialize
+    int threads = 0;    // 0 = hardware_concurrency
+    int digits = 0;     // cyfry po przecinku na wyjściu; 0 = pełna precyzja typu
+    std::string output;
+    std::vector<std::string> inputs;
+    // układ w plikach binarnych .crm (utils/matrix_file.h)
+    std::string binMatrix, binRhs, binSolution;
+    // rozkład poza pamięcią: limit pamięci w MiB (0 = w pamięci), bok kafelka
+    int outOfCore = 0;
+    int tile = 0;
+    // układ w plikach Matrix Market / CSV; convert – zapis macierzy do .crm
+    std::string textMatrix, textRhs, convert;
+    // oś czasu zadań w formacie Chrome trace (utils/trace.h)
+    std::string trace;
+};
+
+struct Problem {
+    std::string source;
+    int n = 0;
+    std::vector<const char *> tokens;  // słowa w buforze wejścia (main)
+};
+
+void usage(std::ostream &os)
+{
+    os << "Użycie: crout-cli [opcje] [plik...]   (bez plików lub '-' → stdin)\n"
+          "  -t, --type T        double | dd | qd | float128 | mpreal | interval | interval-double\n"
+          "                      (domyślnie double; interval = Interval<mpreal>)\n"
+          "  -m, --matrix K      general | symmetric | tridiagonal (domyślnie general)\n"
+          "  -p, --precision B   precyzja mpreal w bitach (mpreal, interval)\n"
+          "  -j, --threads N     liczba wątków (domyślnie wszystkie rdzenie)\n"
+          "  -d, --digits D      cyfry po przecinku w wyniku\n"
+          "  -o, --output PLIK   wynik do pliku zamiast stdout\n"
+          "  --bin-matrix PLIK   jeden układ z pliku binarnego .crm (typ z nagłówka)\n"
+          "  --bin-rhs PLIK      prawa strona .crm (Dense n×1) do --bin-matrix\n"
+          "  --bin-solution PLIK x zapisane do .crm zamiast do JSON\n"
+          "  --out-of-core MB    rozkład --bin-matrix kafelkami w pliku tymczasowym,\n"
+          "                      najwyżej MB MiB kafelków w pamięci; trójdiagonalna\n"
+          "                      strumieniowo, wymaga --bin-solution\n"
+          "  --tile N            bok kafelka / długość bloku dla --out-of-core\n"
+          "  --text-matrix PLIK  jeden układ z pliku Matrix Market (.mtx) lub CSV\n"
+          "                      (typ z -t, układ z -m)\n"
+          "  --text-rhs PLIK     prawa strona (wektor Matrix Market lub CSV)\n"
+          "  --convert PLIK      zapisz macierz z --text-matrix do .crm i zakończ\n"
+          "  --trace PLIK        oś czasu zadań (wątki, kafelki, oczekiwanie na I/O)\n"
+          "                      jako JSON Chrome trace – chrome://tracing, Perfetto\n"
+          "  -h, --help\n"
+          "\n"
+          "Wejście: n, potem A wierszami (n·n) i b (n); dla tridiagonal: n, a (n-1),\n"
+          "d (n), c (n-1), b (n). Zadania następują po sobie do końca pliku.\n"
+          "Wyjście: JSON Lines {\"id\", \"source\", \"n\", \"status\", \"x\" | \"message\"}.\n"
+          "Status: ok | singular (zerowy pivot) | error (plik, I/O, dane).\n"
+          "Kod wyjścia: 0 – wszystkie układy ok lub singular, 1 – któryś error\n"
+          "albo błąd zapisu wyniku, 2 – złe argumenty lub nieczytelne wejście.\n"
+          "Biblioteka zbudowana z CROUT_INSTRUMENTATION dodaje \"stats\" (fazy i liczniki).\n";
+}
+
+[[noreturn]] void fail(const std::string &msg)
+{
+    std::cerr << "crout-cli: " << msg << "\n";
+    std::exit(2);
+}
+
+int parsePositive(const std::string &opt, const char *s)
+{
+    char *end = nullptr;
+    long v = std::strtol(s, &end, 10);
+    if (!*s || *end || v <= 0 || v > 1 << 20)
+        fail("invalid value for " + opt + ": '" + s + "'");
+    return static_cast<int>(v);
+}
+
+Options parseArgs(int argc, char **argv)
+{
+    Options o;
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        auto value = [&]() -> const char * {
+            if (i + 1 >= argc)
+                fail("missing value for " + a);
+            return argv[++i];
+        };
+        if (a == "-h" || a == "--help") {
+            usage(std::cout);
+            std::exit(0);
+        } else if (a == "-t" || a == "--type") {
+            const std::string v = value();
+            if (v == "double")               o.type = DataType::Double;
+            else if (v == "dd")              o.type = DataType::DoubleDouble;
+            else if (v == "qd")              o.type = DataType::QuadDouble;
+            else if (v == "mpreal")          o.type = DataType::Mpreal;
+            else if (v == "interval")        o.type = DataType::Interval;
+            else if (v == "interval-double") o.type = DataType::IntervalDouble;
+#ifdef CROUT_HAVE_FLOAT128
+            else if (v == "float128")        o.type = DataType::Float128;
+#endif
+            else fail("unknown type '" + v + "'");
+        } else if (a == "-m" || a == "--matrix") {
+            const std::string v = value();
+            if (v == "general")          o.kind = MatrixKind::General;
+            else if (v == "symmetric")   o.kind = MatrixKind::Symmetric;
+            else if (v == "tridiagonal") o.kind = MatrixKind::Tridiagonal;
+            else fail("unknown matrix class '" + v + "'");
+        } else if (a == "-p" || a == "--precision") {
+            o.precision = parsePositive(a, value());
+        } else if (a == "-j" || a == "--threads") {
+            o.threads = parsePositive(a, value());
+        } else if (a == "-d" || a == "--digits") {
+            o.digits = parsePositive(a, value());
+        } else if (a == "-o" || a == "--output") {
+            o.output = value();
+        } else if (a == "--bin-matrix") {
+            o.binMatrix = value();
+        } else if (a == "--bin-rhs") {
+            o.binRhs = value();
+        } else if (a == "--bin-solution") {
+            o.binSolution = value();
+        } else if (a == "--out-of-core") {
+            o.outOfCore = parsePositive(a, value());
+        } else if (a == "--tile") {
+            o.tile = parsePositive(a, value());
+        } else if (a == "--text-matrix") {
+            o.textMatrix = value();
+        } else if (a == "--text-rhs") {
+            o.textRhs = value();
+        } else if (a == "--convert") {
+            o.convert = value();
+        } else if (a == "--trace") {
+            o.trace = value();
+        } else if (a.size() > 1 && a[0] == '-') {
+            fail("unknown option '" + a + "'");
+        } else {
+            o.inputs.push_back(a);
+        }
+    }
+    if (o.binMatrix.empty() != o.binRhs.empty())
+        fail("--bin-matrix and --bin-rhs go together");
+    if (!o.binMatrix.empty() && !o.textMatrix.empty())
+        fail("--bin-matrix and --text-matrix are exclusive");
+    if (!o.textMatrix.empty() && o.textRhs.empty() && o.convert.empty())
+        fail("--text-matrix needs --text-rhs or --convert");
+    if (o.textMatrix.empty() && (!o.textRhs.empty() || !o.convert.empty()))
+        fail("--text-rhs and --convert require --text-matrix");
+    if (!o.binSolution.empty() && o.binMatrix.empty() && o.textMatrix.empty())
+        fail("--bin-solution requires --bin-matrix or --text-matrix");
+    if (o.outOfCore && o.binMatrix.empty())
+        fail("--out-of-core requires --bin-matrix");
+    if (o.tile && !o.outOfCore)
+        fail("--tile requires --out-of-core");
+    if (o.inputs.empty())
+        o.inputs.push_back("-");
+    return o;
+}
+
+// ----------------------------- wejście ---------------------------------
+
+// Cała zawartość strumienia; dane zadań wskazują do tego bufora
+std::string slurp(std::istream &in)
+{
+    std::string buf;
+    char chunk[1 << 16];
+    while (in.read(chunk, sizeof chunk) || in.gcount() > 0)
+        buf.append(chunk, static_cast<std::size_t>(in.gcount()));
+    return buf;
+}
+
+// Dzieli bufor na słowa w miejscu: separator (biały znak lub komentarz '#'
+// do końca linii) zamieniany jest na '\0', więc słowa to gotowe napisy C
+std::vector<const char *> tokenize(std::string &buf)
+{
+    std::vector<const char *> toks;
+    char *p = buf.data();
+    char *const e = p + buf.size();
+    while (p < e) {
+        if (*p == '#') {
+            while (p < e && *p != '\n')
+                *p++ = '\0';
+        } else if (std::isspace(static_cast<unsigned char>(*p))) {
+            *p++ = '\0';
+        } else {
+            toks.push_back(p);
+            while (p < e && *p != '#' && !std::isspace(static_cast<unsigned char>(*p)))
+                ++p;
+        }
+    }
+    return toks;
+}
+
+void readProblems(std::string &buf, const std::string &source, MatrixKind kind,
+                  std::vector<Problem> &out)
+{
+    const std::vector<const char *> toks = tokenize(buf);
+    std::size_t t = 0;
+    while (t < toks.size()) {
+        Problem p;
+        p.source = source;
+        char *end = nullptr;
+        const long n = std::strtol(toks[t], &end, 10);
+        if (*end || n <= 0 || n > 1 << 20)
+            fail(source + ": expected problem size, got '" + toks[t] + "'");
+        p.n = static_cast<int>(n);
+        ++t;
+
+        const std::size_t count = kind == MatrixKind::Tridiagonal
+                                      ? 4 * std::size_t(n) - 2
+                                      : std::size_t(n) * n + n;
+        if (toks.size() - t < count)
+            fail(source + ": unexpected end of input in problem " + std::to_string(out.size()));
+        p.tokens.assign(toks.begin() + t, toks.begin() + t + count);
+        t += count;
+        out.push_back(std::move(p));
+    }
+}
+
+// ------------------------ parsowanie i zapis ---------------------------
+
+// Cały napis jako liczba MPFR z zadanym zaokrągleniem
+bool parseMpfr(mpfr_ptr rop, const char *s, mpfr_rnd_t rnd)
+{
+    char *end = nullptr;
+    mpfr_strtofr(rop, s, &end, 10, rnd);
+    return end != s && *end == '\0';
+}
+
+[[noreturn]] void badNumber(const char *s)
+{
+    throw std::invalid_argument(std::string("Invalid number '") + s + "'");
+}
+
+std::string mpfrString(mpfr_srcptr v, int digits, char rnd)
+{
+    if (mpfr_nan_p(v) || mpfr_inf_p(v))
+        return "null";
+    const char fmt[] = {'"', '%', '.', '*', 'R', rnd, 'e', '"', '\0'};
+    char *buf = nullptr;
+    mpfr_asprintf(&buf, fmt, digits, v);
+    std::string s(buf);
+    mpfr_free_str(buf);
+    return s;
+}
+
+// Cyfry dziesiętne potrzebne do odtworzenia `bits` bitów
+int fullDigits(long bits)
+{
+    return static_cast<int>(std::ceil(bits * 0.30102999566398120)) + 1;
+}
+
+template <typename T>
+struct Codec;
+
+template <>
+struct Codec<double> {
+    double parse(const char *s) const {
+        char *end = nullptr;
+        const double v = std::strtod(s, &end);
+        if (end == s || *end)
+            badNumber(s);
+        return v;
+    }
+    std::string write(double v, int digits) const {
+        if (!std::isfinite(v))
+            return "null";
+        // bufor na cały zapis – przy dużym --digits wykładnik nie może zniknąć
+        const int d = digits ? digits : 16;
+        std::vector<char> buf(std::size_t(std::snprintf(nullptr, 0, "%.*e", d, v)) + 1);
+        std::snprintf(buf.data(), buf.size(), "%.*e", d, v);
+        return buf.data();
+    }
+    bool isZero(double v) const { return v == 0.0; }
+};
+
+template <>
+struct Codec<mpreal> {
+    mpreal parse(const char *s) const {
+        mpreal v;
+        if (!parseMpfr(v.mpfr_ptr(), s, mpreal::get_default_rnd()))
+            badNumber(s);
+        return v;
+    }
+    std::string write(const mpreal &v, int digits) const {
+        return mpfrString(v.mpfr_srcptr(), digits ? digits : fullDigits(v.get_prec()), 'N');
+    }
+    bool isZero(const mpreal &v) const { return mpfr_zero_p(v.mpfr_srcptr()) != 0; }
+};
+
+// double-double / quad-double: przez mpreal o precyzji większej niż typ
+template <typename T, int Bits, int Digits>
+struct MultiDoubleCodec {
+    T parse(const char *s) const {
+        mpreal v(0, Bits);
+        if (!parseMpfr(v.mpfr_ptr(), s, MPFR_RNDN))
+            badNumber(s);
+        return T(v);
+    }
+    std::string write(const T &v, int digits) const {
+        const mpreal m = v.toMpreal();
+        return mpfrString(m.mpfr_srcptr(), digits ? digits : Digits, 'N');
+    }
+    bool isZero(const T &v) const { return v.isZero(); }
+};
+
+template <>
+struct Codec<multidouble::DoubleDouble> : MultiDoubleCodec<multidouble::DoubleDouble, 256, 32> {};
+template <>
+struct Codec<multidouble::QuadDouble> : MultiDoubleCodec<multidouble::QuadDouble, 512, 64> {};
+
+#ifdef CROUT_HAVE_FLOAT128
+template <>
+struct Codec<__float128> {
+    __float128 parse(const char *s) const {
+        __float128 v;
+        if (!float128::parse(s, v))
+            badNumber(s);
+        return v;
+    }
+    std::string write(__float128 v, int digits) const {
+        if (!float128::isFinite(v))
+            return "null";
+        // w cudzysłowie jak dd/qd/mpreal – liczba JSON czytana jest jako double
+        return '"' + float128::toString(v, digits ? digits : 33) + '"';
+    }
+    bool isZero(__float128 v) const { return v == 0; }
+};
+#endif
+
+// Przedziały: końce czytane i wypisywane z zaokrągleniem na zewnątrz
+template <typename T>
+struct Codec<IA::Interval<T>> {
+    using I = IA::Interval<T>;
+    static constexpr bool isMp = std::is_same<T, mpreal>::value;
+
+    static long bits() { return isMp ? mpreal::get_default_prec() : 53; }
+
+    T end(const char *s, mpfr_rnd_t rnd) const {
+        mpfr_t r;
+        mpfr_init2(r, bits());
+        const bool ok = parseMpfr(r, s, rnd);
+        T v;
+        if constexpr (isMp)
+            v = mpreal(r);
+        else
+            v = mpfr_get_d(r, rnd);
+        mpfr_clear(r);
+        if (!ok)
+            badNumber(s);
+        return v;
+    }
+    I parse(const char *s) const {
+        const char *semi = std::strchr(s, ';');
+        if (!semi)
+            return I(end(s, MPFR_RNDD), end(s, MPFR_RNDU));
+        const std::string lo(s, semi);
+        return I(end(lo.c_str(), MPFR_RNDD), end(semi + 1, MPFR_RNDU));
+    }
+    std::string endString(const T &v, int digits, char rnd) const {
+        if constexpr (isMp) {
+            return mpfrString(v.mpfr_srcptr(), digits, rnd);
+        } else {
+            mpfr_t r;
+            mpfr_init2(r, 53);
+            mpfr_set_d(r, v, MPFR_RNDN);
+            std::string s = mpfrString(r, digits, rnd);
+            mpfr_clear(r);
+            return s;
+        }
+    }
+    std::string write(const I &v, int digits) const {
+        const int d = digits ? digits : fullDigits(bits());
+        return "[" + endString(v.a, d, 'D') + "," + endString(v.b, d, 'U') + "]";
+    }
+    // zerowy pivot: przedział zawierający zero (jak ScalarOps<Interval<T>>)
+    bool isZero(const I &v) const { return v.a <= T(0) && v.b >= T(0); }
+};
+
+// ------------------------------ solver ---------------------------------
+
+std::string jsonEscape(const std::string &s)
+{
+    std::string r;
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            r += '\\';
+        if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof buf, "\\u%04x", c);
+            r += buf;
+        } else {
+            r += c;
+        }
+    }
+    return r;
+}
+
+// Zerowy pivot trójdiagonalnej: solver zwraca D[i] == 0 (przedziały: D[i]
+// zawierające zero), a y i x wypełnia NaN
+template <typename T>
+bool tridiagonalSingular(const Codec<T> &codec, const std::vector<T> &diag)
+{
+    return std::any_of(diag.begin(), diag.end(), [&](const T &v) { return codec.isZero(v); });
+}
+
+// Pomiary rozwiązania (tylko biblioteka z CROUT_INSTRUMENTATION) jako "stats"
+std::string withStats(std::string line, const utils::SolveStats &stats)
+{
+    if (stats.collected) {
+        line.pop_back();
+        line += ",\"stats\":" + utils::toJson(stats) + "}";
+    }
+    return line;
+}
+
+// Któryś układ zakończony statusem "error" → kod wyjścia 1
+std::atomic<bool> anyError{false};
+
+// Błąd inny niż zerowy pivot: I/O, uszkodzony plik, brak pamięci, złe dane
+std::string errorLine(const std::string &head, const std::exception &e)
+{
+    anyError.store(true, std::memory_order_relaxed);
+    return head + "\"error\",\"message\":\"" + jsonEscape(e.what()) + "\"}";
+}
+
+template <typename T>
+std::string okLine(const std::string &head, const Codec<T> &codec, const std::vector<T> &x, int digits)
+{
+    std::string s = head + "\"ok\",\"x\":[";
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        if (i)
+            s += ',';
+        s += codec.write(x[i], digits);
+    }
+    return s + "]}";
+}
+
+// Wynik układu z plików: x w JSON albo w pliku --bin-solution
+template <typename T>
+std::string solvedLine(const std::string &head, const Codec<T> &codec, const std::vector<T> &x,
+                       bool singular, const Options &o)
+{
+    if (singular)
+        return head + "\"singular\"}";
+    if (o.binSolution.empty())
+        return okLine(head, codec, x, o.digits);
+    // typy MPFR: zapis z precyzją obliczeń
+    utils::writeVector<T>(o.binSolution, solver::Span<const T>(x));
+    return head + "\"ok\",\"solution\":\"" + jsonEscape(o.binSolution) + "\"}";
+}
+
+template <typename T>
+std::string solveOne(const Problem &p, std::size_t id, MatrixKind kind, int digits)
+{
+    const Codec<T> codec;
+    const int n = p.n;
+    std::string head = "{\"id\":" + std::to_string(id) + ",\"source\":\"" + jsonEscape(p.source)
+                       + "\",\"n\":" + std::to_string(n) + ",\"status\":";
+    try {
+        std::vector<T> x;
+        bool singular = false;
+        utils::SolveStats stats;
+        std::size_t t = 0;
+        auto next = [&]() { return codec.parse(p.tokens[t++]); };
+
+        if (kind == MatrixKind::Tridiagonal) {
+            std::vector<T> a(n - 1), d(n), c(n - 1), b(n);
+            for (auto &v : a) v = next();
+            for (auto &v : d) v = next();
+            for (auto &v : c) v = next();
+            for (auto &v : b) v = next();
+            auto r = solver::tridiagonal::solveCroutTridiagonal(
+                solver::Span<const T>(a), solver::Span<const T>(d),
+                solver::Span<const T>(c), solver::Span<const T>(b));
+            singular = tridiagonalSingular(codec, r.diag);
+            x = std::move(r.x);
+            stats = r.stats;
+        } else {
+            std::vector<T> A(std::size_t(n) * n), b(n);
+            for (auto &v : A) v = next();
+            for (auto &v : b) v = next();
+
+            const solver::MatrixView<const T> Av(A.data(), n);
+            const solver::Span<const T> bv(b);
+            auto r = kind == MatrixKind::General ? solver::general::solveCroutGeneral(Av, bv)
+                                                 : solver::symmetric::solveCroutSymmetric(Av, bv);
+            x = std::move(r.x);
+            stats = r.stats;
+        }
+
+        if (singular)
+            return withStats(head + "\"singular\"}", stats);
+        return withStats(okLine(head, codec, x, digits), stats);
+    } catch (const solver::ZeroPivot &e) {
+        // zerowy pivot w general / symmetric
+        return head + "\"singular\",\"message\":\"" + jsonEscape(e.what()) + "\"}";
+    } catch (const std::exception &e) {
+        return errorLine(head, e);
+    }
+}
+
+template <typename T>
+void solveAll(const std::vector<Problem> &problems, const Options &o, std::vector<std::string> &out)
+{
+    constexpr bool usesMpfr = std::is_same<T, mpreal>::value
+                              || std::is_same<T, IA::Interval<mpreal>>::value;
+    const mpfr_prec_t prec = mpreal::get_default_prec();
+    std::atomic<std::size_t> next{0};
+
+    auto worker = [&](std::size_t w) {
+        // domyślna precyzja MPFR jest lokalna dla wątku
+        mpreal::set_default_prec(prec);
+        utils::trace::setThreadName("worker " + std::to_string(w));
+        for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < problems.size();) {
+            utils::trace::Scope task("cli", "solve", int(i));
+            if constexpr (usesMpfr) {
+                utils::MpArenaScope arena;
+                out[i] = solveOne<T>(problems[i], i, o.kind, o.digits);
+            } else {
+                out[i] = solveOne<T>(problems[i], i, o.kind, o.digits);
+            }
+        }
+    };
+
+    const std::size_t hw = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t nt = std::min<std::size_t>(o.threads ? o.threads : hw, problems.size());
+    std::vector<std::thread> pool;
+    for (std::size_t k = 1; k < nt; ++k)
+        pool.emplace_back(worker, k);
+    worker(0);
+    for (auto &t : pool)
+        t.join();
+}
+
+
+// ------------------------- układ z plików .crm --------------------------
+
+// Typy o stałym rozmiarze idą do solverów jako widoki na mapowanie pliku;
+// typy MPFR i układy inne niż Dense (packed, pasmowy) są najpierw rozpakowane
+template <typename T>
+std::string solveBinaryAs(const utils::MatrixFile &A, const utils::MatrixFile &bf, const Options &o)
+{
+    const Codec<T> codec;
+    const int n = static_cast<int>(A.rows());
+    const std::string head = "{\"id\":0,\"source\":\"" + jsonEscape(o.binMatrix) + "\",\"n\":"
+                             + std::to_string(n) + ",\"status\":";
+    try {
+        if (o.outOfCore && A.layout() == utils::StorageLayout::Tridiagonal) {
+            // pasma, b i x tylko strumieniem – żaden wektor długości n w pamięci
+            if (o.binSolution.empty())
+                throw std::invalid_argument("Streaming tridiagonal solve needs --bin-solution.");
+            solver::outofcore::OutOfCoreOptions ooc;
+            ooc.memoryLimit = std::size_t(o.outOfCore) << 20;
+            ooc.tile = o.tile;
+            const auto r = solver::outofcore::solveTridiagonalStream<T>(A, bf, o.binSolution, ooc);
+            if (r.singular)
+                return withStats(head + "\"singular\"}", r.stats);
+            return withStats(head + "\"ok\",\"solution\":\"" + jsonEscape(o.binSolution) + "\"}", r.stats);
+        }
+
+        std::vector<T> bCopy;
+        solver::Span<const T> b;
+        if constexpr (utils::isMappable<T>()) {
+            b = bf.vector<T>();
+        } else {
+            bCopy = bf.toDense<T>();
+            b = bCopy;
+        }
+
+        std::vector<T> x;
+        bool singular = false;
+        utils::SolveStats stats;
+        if (A.layout() == utils::StorageLayout::Tridiagonal) {
+            utils::TridiagonalView<const T> t;
+            std::vector<T> copy;
+            if constexpr (utils::isMappable<T>()) {
+                t = A.tridiagonal<T>();
+            } else {
+                copy.reserve(3 * std::size_t(n) - 2);
+                for (std::uint64_t k = 0; k < A.header().elementCount; ++k)
+                    copy.push_back(A.get<T>(k));
+                const std::size_t m = n;
+                t = {{copy.data(), m - 1}, {copy.data() + (m - 1), m}, {copy.data() + (2 * m - 1), m - 1}};
+            }
+            auto r = solver::tridiagonal::solveCroutTridiagonal(t.a, t.d, t.c, b);
+            singular = tridiagonalSingular(codec, r.diag);
+            x = std::move(r.x);
+            stats = r.stats;
+        } else {
+            const MatrixKind kind = A.layout() == utils::StorageLayout::PackedSymmetric
+                                        ? MatrixKind::Symmetric : o.kind;
+            if (kind == MatrixKind::Tridiagonal)
+                throw std::invalid_argument("Tridiagonal solver needs a file in tridiagonal layout.");
+
+            if (o.outOfCore) {
+                // kafelki czytane wprost z mapowania, bez rozpakowania całości
+                solver::outofcore::OutOfCoreOptions ooc;
+                ooc.memoryLimit = std::size_t(o.outOfCore) << 20;
+                ooc.tile = o.tile;
+                auto r = kind == MatrixKind::General ? solver::outofcore::solveCroutGeneral(A, b, ooc)
+                                                     : solver::outofcore::solveCroutSymmetric(A, b, ooc);
+                return withStats(solvedLine(head, codec, r.x, singular, o), r.stats);
+            }
+
+            std::vector<T> copy;
+            solver::MatrixView<const T> Av;
+            if constexpr (utils::isMappable<T>()) {
+                if (A.layout() == utils::StorageLayout::Dense)
+                    Av = A.dense<T>();
+            }
+            if (!Av.data()) {
+                copy = A.toDense<T>();
+                Av = solver::MatrixView<const T>(copy.data(), n);
+            }
+            auto r = kind == MatrixKind::General ? solver::general::solveCroutGeneral(Av, b)
+                                                 : solver::symmetric::solveCroutSymmetric(Av, b);
+            x = std::move(r.x);
+            stats = r.stats;
+        }
+
+        return withStats(solvedLine(head, codec, x, singular, o), stats);
+    } catch (const solver::ZeroPivot &e) {
+        // zerowy pivot w general / symmetric
+        return head + "\"singular\",\"message\":\"" + jsonEscape(e.what()) + "\"}";
+    } catch (const std::exception &e) {
+        return errorLine(head, e);
+    }
+}
+
+std::string solveBinary(const Options &o)
+{
+    utils::MatrixFile A, b;
+    try {
+        A = utils::MatrixFile::open(o.binMatrix);
+        b = utils::MatrixFile::open(o.binRhs);
+    } catch (const std::exception &e) {
+        fail(e.what());
+    }
+    if (b.scalar() != A.scalar())
+        fail("matrix and right-hand side have different scalar types");
+    if (b.layout() != utils::StorageLayout::Dense || b.cols() != 1 || b.rows() != A.rows())
+        fail(o.binRhs + ": expected a Dense " + std::to_string(A.rows()) + "x1 vector");
+    if (A.rows() != A.cols())
+        fail(o.binMatrix + ": matrix must be square");
+    // bez -p liczymy w precyzji pliku
+    if (!o.precision && A.precision())
+        IA::Interval<mpreal>::SetPrecision(static_cast<IA::IAPrecision>(A.precision()));
+
+    switch (A.scalar()) {
+    case utils::ScalarType::Double:         return solveBinaryAs<double>(A, b, o);
+    case utils::ScalarType::DoubleDouble:   return solveBinaryAs<multidouble::DoubleDouble>(A, b, o);
+    case utils::ScalarType::QuadDouble:     return solveBinaryAs<multidouble::QuadDouble>(A, b, o);
+    case utils::ScalarType::Mpreal:         return solveBinaryAs<mpreal>(A, b, o);
+    case utils::ScalarType::IntervalMpreal: return solveBinaryAs<IA::Interval<mpreal>>(A, b, o);
+    case utils::ScalarType::IntervalDouble: return solveBinaryAs<IA::Interval<double>>(A, b, o);
+    case utils::ScalarType::Float128:
+#ifdef CROUT_HAVE_FLOAT128
+        return solveBinaryAs<__float128>(A, b, o);
+#endif
+        break;
+    }
+    fail(o.binMatrix + ": unsupported scalar type");
+}
+
+// ---------------------- układ z Matrix Market / CSV ----------------------
+
+// Błędy odczytu kończą program jak błędy wejścia; wyjątki solvera raportuje JSON
+template <typename T>
+std::string solveTextAs(const utils::TextMatrixReader &A, const utils::TextMatrixReader &bf,
+                        const Options &o)
+{
+    const Codec<T> codec;
+    const int n = A.rows();
+    std::vector<T> M, a, d, c, b;
+    try {
+        b = bf.readDense<T>();
+        if (o.kind == MatrixKind::Tridiagonal) {
+            a.resize(n - 1);
+            d.resize(n);
+            c.resize(n - 1);
+            A.readTridiagonal<T>(a, d, c);
+        } else {
+            M = A.readDense<T>();
+        }
+    } catch (const std::exception &e) {
+        fail(e.what());
+    }
+
+    const std::string head = "{\"id\":0,\"source\":\"" + jsonEscape(o.textMatrix) + "\",\"n\":"
+                             + std::to_string(n) + ",\"status\":";
+    try {
+        std::vector<T> x;
+        bool singular = false;
+        utils::SolveStats stats;
+        const solver::Span<const T> bv(b);
+        if (o.kind == MatrixKind::Tridiagonal) {
+            auto r = solver::tridiagonal::solveCroutTridiagonal(
+                solver::Span<const T>(a), solver::Span<const T>(d), solver::Span<const T>(c), bv);
+            singular = tridiagonalSingular(codec, r.diag);
+            x = std::move(r.x);
+            stats = r.stats;
+        } else {
+            const solver::MatrixView<const T> Av(M.data(), n);
+            auto r = o.kind == MatrixKind::General ? solver::general::solveCroutGeneral(Av, bv)
+                                                   : solver::symmetric::solveCroutSymmetric(Av, bv);
+            x = std::move(r.x);
+            stats = r.stats;
+        }
+        return withStats(solvedLine(head, codec, x, singular, o), stats);
+    } catch (const solver::ZeroPivot &e) {
+        // zerowy pivot w general / symmetric
+        return head + "\"singular\",\"message\":\"" + jsonEscape(e.what()) + "\"}";
+    } catch (const std::exception &e) {
+        return errorLine(head, e);
+    }
+}
+
+// Macierz tekstowa → .crm (Dense albo Tridiagonal przy -m tridiagonal). Typy
+// o stałym rozmiarze parsowane są prosto w zmapowany plik wynikowy.
+template <typename T>
+void convertTextAs(const utils::TextMatrixReader &A, const Options &o)
+{
+    const bool tri = o.kind == MatrixKind::Tridiagonal;
+    const auto layout = tri ? utils::StorageLayout::Tridiagonal : utils::StorageLayout::Dense;
+    try {
+        utils::MatrixFile f = utils::MatrixFile::create(
+            o.convert, utils::makeHeader(utils::ScalarTypeOf<T>::value, layout, A.rows(), A.cols()));
+        if constexpr (utils::isMappable<T>()) {
+            if (tri) {
+                const utils::TridiagonalView<T> t = f.tridiagonal<T>();
+                A.readTridiagonal<T>(t.a, t.d, t.c);
+            } else {
+                A.readDense<T>(f.dense<T>());
+            }
+        } else {
+            std::vector<T> v;
+            if (tri) {
+                const std::size_t n = A.rows();
+                v.resize(3 * n - 2);
+                A.readTridiagonal<T>({v.data(), n - 1}, {v.data() + (n - 1), n},
+                                     {v.data() + (2 * n - 1), n - 1});
+            } else {
+                v = A.readDense<T>();
+            }
+            for (std::size_t k = 0; k < v.size(); ++k)
+                f.set<T>(k, v[k]);
+        }
+        f.flush();
+    } catch (const std::exception &e) {
+        fail(e.what());
+    }
+}
+
+template <typename T>
+std::string runTextAs(const utils::TextMatrixReader &A, const utils::TextMatrixReader &b, const Options &o)
+{
+    if (!o.convert.empty()) {
+        convertTextAs<T>(A, o);
+        return {};
+    }
+    return solveTextAs<T>(A, b, o);
+}
+
+// Pusty wynik: tylko konwersja, bez linii JSON
+std::string solveText(const Options &o)
+{
+    utils::TextReadOptions ro;
+    ro.threads = o.threads;
+    utils::TextMatrixReader A, b;
+    try {
+        A = utils::TextMatrixReader::open(o.textMatrix, ro);
+        if (o.convert.empty())
+            b = utils::TextMatrixReader::open(o.textRhs, ro);
+    } catch (const std::exception &e) {
+        fail(e.what());
+    }
+    // konwersja gęstej macierzy dopuszcza dowolny kształt
+    if (A.rows() != A.cols() && (o.convert.empty() || o.kind != MatrixKind::General))
+        fail(o.textMatrix + ": matrix must be square");
+    if (o.convert.empty()
+        && ((b.rows() != 1 && b.cols() != 1) || std::uint64_t(b.rows()) * b.cols() != std::uint64_t(A.rows())))
+        fail(o.textRhs + ": expected a vector of length " + std::to_string(A.rows()));
+
+    switch (o.type) {
+    case DataType::Double:         return runTextAs<double>(A, b, o);
+    case DataType::DoubleDouble:   return runTextAs<multidouble::DoubleDouble>(A, b, o);
+    case DataType::QuadDouble:     return runTextAs<multidouble::QuadDouble>(A, b, o);
+    case DataType::Mpreal:         return runTextAs<mpreal>(A, b, o);
+    case DataType::Interval:       return runTextAs<IA::Interval<mpreal>>(A, b, o);
+    case DataType::IntervalDouble: return runTextAs<IA::Interval<double>>(A, b, o);
+    case DataType::Float128:
+#ifdef CROUT_HAVE_FLOAT128
+        return runTextAs<__float128>(A, b, o);
+#endif
+        break;
+    }
+    fail("unsupported scalar type");
+}
+
+int writeResults(const Options &o, const std::vector<std::string> &results)
+{
+    if (!o.trace.empty()) {
+        utils::trace::stop();
+        try {
+            utils::trace::writeChromeTrace(o.trace);
+        } catch (const std::exception &e) {
+            fail(e.what());
+        }
+        const utils::trace::Summary s = utils::trace::summary();
+        if (s.dropped)
+            std::cerr << "crout-cli: trace buffers full, " << s.dropped << " oldest events dropped\n";
+    }
+
+    std::ofstream file;
+    if (!o.output.empty()) {
+        file.open(o.output);
+        if (!file)
+            fail("cannot write '" + o.output + "'");
+    }
+    std::ostream &os = o.output.empty() ? std::cout : file;
+    for (const auto &line : results)
+        os << line << '\n';
+    os.flush();
+    return os && !anyError.load() ? 0 : 1;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    // arena GMP/MPFR – przed pierwszą alokacją mpreal (CROUT_MP_ARENA=0 → malloc)
+    utils::MpArena::install();
+    std::ios::sync_with_stdio(false);
+
+    const Options o = parseArgs(argc, argv);
+    if (!o.trace.empty()) {
+        utils::trace::start();
+        utils::trace::setThreadName("main");
+    }
+
+    IA::Interval<mpreal>::Initialize();
+    IA::Interval<mpreal>::SetMode(IA::DINT_MODE);
+    if (o.precision)
+        IA::Interval<mpreal>::SetPrecision(static_cast<IA::IAPrecision>(o.precision));
+
+    std::vector<std::string> results;
+    if (!o.binMatrix.empty()) {
+        results.push_back(solveBinary(o));
+        return writeResults(o, results);
+    }
+    if (!o.textMatrix.empty()) {
+        std::string line = solveText(o);
+        if (!line.empty())
+            results.push_back(std::move(line));
+        return writeResults(o, results);
+    }
+
+    // bufory żyją do końca – zadania trzymają wskaźniki na ich słowa
+    std::vector<std::string> buffers;
+    buffers.reserve(o.inputs.size());
+    std::vector<Problem> problems;
+    for (const auto &path : o.inputs) {
+        if (path == "-") {
+            buffers.push_back(slurp(std::cin));
+            readProblems(buffers.back(), "<stdin>", o.kind, problems);
+        } else {
+            std::ifstream f(path, std::ios::binary);
+            if (!f)
+                fail("cannot open '" + path + "'");
+            buffers.push_back(slurp(f));
+            readProblems(buffers.back(), path, o.kind, problems);
+        }
+    }
+
+    results.resize(problems.size());
+    switch (o.type) {
+    case DataType::Double:         solveAll<double>(problems, o, results); break;
+    case DataType::DoubleDouble:   solveAll<multidouble::DoubleDouble>(problems, o, results); break;
+    case DataType::QuadDouble:     solveAll<multidouble::QuadDouble>(problems, o, results); break;
+    case DataType::Mpreal:         solveAll<mpreal>(problems, o, results); break;
+    case DataType::Interval:       solveAll<IA::Interval<mpreal>>(problems, o, results); break;
+    case DataType::IntervalDouble: solveAll<IA::Interval<double>>(problems, o, results); break;
+    case DataType::Float128:
+#ifdef CROUT_HAVE_FLOAT128
+        solveAll<__float128>(problems, o, results);
+#endif
+        break;
+    }
+    return writeResults(o, results);
+}
@@ -0,0 +1,116 @@
+#ifndef CROUT_QT_HPP
+#define CROUT_QT_HPP
+
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <QList>
+#include <QVector>
+
+#include "solver/crout_types.h"
+#include "solver/general/crout_general_double.h"
+#include "solver/general/crout_general_mpreal.h"
+#include "solver/general/crout_general_interval.h"
+#include "solver/general/crout_general_fixedmp.h"
+#include "solver/general/crout_general_multidouble.h"
+#include "solver/general/crout_general_float128.h"
+#include "solver/symmetric/crout_symmetric_double.h"
+#include "solver/symmetric/crout_symmetric_mpreal.h"
+#include "solver/symmetric/crout_symmetric_interval.h"
+#include "solver/symmetric/crout_symmetric_fixedmp.h"
+#include "solver/symmetric/crout_symmetric_multidouble.h"
+#include "solver/symmetric/crout_symmetric_float128.h"
+#include "solver/tridiagonal/crout_tridiagonal_double.h"
+#include "solver/tridiagonal/crout_tridiagonal_mpreal.h"
+#include "solver/tridiagonal/crout_tridiagonal_interval.h"
+#include "solver/tridiagonal/crout_tridiagonal_fixedmp.h"
+#include "solver/tridiagonal/crout_tridiagonal_multidouble.h"
+#include "solver/tridiagonal/crout_tridiagonal_float128.h"
+
+/**
+ * Warstwa Qt nad biblioteką croutsolver: GUI trzyma dane w QVector<QVector<T>>,
+ * a biblioteka przyjmuje widoki (MatrixView, Span) i zwraca płaskie wyniki.
+ * Tu jest jedyne kopiowanie między tymi postaciami.
+ */
+namespace solver {
+namespace qt {
+
+namespace detail {
+
+// QVector<QVector<T>> (n×n) → macierz wierszami
+template <typename T>
+std::vector<T> flatten(const QVector<QVector<T>> &A)
+{
+    const int n = A.size();
+    std::vector<T> flat;
+    flat.reserve(std::size_t(n) * n);
+    for (const auto &row : A) {
+        if (row.size() != n)
+            throw std::invalid_argument("Matrix must be square.");
+        flat.insert(flat.end(), row.begin(), row.end());
+    }
+    return flat;
+}
+
+template <typename T>
+QVector<QVector<T>> nest(const std::vector<T> &flat, int n)
+{
+    QVector<QVector<T>> M(n);
+    for (int i = 0; i < n; ++i)
+        M[i] = QVector<T>(flat.begin() + std::ptrdiff_t(i) * n,
+                          flat.begin() + std::ptrdiff_t(i + 1) * n);
+    return M;
+}
+
+template <typename T>
+QVector<T> toQVector(const std::vector<T> &v)
+{
+    return QVector<T>(v.begin(), v.end());
+}
+
+template <typename T>
+std::tuple<QVector<QVector<T>>, QVector<QVector<T>>, QVector<T>, QVector<T>>
+toTuple(const CroutResult<T> &r)
+{
+    return {nest(r.L, r.n), nest(r.U, r.n), toQVector(r.y), toQVector(r.x)};
+}
+
+} // namespace detail
+
+// Zwraca (L, U, y, x)
+template <typename T>
+std::tuple<QVector<QVector<T>>, QVector<QVector<T>>, QVector<T>, QVector<T>>
+solveCroutGeneral(const QVector<QVector<T>> &A, const QVector<T> &b)
+{
+    const auto flat = detail::flatten(A);
+    return detail::toTuple(general::solveCroutGeneral(
+        MatrixView<const T>(flat.data(), A.size()), Span<const T>(b.data(), b.size())));
+}
+
+// Zwraca (L, U = D·Lᵀ, y, x)
+template <typename T>
+std::tuple<QVector<QVector<T>>, QVector<QVector<T>>, QVector<T>, QVector<T>>
+solveCroutSymmetric(const QVector<QVector<T>> &A, const QVector<T> &b)
+{
+    const auto flat = detail::flatten(A);
+    return detail::toTuple(symmetric::solveCroutSymmetric(
+        MatrixView<const T>(flat.data(), A.size()), Span<const T>(b.data(), b.size())));
+}
+
+// Zwraca (L, D, U, y, x) – pod-przekątna L, przekątna i nad-przekątna U
+template <typename T>
+std::tuple<QList<T>, QList<T>, QList<T>, QList<T>, QList<T>>
+solveCroutTridiagonal(const QVector<T> &a, const QVector<T> &d,
+                      const QVector<T> &c, const QVector<T> &rhs)
+{
+    const auto r = tridiagonal::solveCroutTridiagonal(
+        Span<const T>(a.data(), a.size()), Span<const T>(d.data(), d.size()),
+        Span<const T>(c.data(), c.size()), Span<const T>(rhs.data(), rhs.size()));
+    return {detail::toQVector(r.l), detail::toQVector(r.diag), detail::toQVector(r.up),
+            detail::toQVector(r.y), detail::toQVector(r.x)};
+}
+
+} // namespace qt
+} // namespace solver
+
+#endif // CROUT_QT_HPP
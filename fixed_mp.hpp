@@ -0,0 +1,108 @@
+#ifndef FIXED_MP_HPP
+#define FIXED_MP_HPP
+
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <gmp.h>
+#include <mpfr.h>
+#include "mpreal.h"
+
+namespace fixedmp {
+
+/**
+ * Liczba MPFR o stałej precyzji Bits z limbami trzymanymi w obiekcie
+ * (mpfr_custom_init_set) – bez alokacji na stercie, bez mpfr_init/clear.
+ * Wszystkie argumenty mają tę samą precyzję, więc mpfr_add/mul/div wchodzą
+ * w szybkie ścieżki dla jednakowej precyzji (mpfr_add1sp, mpfr_mul_2 itd.).
+ *
+ * Zaokrąglenie zawsze MPFR_RNDN. Obiekt wskazuje sam na siebie (nagłówek →
+ * limby), dlatego kopiowanie przepina wskaźnik; nie wolno go przenosić
+ * memcpy (nie deklarujemy go jako Q_RELOCATABLE_TYPE).
+ */
+template<int Bits>
+class FixedMp {
+    static_assert(Bits >= MPFR_PREC_MIN, "precyzja poniżej MPFR_PREC_MIN");
+
+public:
+    static constexpr int bits = Bits;
+    static constexpr int limbCount = (Bits + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+    static constexpr mpfr_rnd_t rnd = MPFR_RNDN;
+
+    FixedMp() { init(); }
+    FixedMp(double d) { init(); mpfr_set_d(&h_, d, rnd); }
+    FixedMp(int v) { init(); mpfr_set_si(&h_, v, rnd); }
+    FixedMp(long v) { init(); mpfr_set_si(&h_, v, rnd); }
+    explicit FixedMp(const mpfr::mpreal &v) { init(); mpfr_set(&h_, v.mpfr_srcptr(), rnd); }
+    explicit FixedMp(const char *s, int base = 10) { init(); mpfr_set_str(&h_, s, base, rnd); }
+
+    FixedMp(const FixedMp &o) { copyFrom(o); }
+    FixedMp &operator=(const FixedMp &o) { if (this != &o) copyFrom(o); return *this; }
+
+    ::mpfr_ptr mpfr_ptr() { return &h_; }
+    ::mpfr_srcptr mpfr_srcptr() const { return &h_; }
+
+    double toDouble() const { return mpfr_get_d(&h_, rnd); }
+    mpfr::mpreal toMpreal() const { return mpfr::mpreal(&h_); }
+    std::string toString(const std::string &format = "%.30Re") const {
+        return toMpreal().toString(format);
+    }
+
+    FixedMp &operator+=(const FixedMp &o) { mpfr_add(&h_, &h_, &o.h_, rnd); return *this; }
+    FixedMp &operator-=(const FixedMp &o) { mpfr_sub(&h_, &h_, &o.h_, rnd); return *this; }
+    FixedMp &operator*=(const FixedMp &o) { mpfr_mul(&h_, &h_, &o.h_, rnd); return *this; }
+    FixedMp &operator/=(const FixedMp &o) { mpfr_div(&h_, &h_, &o.h_, rnd); return *this; }
+
+    FixedMp operator-() const { FixedMp r; mpfr_neg(&r.h_, &h_, rnd); return r; }
+
+    friend FixedMp operator+(const FixedMp &a, const FixedMp &b) { FixedMp r; mpfr_add(&r.h_, &a.h_, &b.h_, rnd); return r; }
+    friend FixedMp operator-(const FixedMp &a, const FixedMp &b) { FixedMp r; mpfr_sub(&r.h_, &a.h_, &b.h_, rnd); return r; }
+    friend FixedMp operator*(const FixedMp &a, const FixedMp &b) { FixedMp r; mpfr_mul(&r.h_, &a.h_, &b.h_, rnd); return r; }
+    friend FixedMp operator/(const FixedMp &a, const FixedMp &b) { FixedMp r; mpfr_div(&r.h_, &a.h_, &b.h_, rnd); return r; }
+
+    friend bool operator==(const FixedMp &a, const FixedMp &b) { return mpfr_equal_p(&a.h_, &b.h_); }
+    friend bool operator!=(const FixedMp &a, const FixedMp &b) { return !mpfr_equal_p(&a.h_, &b.h_); }
+    friend bool operator<(const FixedMp &a, const FixedMp &b) { return mpfr_less_p(&a.h_, &b.h_); }
+    friend bool operator>(const FixedMp &a, const FixedMp &b) { return mpfr_greater_p(&a.h_, &b.h_); }
+    friend bool operator<=(const FixedMp &a, const FixedMp &b) { return mpfr_lessequal_p(&a.h_, &b.h_); }
+    friend bool operator>=(const FixedMp &a, const FixedMp &b) { return mpfr_greaterequal_p(&a.h_, &b.h_); }
+
+    friend FixedMp abs(const FixedMp &a) { FixedMp r; mpfr_abs(&r.h_, &a.h_, rnd); return r; }
+    friend FixedMp sqrt(const FixedMp &a) { FixedMp r; mpfr_sqrt(&r.h_, &a.h_, rnd); return r; }
+
+    bool isZero() const { return mpfr_zero_p(&h_); }
+    bool isNan() const { return mpfr_nan_p(&h_); }
+    void setNan() { mpfr_set_nan(&h_); }
+    void setZero() { mpfr_set_zero(&h_, 1); }
+
+    // this += a·b z jednym zaokrągleniem
+    void addMul(const FixedMp &a, const FixedMp &b) { mpfr_fma(&h_, &a.h_, &b.h_, &h_, rnd); }
+
+    friend std::ostream &operator<<(std::ostream &os, const FixedMp &v) {
+        return os << v.toMpreal();
+    }
+
+private:
+    void init() {
+        mpfr_custom_init(limbs_, Bits);
+        mpfr_custom_init_set(&h_, MPFR_ZERO_KIND, 0, Bits, limbs_);
+    }
+
+    // Ta sama precyzja: kopiujemy nagłówek i limby, wskaźnik na własne limby
+    void copyFrom(const FixedMp &o) {
+        h_ = o.h_;
+        h_._mpfr_d = limbs_;
+        std::memcpy(limbs_, o.limbs_, sizeof(limbs_));
+    }
+
+    __mpfr_struct h_;
+    mp_limb_t limbs_[limbCount];
+};
+
+using FixedMp128 = FixedMp<128>;
+using FixedMp192 = FixedMp<192>;
+using FixedMp256 = FixedMp<256>;
+
+} // namespace fixedmp
+
+#endif // FIXED_MP_HPP
@@ -0,0 +1,52 @@
+#ifndef FLOAT128_HPP
+#define FLOAT128_HPP
+
+// Poczwórna precyzja IEEE (113 bitów mantysy) przez __float128 GCC i libquadmath.
+// Na x86-64 działania są programowe (libgcc soft-fp), ale respektują tryb
+// zaokrąglania ustawiony fesetround – więc działają też w Interval<__float128>.
+#if defined(__SIZEOF_FLOAT128__) && !defined(CROUT_NO_FLOAT128)
+#define CROUT_HAVE_FLOAT128 1
+
+#include <string>
+#include <vector>
+#include <quadmath.h>
+
+namespace float128 {
+
+using float128_t = __float128;
+
+// Parsowanie jak strtod; false, gdy tekst nie jest w całości liczbą
+inline bool parse(const std::string &s, float128_t &out)
+{
+    char *end = nullptr;
+    out = strtoflt128(s.c_str(), &end);
+    while (end && (*end == ' ' || *end == '\t'))
+        ++end;
+    return end && end != s.c_str() && *end == '\0';
+}
+
+inline float128_t parse(const std::string &s)
+{
+    return strtoflt128(s.c_str(), nullptr);
+}
+
+// Zapis naukowy z `digits` cyframi po przecinku (33 ≈ pełna precyzja)
+inline std::string toString(float128_t v, int digits = 33)
+{
+    // długość z przebiegu próbnego – przy dużym digits wykładnik się nie urywa
+    const int len = quadmath_snprintf(nullptr, 0, "%.*Qe", digits, v);
+    std::vector<char> buf(std::size_t(len > 0 ? len : 0) + 1);
+    quadmath_snprintf(buf.data(), buf.size(), "%.*Qe", digits, v);
+    return buf.data();
+}
+
+inline bool isFinite(float128_t v)
+{
+    return finiteq(v);
+}
+
+} // namespace float128
+
+#endif // __SIZEOF_FLOAT128__
+
+#endif // FLOAT128_HPP
@@ -15,6 +15,7 @@
  #include <fenv.h>
  #include <stdlib.h>
  #include <stdint.h>
+ #include <utility>
  #include <cmath>
  #include <mpfr.h>
  #include <boost/lexical_cast.hpp>
@@ -23,8 +24,10 @@
  #include <fstream>
  #include <float.h>
  #include <typeinfo>
+ #include <type_traits>
  #include <mpfr.h>
  #include <mpreal.h>
+ #include "utils/instrumentation.h"
  
  using namespace std;
  using namespace mpfr;
@@ -94,10 +97,14 @@
      T a;
      T b;
      Interval();
-     Interval(Interval const &copy);
+     Interval(Interval const &copy) = default;
+     Interval(Interval &&) = default;
      Interval(T a, T b);
-     virtual ~Interval();
-     Interval& operator=(const Interval<T> i);
+     // Bez wirtualnego destruktora: dla typów arytmetycznych Interval<T> jest
+     // trywialnie kopiowalny (dwa pola a, b, bez wskaźnika vtable).
+     ~Interval() = default;
+     Interval& operator=(const Interval<T> &i) = default;
+     Interval& operator=(Interval<T> &&i) = default;
      Interval operator+(const Interval<T> &i);
      Interval operator-(const Interval<T> &i);
      Interval operator*(const Interval<T> &i);
@@ -153,9 +160,12 @@
      friend int SetRounding<T>(int rounding);
  };
  
- template<typename T>
- inline Interval<T>::~Interval() {
- }
+ // Przedziały o końcach typu wbudowanego można kopiować memcpy i trzymać
+ // w tablicach SoA (zob. interval_array.hpp).
+ static_assert(std::is_trivially_copyable<Interval<double>>::value,
+         "Interval<double> must stay trivially copyable");
+ static_assert(sizeof(Interval<double>) == 2 * sizeof(double),
+         "Interval<double> must not carry hidden members");
  
  template<typename T>
  Interval<T>::Interval() {
@@ -163,12 +173,6 @@
      this->b = 0;
  }
  
- template<typename T>
- Interval<T>::Interval(Interval const &copy) {
-     this->a = copy.a;
-     this->b = copy.b;
- }
- 
  template<typename T>
  inline Interval<T>::Interval(T a, T b) {
      this->a = a;
@@ -192,19 +196,52 @@
  //	return rounding;
  //}
  
+ // Zmiana trybu zaokrąglania dla liczników solverów (utils/instrumentation.h);
+ // bez CROUT_INSTRUMENTATION pusta
+ inline void CountRoundingSwitch() {
+     utils::instrument::add(&utils::SolveStats::roundingSwitches);
+ }
+
  template<typename T>
  int SetRounding(int rounding) {
+     CountRoundingSwitch();
      fesetround(rounding);
      return rounding;
  }
- 
+
+ // Bariera kolejności dla typów wbudowanych: GCC (także z -frounding-math)
+ // potrafi przenieść działanie zmiennoprzecinkowe przez wywołanie fesetround
+ // albo połączyć x*y policzone w dwóch trybach w jedno (PR 34678). Odczyt
+ // i zapis przez volatile wymusza wykonanie działania w bieżącym trybie.
+ // Dla mpreal tryb jest częścią stanu biblioteki, więc bariera nic nie robi.
  template<typename T>
- inline Interval<T>& Interval<T>::operator =(Interval<T> i) {
-     std::swap(this->a, i.a);
-     std::swap(this->b, i.b);
-     return *this;
+ inline T &&RoundingBarrier(T &&v) {
+     return std::forward<T>(v);
  }
  
+ inline float RoundingBarrier(float v) {
+     volatile float t = v;
+     return t;
+ }
+ 
+ inline double RoundingBarrier(double v) {
+     volatile double t = v;
+     return t;
+ }
+ 
+ inline long double RoundingBarrier(long double v) {
+     volatile long double t = v;
+     return t;
+ }
+
+ #ifdef __SIZEOF_FLOAT128__
+ // __float128: działania to wywołania soft-fp, które GCC też uważa za czyste
+ inline __float128 RoundingBarrier(__float128 v) {
+     volatile __float128 t = v;
+     return t;
+ }
+ #endif
+
  template<typename T>
  inline void Interval<T>::SetPrecision(IAPrecision p) {
      mpreal::set_default_prec(p);
@@ -759,9 +796,9 @@
  Interval<T> IAdd(const Interval<T> &x, const Interval<T> &y) {
      Interval<T> r;
      SetRounding<T>(FE_DOWNWARD);
-     r.a = x.a + y.a;
+     r.a = RoundingBarrier(RoundingBarrier(x.a) + y.a);
      SetRounding<T>(FE_UPWARD);
-     r.b = x.b + y.b;
+     r.b = RoundingBarrier(RoundingBarrier(x.b) + y.b);
      SetRounding<T>(FE_TONEAREST);
      return r;
  }
@@ -770,9 +807,9 @@
  Interval<T> ISub(const Interval<T> &x, const Interval<T> &y) {
      Interval<T> r;
      SetRounding<T>(FE_DOWNWARD);
-     r.a = x.a - y.b;
+     r.a = RoundingBarrier(RoundingBarrier(x.a) - y.b);
      SetRounding<T>(FE_UPWARD);
-     r.b = x.b - y.a;
+     r.b = RoundingBarrier(RoundingBarrier(x.b) - y.a);
      SetRounding<T>(FE_TONEAREST);
      return r;
  }
@@ -783,10 +820,10 @@
      T x1y1, x1y2, x2y1;
  
      SetRounding<T>(FE_DOWNWARD);
-     x1y1 = x.a * y.a;
-     x1y2 = x.a * y.b;
-     x2y1 = x.b * y.a;
-     r.a = x.b * y.b;
+     x1y1 = RoundingBarrier(RoundingBarrier(x.a) * y.a);
+     x1y2 = RoundingBarrier(RoundingBarrier(x.a) * y.b);
+     x2y1 = RoundingBarrier(RoundingBarrier(x.b) * y.a);
+     r.a = RoundingBarrier(RoundingBarrier(x.b) * y.b);
      if (x2y1 < r.a)
          r.a = x2y1;
      if (x1y2 < r.a)
@@ -795,11 +832,11 @@
          r.a = x1y1;
  
      SetRounding<T>(FE_UPWARD);
-     x1y1 = x.a * y.a;
-     x1y2 = x.a * y.b;
-     x2y1 = x.b * y.a;
+     x1y1 = RoundingBarrier(RoundingBarrier(x.a) * y.a);
+     x1y2 = RoundingBarrier(RoundingBarrier(x.a) * y.b);
+     x2y1 = RoundingBarrier(RoundingBarrier(x.b) * y.a);
  
-     r.b = x.b * y.b;
+     r.b = RoundingBarrier(RoundingBarrier(x.b) * y.b);
      if (x2y1 > r.b)
          r.b = x2y1;
      if (x1y2 > r.b)
@@ -813,36 +850,34 @@
  template<typename T>
  Interval<T> IDiv(const Interval<T> &x, const Interval<T> &y) {
      Interval<T> r;
-     T x1y1, x1y2, x2y1, t;
+     T x1y1, x1y2, x2y1;
  
      if ((y.a <= 0) && (y.b >= 0)) {
          throw runtime_error("Division by an interval containing 0.");
      } else {
          SetRounding<T>(FE_DOWNWARD);
-         x1y1 = x.a / y.a;
-         x1y2 = x.a / y.b;
-         x2y1 = x.b / y.a;
-         r.a = x.b / y.b;
-         t = r.a;
-         if (x2y1 < t)
+         x1y1 = RoundingBarrier(RoundingBarrier(x.a) / y.a);
+         x1y2 = RoundingBarrier(RoundingBarrier(x.a) / y.b);
+         x2y1 = RoundingBarrier(RoundingBarrier(x.b) / y.a);
+         r.a = RoundingBarrier(RoundingBarrier(x.b) / y.b);
+         if (x2y1 < r.a)
              r.a = x2y1;
-         if (x1y2 < t)
+         if (x1y2 < r.a)
              r.a = x1y2;
-         if (x1y1 < t)
+         if (x1y1 < r.a)
              r.a = x1y1;
  
          SetRounding<T>(FE_UPWARD);
-         x1y1 = x.a / y.a;
-         x1y2 = x.a / y.b;
-         x2y1 = x.b / y.a;
+         x1y1 = RoundingBarrier(RoundingBarrier(x.a) / y.a);
+         x1y2 = RoundingBarrier(RoundingBarrier(x.a) / y.b);
+         x2y1 = RoundingBarrier(RoundingBarrier(x.b) / y.a);
  
-         r.b = x.b / y.b;
-         t = r.b;
-         if (x2y1 > t)
+         r.b = RoundingBarrier(RoundingBarrier(x.b) / y.b);
+         if (x2y1 > r.b)
              r.b = x2y1;
-         if (x1y2 > t)
+         if (x1y2 > r.b)
              r.b = x1y2;
-         if (x1y1 > t)
+         if (x1y1 > r.b)
              r.b = x1y1;
  
      }
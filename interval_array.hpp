@@ -0,0 +1,188 @@
+#ifndef INTERVAL_ARRAY_HPP
+#define INTERVAL_ARRAY_HPP
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include "interval.hpp"
+#include "interval_rounding_fix.hpp"
+
+namespace interval_arithmetic {
+
+// Alokator wyrównujący bufor do linii pamięci podręcznej (i szerokości AVX-512).
+template <typename T, std::size_t Align = 64>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Align>;
+    };
+
+    AlignedAllocator() noexcept = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Align> &) noexcept {}
+
+    T *allocate(std::size_t n) {
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+    }
+    void deallocate(T *p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Align));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Align> &) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Align> &) const noexcept { return false; }
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+/**
+ * Wektor przedziałów w układzie SoA: osobne, ciągłe tablice lewych (lo)
+ * i prawych (hi) końców. Element i to przedział [lo[i]; hi[i]].
+ */
+template <typename T>
+class IntervalVector {
+public:
+    IntervalVector() = default;
+    explicit IntervalVector(int n) : lo_(n, T(0)), hi_(n, T(0)) {}
+
+    int size() const { return static_cast<int>(lo_.size()); }
+
+    Interval<T> get(int i) const { return Interval<T>(lo_[i], hi_[i]); }
+    void set(int i, const Interval<T> &v) {
+        lo_[i] = v.a;
+        hi_[i] = v.b;
+    }
+
+    T *lo() { return lo_.data(); }
+    T *hi() { return hi_.data(); }
+    const T *lo() const { return lo_.data(); }
+    const T *hi() const { return hi_.data(); }
+
+private:
+    AlignedVector<T> lo_;
+    AlignedVector<T> hi_;
+};
+
+/**
+ * Macierz przedziałów rows×cols w układzie SoA, wierszami (row-major).
+ * Wiersz i zajmuje ciągły fragment obu tablic, więc iloczyny skalarne
+ * wierszy przechodzą po pamięci liniowo.
+ */
+template <typename T>
+class IntervalMatrix {
+public:
+    IntervalMatrix() = default;
+    IntervalMatrix(int rows, int cols)
+        : rows_(rows), cols_(cols),
+          lo_(static_cast<std::size_t>(rows) * cols, T(0)),
+          hi_(static_cast<std::size_t>(rows) * cols, T(0)) {}
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+
+    Interval<T> get(int i, int j) const {
+        const std::size_t k = index(i, j);
+        return Interval<T>(lo_[k], hi_[k]);
+    }
+    void set(int i, int j, const Interval<T> &v) {
+        const std::size_t k = index(i, j);
+        lo_[k] = v.a;
+        hi_[k] = v.b;
+    }
+
+    T *loRow(int i) { return lo_.data() + index(i, 0); }
+    T *hiRow(int i) { return hi_.data() + index(i, 0); }
+    const T *loRow(int i) const { return lo_.data() + index(i, 0); }
+    const T *hiRow(int i) const { return hi_.data() + index(i, 0); }
+
+private:
+    std::size_t index(int i, int j) const {
+        return static_cast<std::size_t>(i) * cols_ + j;
+    }
+
+    int rows_ = 0;
+    int cols_ = 0;
+    AlignedVector<T> lo_;
+    AlignedVector<T> hi_;
+};
+
+/**
+ * Σ_{k<n} x_k·y_k dla przedziałów właściwych w układzie SoA.
+ * Daje ten sam wynik co pętla sum = IAdd(sum, IMul(x_k, y_k)), ale tryb
+ * zaokrąglania przełączany jest raz na cały iloczyn skalarny zamiast
+ * sześć razy na składnik, i nie powstają tymczasowe obiekty Interval.
+ */
+template <typename T>
+Interval<T> IDot(const T *xa, const T *xb, const T *ya, const T *yb, int n) {
+    Interval<T> r(0, 0);
+    if (n <= 0)
+        return r;
+
+    // bariery jak w IAdd/IMul: te same iloczyny liczone są w dwóch trybach
+    T p, q;
+    SetRounding<T>(FE_DOWNWARD);
+    for (int k = 0; k < n; ++k) {
+        p = RoundingBarrier(RoundingBarrier(xa[k]) * ya[k]);
+        q = RoundingBarrier(RoundingBarrier(xa[k]) * yb[k]);
+        if (q < p)
+            p = q;
+        q = RoundingBarrier(RoundingBarrier(xb[k]) * ya[k]);
+        if (q < p)
+            p = q;
+        q = RoundingBarrier(RoundingBarrier(xb[k]) * yb[k]);
+        if (q < p)
+            p = q;
+        r.a = RoundingBarrier(RoundingBarrier(r.a) + p);
+    }
+
+    SetRounding<T>(FE_UPWARD);
+    for (int k = 0; k < n; ++k) {
+        p = RoundingBarrier(RoundingBarrier(xa[k]) * ya[k]);
+        q = RoundingBarrier(RoundingBarrier(xa[k]) * yb[k]);
+        if (q > p)
+            p = q;
+        q = RoundingBarrier(RoundingBarrier(xb[k]) * ya[k]);
+        if (q > p)
+            p = q;
+        q = RoundingBarrier(RoundingBarrier(xb[k]) * yb[k]);
+        if (q > p)
+            p = q;
+        r.b = RoundingBarrier(RoundingBarrier(r.b) + p);
+    }
+    SetRounding<T>(FE_TONEAREST);
+    return r;
+}
+
+/**
+ * Aktualizacja dopełnienia Schura S -= X·Yᵀ na blokach SoA:
+ * S(i, j) -= Σ_{p<k} X(i, p)·Y(j, p) dla i < m, j < n. Wskaźniki wskazują
+ * lewy górny róg bloku, ld* to kroki wierszy. Wersja ogólna liczy każdy
+ * element jednym IDot; dla double jest przeciążenie w interval_midrad.hpp.
+ */
+template <typename T>
+void ISubMatMulNT(int m, int n, int k,
+                  const T *xlo, const T *xhi, int ldx,
+                  const T *ylo, const T *yhi, int ldy,
+                  T *slo, T *shi, int lds)
+{
+    for (int i = 0; i < m; ++i) {
+        const std::size_t xi = static_cast<std::size_t>(i) * ldx;
+        const std::size_t si = static_cast<std::size_t>(i) * lds;
+        for (int j = 0; j < n; ++j) {
+            const std::size_t yj = static_cast<std::size_t>(j) * ldy;
+            Interval<T> sum = IDot(xlo + xi, xhi + xi, ylo + yj, yhi + yj, k);
+            Interval<T> v = ISub(Interval<T>(slo[si + j], shi[si + j]), sum);
+            slo[si + j] = v.a;
+            shi[si + j] = v.b;
+        }
+    }
+}
+
+} // namespace interval_arithmetic
+
+#endif // INTERVAL_ARRAY_HPP
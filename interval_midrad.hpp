@@ -0,0 +1,511 @@
+#ifndef INTERVAL_MIDRAD_HPP
+#define INTERVAL_MIDRAD_HPP
+
+// Iloczyny macierzy przedziałowych w reprezentacji środek–promień (mid/rad)
+// wg S.M. Rump, "Fast and parallel interval arithmetic", BIT 39 (1999).
+//
+// Przedział <m, r> = [m - r; m + r]. Dla A = <mA, rA>, B = <mB, rB>:
+//   c1 = ↓(mA·mB),  c2 = ↑(mA·mB)
+//   mC = ↑(c1 + (c2 - c1)/2)
+//   rC = ↑((mC - c1) + |mA|·rB + rA·(|mB| + rB))
+// czyli trzy zwykłe iloczyny macierzy double (dwa dla środka, jeden dla
+// promienia – |mA|·rB + rA·(|mB|+rB) liczone jako [|mA| rA]·[rB; |mB|+rB]).
+// Wynik zawiera dokładny iloczyn przedziałowy; przeszacowanie promienia
+// jest ograniczone przez czynnik 1.5.
+//
+// Tylko końce double; tryb zaokrąglania przełączany jest raz na cały
+// iloczyn (wymaga -frounding-math, tak jak interval_simd.hpp).
+
+#include <algorithm>
+#include <cfenv>
+#include <cmath>
+#include <stdexcept>
+
+#include "interval.hpp"
+#include "interval_array.hpp"
+#include "interval_simd.hpp"
+
+namespace interval_arithmetic {
+namespace midrad {
+
+/**
+ * Macierz przedziałów rows×cols w reprezentacji środek–promień, wierszami.
+ */
+class MidRadMatrix {
+public:
+    MidRadMatrix() = default;
+    MidRadMatrix(int rows, int cols)
+        : rows_(rows), cols_(cols),
+          mid_(static_cast<std::size_t>(rows) * cols, 0.0),
+          rad_(static_cast<std::size_t>(rows) * cols, 0.0) {}
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+
+    double *mid() { return mid_.data(); }
+    double *rad() { return rad_.data(); }
+    const double *mid() const { return mid_.data(); }
+    const double *rad() const { return rad_.data(); }
+
+private:
+    int rows_ = 0;
+    int cols_ = 0;
+    AlignedVector<double> mid_;
+    AlignedVector<double> rad_;
+};
+
+namespace detail {
+
+// Zmienia tryb zaokrąglania na czas życia obiektu.
+class RoundingScope {
+public:
+    explicit RoundingScope(int mode) : saved_(std::fegetround()) { set(mode); }
+    ~RoundingScope() { set(saved_); }
+    void set(int mode) {
+        CountRoundingSwitch();
+        std::fesetround(mode);
+    }
+    RoundingScope(const RoundingScope &) = delete;
+    RoundingScope &operator=(const RoundingScope &) = delete;
+
+private:
+    int saved_;
+};
+
+// C(m×n) += A(m×k)·B(k×n) w bieżącym trybie zaokrąglania, wersja skalarna.
+inline void gemmScalar(int m, int n, int k,
+                       const double *A, int lda,
+                       const double *B, int ldb,
+                       double *C, int ldc)
+{
+    for (int i = 0; i < m; ++i) {
+        double *c = C + static_cast<std::size_t>(i) * ldc;
+        const double *a = A + static_cast<std::size_t>(i) * lda;
+        for (int p = 0; p < k; ++p) {
+            const double aip = a[p];
+            const double *b = B + static_cast<std::size_t>(p) * ldb;
+            for (int j = 0; j < n; ++j)
+                c[j] += aip * b[j];
+        }
+    }
+}
+
+#ifdef INTERVAL_SIMD_X86
+
+// Kafelki 4×NR (i 1×NR na resztę wierszy): elementy A rozgłaszane na
+// wektory wiersza B, akumulatory w rejestrach przez całą pętlę po p.
+
+#define IMR_AVX2 __attribute__((target("avx2,fma")))
+
+// AVX2: tryb zaokrąglania z MXCSR (ustawia wywołujący), 4×8
+IMR_AVX2 inline __m256i tailMask256(int cnt)
+{
+    const __m256i idx = _mm256_set_epi64x(3, 2, 1, 0);
+    return _mm256_cmpgt_epi64(_mm256_set1_epi64x(cnt), idx);
+}
+
+// Akumulatory jako osobne zmienne (tablica wylądowałaby na stosie).
+IMR_AVX2 inline void tileAvx2x4(int k, int nc,
+                                const double *A, int lda,
+                                const double *B, int ldb,
+                                double *C, int ldc)
+{
+    const __m256i m0 = tailMask256(nc), m1 = tailMask256(nc - 4);
+    const double *a0 = A, *a1 = A + lda, *a2 = A + 2 * static_cast<std::size_t>(lda),
+                 *a3 = A + 3 * static_cast<std::size_t>(lda);
+    double *c0 = C, *c1 = C + ldc, *c2 = C + 2 * static_cast<std::size_t>(ldc),
+           *c3 = C + 3 * static_cast<std::size_t>(ldc);
+    __m256d s00 = _mm256_maskload_pd(c0, m0), s01 = _mm256_maskload_pd(c0 + 4, m1);
+    __m256d s10 = _mm256_maskload_pd(c1, m0), s11 = _mm256_maskload_pd(c1 + 4, m1);
+    __m256d s20 = _mm256_maskload_pd(c2, m0), s21 = _mm256_maskload_pd(c2 + 4, m1);
+    __m256d s30 = _mm256_maskload_pd(c3, m0), s31 = _mm256_maskload_pd(c3 + 4, m1);
+    for (int p = 0; p < k; ++p) {
+        const double *b = B + static_cast<std::size_t>(p) * ldb;
+        const __m256d b0 = _mm256_maskload_pd(b, m0), b1 = _mm256_maskload_pd(b + 4, m1);
+        __m256d x = _mm256_broadcast_sd(a0 + p);
+        s00 = _mm256_fmadd_pd(x, b0, s00);
+        s01 = _mm256_fmadd_pd(x, b1, s01);
+        x = _mm256_broadcast_sd(a1 + p);
+        s10 = _mm256_fmadd_pd(x, b0, s10);
+        s11 = _mm256_fmadd_pd(x, b1, s11);
+        x = _mm256_broadcast_sd(a2 + p);
+        s20 = _mm256_fmadd_pd(x, b0, s20);
+        s21 = _mm256_fmadd_pd(x, b1, s21);
+        x = _mm256_broadcast_sd(a3 + p);
+        s30 = _mm256_fmadd_pd(x, b0, s30);
+        s31 = _mm256_fmadd_pd(x, b1, s31);
+    }
+    _mm256_maskstore_pd(c0, m0, s00); _mm256_maskstore_pd(c0 + 4, m1, s01);
+    _mm256_maskstore_pd(c1, m0, s10); _mm256_maskstore_pd(c1 + 4, m1, s11);
+    _mm256_maskstore_pd(c2, m0, s20); _mm256_maskstore_pd(c2 + 4, m1, s21);
+    _mm256_maskstore_pd(c3, m0, s30); _mm256_maskstore_pd(c3 + 4, m1, s31);
+}
+
+IMR_AVX2 inline void tileAvx2x1(int k, int nc,
+                                const double *A,
+                                const double *B, int ldb,
+                                double *C)
+{
+    const __m256i m0 = tailMask256(nc), m1 = tailMask256(nc - 4);
+    __m256d s0 = _mm256_maskload_pd(C, m0), s1 = _mm256_maskload_pd(C + 4, m1);
+    for (int p = 0; p < k; ++p) {
+        const double *b = B + static_cast<std::size_t>(p) * ldb;
+        const __m256d x = _mm256_broadcast_sd(A + p);
+        s0 = _mm256_fmadd_pd(x, _mm256_maskload_pd(b, m0), s0);
+        s1 = _mm256_fmadd_pd(x, _mm256_maskload_pd(b + 4, m1), s1);
+    }
+    _mm256_maskstore_pd(C, m0, s0);
+    _mm256_maskstore_pd(C + 4, m1, s1);
+}
+
+IMR_AVX2 inline void gemmAvx2(int m, int n, int k,
+                              const double *A, int lda,
+                              const double *B, int ldb,
+                              double *C, int ldc)
+{
+    for (int j = 0; j < n; j += 8) {
+        const int nc = std::min(8, n - j);
+        int i = 0;
+        for (; i + 4 <= m; i += 4)
+            tileAvx2x4(k, nc, A + static_cast<std::size_t>(i) * lda, lda, B + j, ldb,
+                       C + static_cast<std::size_t>(i) * ldc + j, ldc);
+        for (; i < m; ++i)
+            tileAvx2x1(k, nc, A + static_cast<std::size_t>(i) * lda, B + j, ldb,
+                       C + static_cast<std::size_t>(i) * ldc + j);
+    }
+}
+
+#undef IMR_AVX2
+
+#define IMR_AVX512 __attribute__((target("avx512f")))
+
+// AVX-512: kierunek zaokrąglenia osadzony w FMA, bez zmiany MXCSR, 4×16
+#define IMR_FMA(a, b, c) _mm512_fmadd_round_pd(a, b, c, R | _MM_FROUND_NO_EXC)
+
+template <int R>
+IMR_AVX512 inline void tileAvx512x4(int k, int nc,
+                                    const double *A, int lda,
+                                    const double *B, int ldb,
+                                    double *C, int ldc)
+{
+    const __mmask8 m0 = nc >= 8 ? __mmask8(0xFF) : __mmask8((1u << nc) - 1);
+    const __mmask8 m1 = nc >= 16 ? __mmask8(0xFF) : nc <= 8 ? __mmask8(0) : __mmask8((1u << (nc - 8)) - 1);
+    const double *a0 = A, *a1 = A + lda, *a2 = A + 2 * static_cast<std::size_t>(lda),
+                 *a3 = A + 3 * static_cast<std::size_t>(lda);
+    double *c0 = C, *c1 = C + ldc, *c2 = C + 2 * static_cast<std::size_t>(ldc),
+           *c3 = C + 3 * static_cast<std::size_t>(ldc);
+    __m512d s00 = _mm512_maskz_loadu_pd(m0, c0), s01 = _mm512_maskz_loadu_pd(m1, c0 + 8);
+    __m512d s10 = _mm512_maskz_loadu_pd(m0, c1), s11 = _mm512_maskz_loadu_pd(m1, c1 + 8);
+    __m512d s20 = _mm512_maskz_loadu_pd(m0, c2), s21 = _mm512_maskz_loadu_pd(m1, c2 + 8);
+    __m512d s30 = _mm512_maskz_loadu_pd(m0, c3), s31 = _mm512_maskz_loadu_pd(m1, c3 + 8);
+    for (int p = 0; p < k; ++p) {
+        const double *b = B + static_cast<std::size_t>(p) * ldb;
+        const __m512d b0 = _mm512_maskz_loadu_pd(m0, b), b1 = _mm512_maskz_loadu_pd(m1, b + 8);
+        __m512d x = _mm512_set1_pd(a0[p]);
+        s00 = IMR_FMA(x, b0, s00);
+        s01 = IMR_FMA(x, b1, s01);
+        x = _mm512_set1_pd(a1[p]);
+        s10 = IMR_FMA(x, b0, s10);
+        s11 = IMR_FMA(x, b1, s11);
+        x = _mm512_set1_pd(a2[p]);
+        s20 = IMR_FMA(x, b0, s20);
+        s21 = IMR_FMA(x, b1, s21);
+        x = _mm512_set1_pd(a3[p]);
+        s30 = IMR_FMA(x, b0, s30);
+        s31 = IMR_FMA(x, b1, s31);
+    }
+    _mm512_mask_storeu_pd(c0, m0, s00); _mm512_mask_storeu_pd(c0 + 8, m1, s01);
+    _mm512_mask_storeu_pd(c1, m0, s10); _mm512_mask_storeu_pd(c1 + 8, m1, s11);
+    _mm512_mask_storeu_pd(c2, m0, s20); _mm512_mask_storeu_pd(c2 + 8, m1, s21);
+    _mm512_mask_storeu_pd(c3, m0, s30); _mm512_mask_storeu_pd(c3 + 8, m1, s31);
+}
+
+template <int R>
+IMR_AVX512 inline void tileAvx512x1(int k, int nc,
+                                    const double *A,
+                                    const double *B, int ldb,
+                                    double *C)
+{
+    const __mmask8 m0 = nc >= 8 ? __mmask8(0xFF) : __mmask8((1u << nc) - 1);
+    const __mmask8 m1 = nc >= 16 ? __mmask8(0xFF) : nc <= 8 ? __mmask8(0) : __mmask8((1u << (nc - 8)) - 1);
+    __m512d s0 = _mm512_maskz_loadu_pd(m0, C), s1 = _mm512_maskz_loadu_pd(m1, C + 8);
+    for (int p = 0; p < k; ++p) {
+        const double *b = B + static_cast<std::size_t>(p) * ldb;
+        const __m512d x = _mm512_set1_pd(A[p]);
+        s0 = IMR_FMA(x, _mm512_maskz_loadu_pd(m0, b), s0);
+        s1 = IMR_FMA(x, _mm512_maskz_loadu_pd(m1, b + 8), s1);
+    }
+    _mm512_mask_storeu_pd(C, m0, s0);
+    _mm512_mask_storeu_pd(C + 8, m1, s1);
+}
+
+#undef IMR_FMA
+
+template <int R>
+IMR_AVX512 inline void gemmAvx512(int m, int n, int k,
+                                  const double *A, int lda,
+                                  const double *B, int ldb,
+                                  double *C, int ldc)
+{
+    for (int j = 0; j < n; j += 16) {
+        const int nc = std::min(16, n - j);
+        int i = 0;
+        for (; i + 4 <= m; i += 4)
+            tileAvx512x4<R>(k, nc, A + static_cast<std::size_t>(i) * lda, lda, B + j, ldb,
+                            C + static_cast<std::size_t>(i) * ldc + j, ldc);
+        for (; i < m; ++i)
+            tileAvx512x1<R>(k, nc, A + static_cast<std::size_t>(i) * lda, B + j, ldb,
+                            C + static_cast<std::size_t>(i) * ldc + j);
+    }
+}
+
+#undef IMR_AVX512
+
+#endif // INTERVAL_SIMD_X86
+
+/**
+ * C(m×n) += A(m×k)·B(k×n), wszystko wierszami z podanymi krokami wierszy,
+ * z każdym dodaniem i mnożeniem zaokrąglanym w kierunku mode (FE_UPWARD
+ * albo FE_DOWNWARD), więc wynik ogranicza dokładną sumę z tej strony.
+ * Pętla po k dzielona jest na kawałki KB, żeby wiersze B mieściły się w L2.
+ */
+inline void gemm(int mode, int m, int n, int k,
+                 const double *A, int lda,
+                 const double *B, int ldb,
+                 double *C, int ldc)
+{
+    constexpr int KB = 256;
+#ifdef INTERVAL_SIMD_X86
+    const simd::detail::Isa isa = simd::detail::isa();
+    if (isa == simd::detail::Isa::Avx512) {
+        for (int p = 0; p < k; p += KB) {
+            const int kc = std::min(KB, k - p);
+            if (mode == FE_UPWARD)
+                gemmAvx512<_MM_FROUND_TO_POS_INF>(m, n, kc, A + p, lda,
+                                                  B + static_cast<std::size_t>(p) * ldb, ldb, C, ldc);
+            else
+                gemmAvx512<_MM_FROUND_TO_NEG_INF>(m, n, kc, A + p, lda,
+                                                  B + static_cast<std::size_t>(p) * ldb, ldb, C, ldc);
+        }
+        return;
+    }
+#endif
+    RoundingScope rounding(mode);
+    for (int p = 0; p < k; p += KB) {
+        const int kc = std::min(KB, k - p);
+#ifdef INTERVAL_SIMD_X86
+        if (isa == simd::detail::Isa::Avx2) {
+            gemmAvx2(m, n, kc, A + p, lda, B + static_cast<std::size_t>(p) * ldb, ldb, C, ldc);
+            continue;
+        }
+#endif
+        gemmScalar(m, n, kc, A + p, lda, B + static_cast<std::size_t>(p) * ldb, ldb, C, ldc);
+    }
+}
+
+// Konwersja [lo; hi] -> <m, r>; wywoływać w trybie FE_UPWARD.
+inline void toMidRadUp(double lo, double hi, double &m, double &r)
+{
+    m = lo + 0.5 * (hi - lo);
+    r = m - lo;
+}
+
+/**
+ * Rdzeń algorytmu Rumpa na buforach: C = A·B, A = <mA, rA> (m×k),
+ * B = <mB, rB> (k×n), wszystko ciągłe wierszami. Wynik <mC, rC> (m×n).
+ */
+inline void product(int m, int n, int k,
+                    const double *mA, const double *rA,
+                    const double *mB, const double *rB,
+                    double *mC, double *rC)
+{
+    const std::size_t mn = static_cast<std::size_t>(m) * n;
+
+    // [|mA| rA] (m×2k) i [rB; |mB|+rB] (2k×n) – promień jednym iloczynem
+    AlignedVector<double> absA(static_cast<std::size_t>(m) * 2 * k);
+    AlignedVector<double> radB(static_cast<std::size_t>(2) * k * n);
+    AlignedVector<double> c1(mn, 0.0);
+
+    RoundingScope rounding(FE_UPWARD);    // |mB| + rB i końcowe złożenie
+    for (int i = 0; i < m; ++i)
+        for (int p = 0; p < k; ++p) {
+            const std::size_t s = static_cast<std::size_t>(i) * k + p;
+            absA[static_cast<std::size_t>(i) * 2 * k + p] = std::fabs(mA[s]);
+            absA[static_cast<std::size_t>(i) * 2 * k + k + p] = rA[s];
+        }
+    for (int p = 0; p < k; ++p)
+        for (int j = 0; j < n; ++j) {
+            const std::size_t s = static_cast<std::size_t>(p) * n + j;
+            radB[s] = rB[s];
+            radB[static_cast<std::size_t>(k + p) * n + j] = std::fabs(mB[s]) + rB[s];
+        }
+
+    std::fill(mC, mC + mn, 0.0);
+    std::fill(rC, rC + mn, 0.0);
+    gemm(FE_UPWARD, m, n, k, mA, k, mB, n, mC, n);              // c2 = ↑(mA·mB)
+    gemm(FE_UPWARD, m, n, 2 * k, absA.data(), 2 * k, radB.data(), n, rC, n);
+    gemm(FE_DOWNWARD, m, n, k, mA, k, mB, n, c1.data(), n);     // c1 = ↓(mA·mB)
+
+    for (std::size_t s = 0; s < mn; ++s) {
+        const double mid = c1[s] + 0.5 * (mC[s] - c1[s]);
+        rC[s] = (mid - c1[s]) + rC[s];
+        mC[s] = mid;
+    }
+}
+
+} // namespace detail
+
+/**
+ * [lo; hi] -> <m, r> dla całej macierzy.
+ */
+inline MidRadMatrix toMidRad(const IntervalMatrix<double> &A)
+{
+    MidRadMatrix M(A.rows(), A.cols());
+    detail::RoundingScope rounding(FE_UPWARD);
+    for (int i = 0; i < A.rows(); ++i) {
+        const std::size_t row = static_cast<std::size_t>(i) * A.cols();
+        for (int j = 0; j < A.cols(); ++j)
+            detail::toMidRadUp(A.loRow(i)[j], A.hiRow(i)[j], M.mid()[row + j], M.rad()[row + j]);
+    }
+    return M;
+}
+
+/**
+ * <m, r> -> [lo; hi] dla całej macierzy.
+ */
+inline IntervalMatrix<double> toInfSup(const MidRadMatrix &M)
+{
+    IntervalMatrix<double> A(M.rows(), M.cols());
+    detail::RoundingScope rounding(FE_DOWNWARD);
+    for (int i = 0; i < M.rows(); ++i) {
+        const std::size_t row = static_cast<std::size_t>(i) * M.cols();
+        for (int j = 0; j < M.cols(); ++j)
+            A.loRow(i)[j] = M.mid()[row + j] - M.rad()[row + j];
+    }
+    rounding.set(FE_UPWARD);
+    for (int i = 0; i < M.rows(); ++i) {
+        const std::size_t row = static_cast<std::size_t>(i) * M.cols();
+        for (int j = 0; j < M.cols(); ++j)
+            A.hiRow(i)[j] = M.mid()[row + j] + M.rad()[row + j];
+    }
+    return A;
+}
+
+/**
+ * Iloczyn macierzy przedziałowych A·B w reprezentacji mid/rad.
+ */
+inline MidRadMatrix IMatMul(const MidRadMatrix &A, const MidRadMatrix &B)
+{
+    if (A.cols() != B.rows())
+        throw std::invalid_argument("IMatMul: niezgodne wymiary macierzy");
+    MidRadMatrix C(A.rows(), B.cols());
+    detail::product(A.rows(), B.cols(), A.cols(),
+                    A.mid(), A.rad(), B.mid(), B.rad(), C.mid(), C.rad());
+    return C;
+}
+
+/**
+ * Iloczyn A·x, wynik w postaci [lo; hi].
+ */
+inline IntervalVector<double> IMatVec(const MidRadMatrix &A, const IntervalVector<double> &x)
+{
+    if (A.cols() != x.size())
+        throw std::invalid_argument("IMatVec: niezgodne wymiary");
+    const int n = x.size();
+    AlignedVector<double> mx(n), rx(n), my(A.rows()), ry(A.rows());
+    {
+        detail::RoundingScope rounding(FE_UPWARD);
+        for (int j = 0; j < n; ++j)
+            detail::toMidRadUp(x.lo()[j], x.hi()[j], mx[j], rx[j]);
+    }
+    detail::product(A.rows(), 1, n, A.mid(), A.rad(), mx.data(), rx.data(), my.data(), ry.data());
+
+    IntervalVector<double> y(A.rows());
+    detail::RoundingScope rounding(FE_DOWNWARD);
+    for (int i = 0; i < A.rows(); ++i)
+        y.lo()[i] = my[i] - ry[i];
+    rounding.set(FE_UPWARD);
+    for (int i = 0; i < A.rows(); ++i)
+        y.hi()[i] = my[i] + ry[i];
+    return y;
+}
+
+/**
+ * Obudowa residuum b - A·x (A, b, x przedziałowe).
+ */
+inline IntervalVector<double> IResidual(const MidRadMatrix &A,
+                                        const IntervalVector<double> &b,
+                                        const IntervalVector<double> &x)
+{
+    if (A.rows() != b.size())
+        throw std::invalid_argument("IResidual: niezgodne wymiary");
+    IntervalVector<double> Ax = IMatVec(A, x);
+    IntervalVector<double> r(b.size());
+    simd::ISubN(b.lo(), b.hi(), Ax.lo(), Ax.hi(), r.lo(), r.hi(), b.size());
+    return r;
+}
+
+/**
+ * Aktualizacja dopełnienia Schura: S(i, j) -= Σ_p X(i, p)·Y(j, p)
+ * dla i < m, j < n, p < k (S -= X·Yᵀ). Wszystkie macierze w układzie SoA
+ * wierszami, podane wskaźnikami na lewy górny róg bloku i krokami wierszy.
+ * Y wchodzi transponowane, bo solvery trzymają Uᵀ (oraz L·D) wierszami.
+ */
+inline void ISubMatMulNT(int m, int n, int k,
+                         const double *xlo, const double *xhi, int ldx,
+                         const double *ylo, const double *yhi, int ldy,
+                         double *slo, double *shi, int lds)
+{
+    if (m <= 0 || n <= 0 || k <= 0)
+        return;
+
+    AlignedVector<double> mX(static_cast<std::size_t>(m) * k), rX(mX.size());
+    AlignedVector<double> mY(static_cast<std::size_t>(k) * n), rY(mY.size());
+    AlignedVector<double> mC(static_cast<std::size_t>(m) * n), rC(mC.size());
+    {
+        detail::RoundingScope rounding(FE_UPWARD);
+        for (int i = 0; i < m; ++i)
+            for (int p = 0; p < k; ++p) {
+                const std::size_t s = static_cast<std::size_t>(i) * ldx + p;
+                detail::toMidRadUp(xlo[s], xhi[s], mX[static_cast<std::size_t>(i) * k + p],
+                                   rX[static_cast<std::size_t>(i) * k + p]);
+            }
+        for (int j = 0; j < n; ++j)
+            for (int p = 0; p < k; ++p) {
+                const std::size_t s = static_cast<std::size_t>(j) * ldy + p;
+                detail::toMidRadUp(ylo[s], yhi[s], mY[static_cast<std::size_t>(p) * n + j],
+                                   rY[static_cast<std::size_t>(p) * n + j]);
+            }
+    }
+
+    detail::product(m, n, k, mX.data(), rX.data(), mY.data(), rY.data(), mC.data(), rC.data());
+
+    // S - <mC, rC> = [↓(S.lo - ↑(mC + rC)); ↑(S.hi - ↓(mC - rC))],
+    // oba końce w FE_UPWARD przez negację: ↓(u - v) = -↑(v - u)
+    simd::RoundUpwardScope rounding;
+    for (int i = 0; i < m; ++i) {
+        double *lo = slo + static_cast<std::size_t>(i) * lds;
+        double *hi = shi + static_cast<std::size_t>(i) * lds;
+        const double *mc = mC.data() + static_cast<std::size_t>(i) * n;
+        const double *rc = rC.data() + static_cast<std::size_t>(i) * n;
+        for (int j = 0; j < n; ++j) {
+            lo[j] = -((mc[j] + rc[j]) - lo[j]);
+            hi[j] = hi[j] + (rc[j] - mc[j]);
+        }
+    }
+}
+
+} // namespace midrad
+
+// Dla końców double aktualizacja Schura idzie przez iloczyny Rumpa.
+inline void ISubMatMulNT(int m, int n, int k,
+                         const double *xlo, const double *xhi, int ldx,
+                         const double *ylo, const double *yhi, int ldy,
+                         double *slo, double *shi, int lds)
+{
+    midrad::ISubMatMulNT(m, n, k, xlo, xhi, ldx, ylo, yhi, ldy, slo, shi, lds);
+}
+
+} // namespace interval_arithmetic
+
+#endif // INTERVAL_MIDRAD_HPP
@@ -11,6 +11,7 @@ namespace interval_arithmetic {
 // i przełącza wewnętrzne zaokrąglanie mpreal odpowiednio do FE_UPWARD/DOWNWARD.
 template <>
 inline int SetRounding<mpfr::mpreal>(int rounding) {
+    CountRoundingSwitch();
     if (rounding == FE_UPWARD) {
         mpfr::mpreal::set_default_rnd(MPFR_RNDU);
     } else if (rounding == FE_DOWNWARD) {
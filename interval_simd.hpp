@@ -0,0 +1,531 @@
+#ifndef INTERVAL_SIMD_HPP
+#define INTERVAL_SIMD_HPP
+
+// Wektorowe jądra arytmetyki przedziałowej dla Interval<double> w układzie SoA
+// (osobne tablice lo/hi, zob. interval_array.hpp).
+//
+// Trzy implementacje, wybierane raz w czasie działania programu:
+//  - AVX-512F: zaokrąglanie osadzone w instrukcji (_mm512_*_round_pd),
+//    bez przełączania trybu zaokrąglania,
+//  - AVX2: tryb FE_UPWARD ustawiony raz na cały wsad, dolne końce liczone
+//    "trikiem negacji": down(x·y) = -up((-x)·y),
+//  - skalarna: ten sam trik negacji, bez intrynsyk.
+// Trik negacji wymaga kompilacji z -frounding-math (inaczej kompilator
+// skraca -((-x)·y) do x·y).
+//
+// Mnożenie nie liczy ośmiu iloczynów z min/max jak IMul: dla każdego
+// elementu wybierane są czynniki wg znaków końców (x≥0, x≤0, x∋0 × to samo
+// dla y), co daje dwa iloczyny na kierunek zaokrąglenia.
+//
+// Wszystkie jądra zakładają przedziały właściwe (a ≤ b).
+//
+// Zmienna środowiskowa CROUT_SIMD=scalar|avx2 ogranicza wybór (testy,
+// porównania wersji); poziomu, którego procesor nie ma, nie wymusza.
+
+#include <cfenv>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include "interval.hpp"
+#include "interval_array.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INTERVAL_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace interval_arithmetic {
+namespace simd {
+
+// Ustawia FE_UPWARD na czas życia obiektu i przywraca poprzedni tryb.
+class RoundUpwardScope {
+public:
+    RoundUpwardScope() : saved_(std::fegetround()) {
+        CountRoundingSwitch();
+        std::fesetround(FE_UPWARD);
+    }
+    ~RoundUpwardScope() {
+        CountRoundingSwitch();
+        std::fesetround(saved_);
+    }
+    RoundUpwardScope(const RoundUpwardScope &) = delete;
+    RoundUpwardScope &operator=(const RoundUpwardScope &) = delete;
+
+private:
+    int saved_;
+};
+
+namespace detail {
+
+// ─── wersja skalarna (tryb FE_UPWARD ustawia wywołujący) ─────────────────────
+
+inline void mulUp(double xa, double xb, double ya, double yb, double &lo, double &hi)
+{
+    const bool xpos = xa >= 0, xneg = xb <= 0;
+    const bool ypos = ya >= 0, yneg = yb <= 0;
+    const bool both = !xpos && !xneg && !ypos && !yneg;   // x∋0 i y∋0
+
+    // czynniki dolnego końca
+    const double x1 = (xpos ? !ypos : yneg) ? xb : xa;
+    const double y1 = (xpos || (!xneg && yneg)) ? ya : yb;
+    const double x2 = both ? xb : x1;
+    const double y2 = both ? ya : y1;
+    // czynniki górnego końca
+    const double x3 = (xpos ? yneg : !ypos) ? xa : xb;
+    const double y3 = (xpos || (!xneg && ypos)) ? yb : ya;
+    const double x4 = both ? xb : x3;
+    const double y4 = both ? yb : y3;
+
+    const double l1 = -((-x1) * y1), l2 = -((-x2) * y2);
+    const double h1 = x3 * y3, h2 = x4 * y4;
+    lo = l1 < l2 ? l1 : l2;
+    hi = h1 > h2 ? h1 : h2;
+}
+
+inline void divUp(double xa, double xb, double ya, double yb, double &lo, double &hi)
+{
+    if (ya <= 0 && yb >= 0)
+        throw std::runtime_error("Division by an interval containing 0.");
+    double nl, nh, dl, dh;
+    if (ya > 0) {
+        nl = xa; dl = xa >= 0 ? yb : ya;
+        nh = xb; dh = xb >= 0 ? ya : yb;
+    } else {
+        nl = xb; dl = xb >= 0 ? yb : ya;
+        nh = xa; dh = xa >= 0 ? ya : yb;
+    }
+    lo = -((-nl) / dl);
+    hi = nh / dh;
+}
+
+inline void addScalar(const double *xa, const double *xb, const double *ya, const double *yb,
+                      double *ra, double *rb, int n)
+{
+    RoundUpwardScope up;
+    for (int k = 0; k < n; ++k) {
+        ra[k] = -((-xa[k]) - ya[k]);
+        rb[k] = xb[k] + yb[k];
+    }
+}
+
+inline void subScalar(const double *xa, const double *xb, const double *ya, const double *yb,
+                      double *ra, double *rb, int n)
+{
+    RoundUpwardScope up;
+    for (int k = 0; k < n; ++k) {
+        ra[k] = -(yb[k] - xa[k]);
+        rb[k] = xb[k] - ya[k];
+    }
+}
+
+inline void mulScalar(const double *xa, const double *xb, const double *ya, const double *yb,
+                      double *ra, double *rb, int n)
+{
+    RoundUpwardScope up;
+    for (int k = 0; k < n; ++k)
+        mulUp(xa[k], xb[k], ya[k], yb[k], ra[k], rb[k]);
+}
+
+inline void divScalar(const double *xa, const double *xb, const double *ya, const double *yb,
+                      double *ra, double *rb, int n)
+{
+    RoundUpwardScope up;
+    for (int k = 0; k < n; ++k)
+        divUp(xa[k], xb[k], ya[k], yb[k], ra[k], rb[k]);
+}
+
+inline Interval<double> dotScalar(const double *xa, const double *xb,
+                                  const double *ya, const double *yb, int n)
+{
+    RoundUpwardScope up;
+    double nlo = 0, hi = 0;   // nlo = -(dolny koniec), sumowany w górę
+    for (int k = 0; k < n; ++k) {
+        double pl, ph;
+        mulUp(xa[k], xb[k], ya[k], yb[k], pl, ph);
+        nlo = nlo - pl;
+        hi = hi + ph;
+    }
+    return Interval<double>(-RoundingBarrier(nlo), RoundingBarrier(hi));
+}
+
+#ifdef INTERVAL_SIMD_X86
+
+// ─── AVX2: tryb FE_UPWARD na cały wsad, dolne końce przez negację ────────────
+
+#define ISIMD_AVX2 __attribute__((target("avx2,fma")))
+
+ISIMD_AVX2 inline __m256d neg256(__m256d v)
+{
+    return _mm256_xor_pd(v, _mm256_set1_pd(-0.0));
+}
+
+ISIMD_AVX2 inline void mul256(__m256d xa, __m256d xb, __m256d ya, __m256d yb,
+                              __m256d &lo, __m256d &hi)
+{
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d xpos = _mm256_cmp_pd(xa, zero, _CMP_GE_OQ);
+    const __m256d xneg = _mm256_cmp_pd(xb, zero, _CMP_LE_OQ);
+    const __m256d ypos = _mm256_cmp_pd(ya, zero, _CMP_GE_OQ);
+    const __m256d yneg = _mm256_cmp_pd(yb, zero, _CMP_LE_OQ);
+    const __m256d xmix = _mm256_andnot_pd(_mm256_or_pd(xpos, xneg), _mm256_castsi256_pd(_mm256_set1_epi64x(-1)));
+    const __m256d ymix = _mm256_andnot_pd(_mm256_or_pd(ypos, yneg), _mm256_castsi256_pd(_mm256_set1_epi64x(-1)));
+    const __m256d both = _mm256_and_pd(xmix, ymix);
+
+    // x1 = xb gdy (xpos ? !ypos : yneg)
+    const __m256d selX1 = _mm256_blendv_pd(yneg, _mm256_andnot_pd(ypos, xpos), xpos);
+    // y1 = ya gdy xpos || (!xneg && yneg)
+    const __m256d selY1 = _mm256_or_pd(xpos, _mm256_andnot_pd(xneg, yneg));
+    // x3 = xa gdy (xpos ? yneg : !ypos)
+    const __m256d notYpos = _mm256_xor_pd(ypos, _mm256_castsi256_pd(_mm256_set1_epi64x(-1)));
+    const __m256d selX3 = _mm256_blendv_pd(notYpos, yneg, xpos);
+    // y3 = yb gdy xpos || (!xneg && ypos)
+    const __m256d selY3 = _mm256_or_pd(xpos, _mm256_andnot_pd(xneg, ypos));
+
+    const __m256d x1 = _mm256_blendv_pd(xa, xb, selX1);
+    const __m256d y1 = _mm256_blendv_pd(yb, ya, selY1);
+    const __m256d x2 = _mm256_blendv_pd(x1, xb, both);
+    const __m256d y2 = _mm256_blendv_pd(y1, ya, both);
+    const __m256d x3 = _mm256_blendv_pd(xb, xa, selX3);
+    const __m256d y3 = _mm256_blendv_pd(ya, yb, selY3);
+    const __m256d x4 = _mm256_blendv_pd(x3, xb, both);
+    const __m256d y4 = _mm256_blendv_pd(y3, yb, both);
+
+    const __m256d l1 = neg256(_mm256_mul_pd(neg256(x1), y1));
+    const __m256d l2 = neg256(_mm256_mul_pd(neg256(x2), y2));
+    lo = _mm256_min_pd(l1, l2);
+    hi = _mm256_max_pd(_mm256_mul_pd(x3, y3), _mm256_mul_pd(x4, y4));
+}
+
+ISIMD_AVX2 inline void addAvx2(const double *xa, const double *xb, const double *ya, const double *yb,
+                               double *ra, double *rb, int n)
+{
+    RoundUpwardScope up;
+    int k = 0;
+    for (; k + 4 <= n; k += 4) {
+        const __m256d lo = neg256(_mm256_sub_pd(neg256(_mm256_loadu_pd(xa + k)), _mm256_loadu_pd(ya + k)));
+        const __m256d hi = _mm256_add_pd(_mm256_loadu_pd(xb + k), _mm256_loadu_pd(yb + k));
+        _mm256_storeu_pd(ra + k, lo);
+        _mm256_storeu_pd(rb + k, hi);
+    }
+    for (; k < n; ++k) {
+        ra[k] = -((-xa[k]) - ya[k]);
+        rb[k] = xb[k] + yb[k];
+    }
+}
+
+ISIMD_AVX2 inline void subAvx2(const double *xa, const double *xb, const double *ya, const double *yb,
+                               double *ra, double *rb, int n)
+{
+    RoundUpwardScope up;
+    int k = 0;
+    for (; k + 4 <= n; k += 4) {
+        const __m256d lo = neg256(_mm256_sub_pd(_mm256_loadu_pd(yb + k), _mm256_loadu_pd(xa + k)));
+        const __m256d hi = _mm256_sub_pd(_mm256_loadu_pd(xb + k), _mm256_loadu_pd(ya + k));
+        _mm256_storeu_pd(ra + k, lo);
+        _mm256_storeu_pd(rb + k, hi);
+    }
+    for (; k < n; ++k) {
+        ra[k] = -(yb[k] - xa[k]);
+        rb[k] = xb[k] - ya[k];
+    }
+}
+
+ISIMD_AVX2 inline void mulAvx2(const double *xa, const double *xb, const double *ya, const double *yb,
+                               double *ra, double *rb, int n)
+{
+    RoundUpwardScope up;
+    int k = 0;
+    for (; k + 4 <= n; k += 4) {
+        __m256d lo, hi;
+        mul256(_mm256_loadu_pd(xa + k), _mm256_loadu_pd(xb + k),
+               _mm256_loadu_pd(ya + k), _mm256_loadu_pd(yb + k), lo, hi);
+        _mm256_storeu_pd(ra + k, lo);
+        _mm256_storeu_pd(rb + k, hi);
+    }
+    for (; k < n; ++k)
+        mulUp(xa[k], xb[k], ya[k], yb[k], ra[k], rb[k]);
+}
+
+ISIMD_AVX2 inline Interval<double> dotAvx2(const double *xa, const double *xb,
+                                           const double *ya, const double *yb, int n)
+{
+    RoundUpwardScope up;
+    __m256d nlo = _mm256_setzero_pd(), hi = _mm256_setzero_pd();
+    int k = 0;
+    for (; k + 4 <= n; k += 4) {
+        __m256d pl, ph;
+        mul256(_mm256_loadu_pd(xa + k), _mm256_loadu_pd(xb + k),
+               _mm256_loadu_pd(ya + k), _mm256_loadu_pd(yb + k), pl, ph);
+        nlo = _mm256_sub_pd(nlo, pl);
+        hi = _mm256_add_pd(hi, ph);
+    }
+    double l[4], h[4];
+    _mm256_storeu_pd(l, nlo);
+    _mm256_storeu_pd(h, hi);
+    double sl = (l[0] + l[1]) + (l[2] + l[3]);
+    double sh = (h[0] + h[1]) + (h[2] + h[3]);
+    for (; k < n; ++k) {
+        double pl, ph;
+        mulUp(xa[k], xb[k], ya[k], yb[k], pl, ph);
+        sl = sl - pl;
+        sh = sh + ph;
+    }
+    return Interval<double>(-RoundingBarrier(sl), RoundingBarrier(sh));
+}
+
+#undef ISIMD_AVX2
+
+// ─── AVX-512F: zaokrąglanie osadzone, bez zmiany MXCSR ───────────────────────
+
+// GCC 12 ostrzega o '__Y' z _mm512_undefined_pd w *_round_pd – fałszywy
+// alarm (niezamaskowana wersja nie czyta starej wartości); wyciszone tylko
+// dla tych jąder, żeby nie trafiało do każdego pliku z tym nagłówkiem
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+#define ISIMD_AVX512 __attribute__((target("avx512f")))
+#define ISIMD_DN (_MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)
+#define ISIMD_UP (_MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)
+
+ISIMD_AVX512 inline void mul512(__m512d xa, __m512d xb, __m512d ya, __m512d yb,
+                                __m512d &lo, __m512d &hi)
+{
+    const __m512d zero = _mm512_setzero_pd();
+    const __mmask8 xpos = _mm512_cmp_pd_mask(xa, zero, _CMP_GE_OQ);
+    const __mmask8 xneg = _mm512_cmp_pd_mask(xb, zero, _CMP_LE_OQ);
+    const __mmask8 ypos = _mm512_cmp_pd_mask(ya, zero, _CMP_GE_OQ);
+    const __mmask8 yneg = _mm512_cmp_pd_mask(yb, zero, _CMP_LE_OQ);
+    const __mmask8 both = static_cast<__mmask8>(~(xpos | xneg) & ~(ypos | yneg));
+
+    const __mmask8 selX1 = static_cast<__mmask8>((xpos & ~ypos) | (~xpos & yneg));
+    const __mmask8 selY1 = static_cast<__mmask8>(xpos | (~xneg & yneg));
+    const __mmask8 selX3 = static_cast<__mmask8>((xpos & yneg) | (~xpos & ~ypos));
+    const __mmask8 selY3 = static_cast<__mmask8>(xpos | (~xneg & ypos));
+
+    const __m512d x1 = _mm512_mask_blend_pd(selX1, xa, xb);
+    const __m512d y1 = _mm512_mask_blend_pd(selY1, yb, ya);
+    const __m512d x2 = _mm512_mask_blend_pd(both, x1, xb);
+    const __m512d y2 = _mm512_mask_blend_pd(both, y1, ya);
+    const __m512d x3 = _mm512_mask_blend_pd(selX3, xb, xa);
+    const __m512d y3 = _mm512_mask_blend_pd(selY3, ya, yb);
+    const __m512d x4 = _mm512_mask_blend_pd(both, x3, xb);
+    const __m512d y4 = _mm512_mask_blend_pd(both, y3, yb);
+
+    lo = _mm512_min_pd(_mm512_mul_round_pd(x1, y1, ISIMD_DN), _mm512_mul_round_pd(x2, y2, ISIMD_DN));
+    hi = _mm512_max_pd(_mm512_mul_round_pd(x3, y3, ISIMD_UP), _mm512_mul_round_pd(x4, y4, ISIMD_UP));
+}
+
+ISIMD_AVX512 inline void addAvx512(const double *xa, const double *xb, const double *ya, const double *yb,
+                                   double *ra, double *rb, int n)
+{
+    for (int k = 0; k < n; k += 8) {
+        const __mmask8 m = n - k >= 8 ? __mmask8(0xFF) : __mmask8((1u << (n - k)) - 1);
+        const __m512d lo = _mm512_add_round_pd(_mm512_maskz_loadu_pd(m, xa + k), _mm512_maskz_loadu_pd(m, ya + k), ISIMD_DN);
+        const __m512d hi = _mm512_add_round_pd(_mm512_maskz_loadu_pd(m, xb + k), _mm512_maskz_loadu_pd(m, yb + k), ISIMD_UP);
+        _mm512_mask_storeu_pd(ra + k, m, lo);
+        _mm512_mask_storeu_pd(rb + k, m, hi);
+    }
+}
+
+ISIMD_AVX512 inline void subAvx512(const double *xa, const double *xb, const double *ya, const double *yb,
+                                   double *ra, double *rb, int n)
+{
+    for (int k = 0; k < n; k += 8) {
+        const __mmask8 m = n - k >= 8 ? __mmask8(0xFF) : __mmask8((1u << (n - k)) - 1);
+        const __m512d lo = _mm512_sub_round_pd(_mm512_maskz_loadu_pd(m, xa + k), _mm512_maskz_loadu_pd(m, yb + k), ISIMD_DN);
+        const __m512d hi = _mm512_sub_round_pd(_mm512_maskz_loadu_pd(m, xb + k), _mm512_maskz_loadu_pd(m, ya + k), ISIMD_UP);
+        _mm512_mask_storeu_pd(ra + k, m, lo);
+        _mm512_mask_storeu_pd(rb + k, m, hi);
+    }
+}
+
+ISIMD_AVX512 inline void mulAvx512(const double *xa, const double *xb, const double *ya, const double *yb,
+                                   double *ra, double *rb, int n)
+{
+    for (int k = 0; k < n; k += 8) {
+        const __mmask8 m = n - k >= 8 ? __mmask8(0xFF) : __mmask8((1u << (n - k)) - 1);
+        __m512d lo, hi;
+        mul512(_mm512_maskz_loadu_pd(m, xa + k), _mm512_maskz_loadu_pd(m, xb + k),
+               _mm512_maskz_loadu_pd(m, ya + k), _mm512_maskz_loadu_pd(m, yb + k), lo, hi);
+        _mm512_mask_storeu_pd(ra + k, m, lo);
+        _mm512_mask_storeu_pd(rb + k, m, hi);
+    }
+}
+
+ISIMD_AVX512 inline void divAvx512(const double *xa, const double *xb, const double *ya, const double *yb,
+                                   double *ra, double *rb, int n)
+{
+    const __m512d zero = _mm512_setzero_pd();
+    for (int k = 0; k < n; k += 8) {
+        const __mmask8 m = n - k >= 8 ? __mmask8(0xFF) : __mmask8((1u << (n - k)) - 1);
+        const __m512d vxa = _mm512_maskz_loadu_pd(m, xa + k), vxb = _mm512_maskz_loadu_pd(m, xb + k);
+        // poza zakresem m dzielnik = 1, żeby nie zgłaszać zera
+        const __m512d one = _mm512_set1_pd(1.0);
+        const __m512d vya = _mm512_mask_loadu_pd(one, m, ya + k), vyb = _mm512_mask_loadu_pd(one, m, yb + k);
+
+        const __mmask8 ypos = _mm512_cmp_pd_mask(vya, zero, _CMP_GT_OQ);
+        const __mmask8 yneg = _mm512_cmp_pd_mask(vyb, zero, _CMP_LT_OQ);
+        if (static_cast<__mmask8>(ypos | yneg) != 0xFF)
+            throw std::runtime_error("Division by an interval containing 0.");
+
+        const __mmask8 xaNonneg = _mm512_cmp_pd_mask(vxa, zero, _CMP_GE_OQ);
+        const __mmask8 xbNonneg = _mm512_cmp_pd_mask(vxb, zero, _CMP_GE_OQ);
+        // y > 0: lo = xa / (xa≥0 ? yb : ya),  hi = xb / (xb≥0 ? ya : yb)
+        // y < 0: lo = xb / (xb≥0 ? yb : ya),  hi = xa / (xa≥0 ? ya : yb)
+        const __m512d nl = _mm512_mask_blend_pd(ypos, vxb, vxa);
+        const __m512d nh = _mm512_mask_blend_pd(ypos, vxa, vxb);
+        const __mmask8 nlNonneg = static_cast<__mmask8>((ypos & xaNonneg) | (~ypos & xbNonneg));
+        const __mmask8 nhNonneg = static_cast<__mmask8>((ypos & xbNonneg) | (~ypos & xaNonneg));
+        const __m512d dl = _mm512_mask_blend_pd(nlNonneg, vya, vyb);
+        const __m512d dh = _mm512_mask_blend_pd(nhNonneg, vyb, vya);
+
+        _mm512_mask_storeu_pd(ra + k, m, _mm512_div_round_pd(nl, dl, ISIMD_DN));
+        _mm512_mask_storeu_pd(rb + k, m, _mm512_div_round_pd(nh, dh, ISIMD_UP));
+    }
+}
+
+ISIMD_AVX512 inline Interval<double> dotAvx512(const double *xa, const double *xb,
+                                               const double *ya, const double *yb, int n)
+{
+    __m512d lo = _mm512_setzero_pd(), hi = _mm512_setzero_pd();
+    for (int k = 0; k < n; k += 8) {
+        const __mmask8 m = n - k >= 8 ? __mmask8(0xFF) : __mmask8((1u << (n - k)) - 1);
+        __m512d pl, ph;
+        mul512(_mm512_maskz_loadu_pd(m, xa + k), _mm512_maskz_loadu_pd(m, xb + k),
+               _mm512_maskz_loadu_pd(m, ya + k), _mm512_maskz_loadu_pd(m, yb + k), pl, ph);
+        lo = _mm512_add_round_pd(lo, pl, ISIMD_DN);
+        hi = _mm512_add_round_pd(hi, ph, ISIMD_UP);
+    }
+    // redukcja poziomych sum z tym samym kierunkiem zaokrąglenia
+    // (zaokrąglenie osadzone jest tylko dla 512 bitów i skalarów)
+    double l[8], h[8];
+    _mm512_storeu_pd(l, lo);
+    _mm512_storeu_pd(h, hi);
+    __m128d sl = _mm_set_sd(l[0]), sh = _mm_set_sd(h[0]);
+    for (int i = 1; i < 8; ++i) {
+        sl = _mm_add_round_sd(sl, _mm_set_sd(l[i]), ISIMD_DN);
+        sh = _mm_add_round_sd(sh, _mm_set_sd(h[i]), ISIMD_UP);
+    }
+    return Interval<double>(_mm_cvtsd_f64(sl), _mm_cvtsd_f64(sh));
+}
+
+#undef ISIMD_AVX512
+#undef ISIMD_DN
+#undef ISIMD_UP
+
+#pragma GCC diagnostic pop
+
+enum class Isa { Scalar, Avx2, Avx512 };
+
+inline Isa detectIsa()
+{
+    __builtin_cpu_init();
+    Isa best = Isa::Scalar;
+    if (__builtin_cpu_supports("avx512f"))
+        best = Isa::Avx512;
+    else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        best = Isa::Avx2;
+
+    // CROUT_SIMD tylko obniża poziom
+    if (const char *env = std::getenv("CROUT_SIMD")) {
+        if (std::strcmp(env, "scalar") == 0)
+            return Isa::Scalar;
+        if (std::strcmp(env, "avx2") == 0 && best == Isa::Avx512)
+            return Isa::Avx2;
+    }
+    return best;
+}
+
+inline Isa isa()
+{
+    static const Isa chosen = detectIsa();
+    return chosen;
+}
+
+#endif // INTERVAL_SIMD_X86
+
+} // namespace detail
+
+// ─── interfejs publiczny: r[k] = x[k] ∘ y[k], k < n ─────────────────────────
+
+inline void IAddN(const double *xa, const double *xb, const double *ya, const double *yb,
+                  double *ra, double *rb, int n)
+{
+#ifdef INTERVAL_SIMD_X86
+    switch (detail::isa()) {
+    case detail::Isa::Avx512: return detail::addAvx512(xa, xb, ya, yb, ra, rb, n);
+    case detail::Isa::Avx2:   return detail::addAvx2(xa, xb, ya, yb, ra, rb, n);
+    default: break;
+    }
+#endif
+    detail::addScalar(xa, xb, ya, yb, ra, rb, n);
+}
+
+inline void ISubN(const double *xa, const double *xb, const double *ya, const double *yb,
+                  double *ra, double *rb, int n)
+{
+#ifdef INTERVAL_SIMD_X86
+    switch (detail::isa()) {
+    case detail::Isa::Avx512: return detail::subAvx512(xa, xb, ya, yb, ra, rb, n);
+    case detail::Isa::Avx2:   return detail::subAvx2(xa, xb, ya, yb, ra, rb, n);
+    default: break;
+    }
+#endif
+    detail::subScalar(xa, xb, ya, yb, ra, rb, n);
+}
+
+inline void IMulN(const double *xa, const double *xb, const double *ya, const double *yb,
+                  double *ra, double *rb, int n)
+{
+#ifdef INTERVAL_SIMD_X86
+    switch (detail::isa()) {
+    case detail::Isa::Avx512: return detail::mulAvx512(xa, xb, ya, yb, ra, rb, n);
+    case detail::Isa::Avx2:   return detail::mulAvx2(xa, xb, ya, yb, ra, rb, n);
+    default: break;
+    }
+#endif
+    detail::mulScalar(xa, xb, ya, yb, ra, rb, n);
+}
+
+// Dzielnik nie może zawierać zera (jak w IDiv) – w przeciwnym razie runtime_error.
+inline void IDivN(const double *xa, const double *xb, const double *ya, const double *yb,
+                  double *ra, double *rb, int n)
+{
+#ifdef INTERVAL_SIMD_X86
+    if (detail::isa() == detail::Isa::Avx512)
+        return detail::divAvx512(xa, xb, ya, yb, ra, rb, n);
+#endif
+    // dzielenie AVX2 nie zyskuje na szerokości (div ma niską przepustowość),
+    // więc poniżej AVX-512 zostaje pętla skalarna z jednym przełączeniem trybu
+    detail::divScalar(xa, xb, ya, yb, ra, rb, n);
+}
+
+// Σ x[k]·y[k] – wewnętrzna suma Crouta: sum = IAdd(sum, IMul(x_k, y_k)).
+inline Interval<double> IDotN(const double *xa, const double *xb,
+                              const double *ya, const double *yb, int n)
+{
+    if (n <= 0)
+        return Interval<double>(0, 0);
+#ifdef INTERVAL_SIMD_X86
+    switch (detail::isa()) {
+    case detail::Isa::Avx512: return detail::dotAvx512(xa, xb, ya, yb, n);
+    case detail::Isa::Avx2:   return detail::dotAvx2(xa, xb, ya, yb, n);
+    default: break;
+    }
+#endif
+    return detail::dotScalar(xa, xb, ya, yb, n);
+}
+
+} // namespace simd
+
+// Przeciążenie IDot z interval_array.hpp dla double: trafia w jądra wektorowe.
+inline Interval<double> IDot(const double *xa, const double *xb,
+                             const double *ya, const double *yb, int n)
+{
+    return simd::IDotN(xa, xb, ya, yb, n);
+}
+
+} // namespace interval_arithmetic
+
+#endif // INTERVAL_SIMD_HPP
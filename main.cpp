@@ -2,10 +2,14 @@
 #include "mainwindow.h"
 #include "interval_rounding_fix.hpp"
 #include "interval.hpp"
+#include "utils/mp_arena.h"
 
 
 int main(int argc, char *argv[])
 {
+    // 0. arena GMP/MPFR – przed pierwszą alokacją mpreal (CROUT_MP_ARENA=0 → malloc)
+    utils::MpArena::install();
+
     QApplication app(argc, argv);
 
     // 1. precyzja / outDigits (nic nie boli, gdy wywołasz dwa razy)
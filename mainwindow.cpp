@@ -18,99 +18,31 @@
 #include <QPushButton>
 #include <QLineEdit>
 #include <QTextEdit>
+#include <QTableView>
+#include <QHeaderView>
 #include <QRegularExpression>
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <functional>
+#include <memory>
+#include <new>
+#include <vector>
 
 #include "qstring_utils.hpp"
-#include "solver/general/crout_general_double.h"
-#include "solver/general/crout_general_mpreal.h"
-#include "solver/general/crout_general_interval.h"
-#include "solver/symmetric/crout_symmetric_double.h"
-#include "solver/symmetric/crout_symmetric_mpreal.h"
-#include "solver/symmetric/crout_symmetric_interval.h"
-#include "solver/tridiagonal/crout_tridiagonal_double.h"
-#include "solver/tridiagonal/crout_tridiagonal_mpreal.h"
-#include "solver/tridiagonal/crout_tridiagonal_interval.h"
+#include "matrix_model.h"
+#include "utils/mp_arena.h"
+#include "utils/solve_control.h"
+#include "crout_qt.hpp"
 #include "interval_rounding_fix.hpp"
 
 namespace IA = interval_arithmetic;                 
 using I = IA::Interval<mpfr::mpreal>;        
 
-using namespace solver::general;
-using namespace solver::symmetric;
-using namespace solver::tridiagonal;
+using namespace solver::qt;
 using namespace mpfr;
 using namespace interval_arithmetic;
 
 
-/*--------------------------------------------------------------*/
-/*  Odczytuje QLineEdit jako IA::Interval                       */
-/*--------------------------------------------------------------*/
-/*--------------------------------------------------------------*/
-/*  Odczytuje QLineEdit jako IA::Interval                       */
-/*--------------------------------------------------------------*/
-
-/*--------------------------------------------------------------*/
-/*  Odczytuje QLineEdit jako IA::Interval                       */
-/*  Separator dziesiętny: '.'                                    */
-/*  Separator przedziału: ';'                                    */
-/*--------------------------------------------------------------*/
-
-
-static I readIntervalCell(const QLineEdit* e)
-{
-    // 1) Usuń białe znaki:
-    QString txt = e->text().trimmed().replace(QRegularExpression("\\s+"), "");
-    // 2) Rozdziel tylko po średniku ';'
-    const auto parts = txt.split(';', Qt::SkipEmptyParts);
-
-    // Maszynowe epsilon dla mpreal (~2^(-precision))
-    static const mpreal eps = std::numeric_limits<mpfr::mpreal>::epsilon();
-
-    // Jeżeli użytkownik wpisał tylko jedną liczbę:
-    if (parts.size() == 1) {
-        QString s = parts[0].trimmed();
-        // Spróbuj sparsować jako mpreal:
-        mpreal v(s.toStdString());
-        // Jeśli w zapisie jest kropka '.' lub 'e'/'E', traktujemy to jako "zmiennoprzecinkowe"
-        if (s.contains('.') || s.contains('e', Qt::CaseInsensitive)) {
-            // → nawet jeśli a == b, dodajemy ±eps → szerokość > 0
-            return I(v - eps, v + eps);
-        } else {
-            // → to jest czysto całkowity wpis, punktowy: [v; v], szerokość = 0
-            return I(v, v);
-        }
-    }
-
-    // Jeśli są dokładnie dwa fragmenty: "a;b"
-    if (parts.size() == 2) {
-        QString sa = parts[0].trimmed();
-        QString sb = parts[1].trimmed();
-        mpreal a(sa.toStdString());
-        mpreal b(sb.toStdString());
-        if (a > b) std::swap(a, b);
-
-        // Gdy przedział punktowy (a == b) i wpis _bez_ kropki/'e' → zero‐width:
-        if (a == b && 
-            !sa.contains('.') && !sa.contains('e', Qt::CaseInsensitive) &&
-            !sb.contains('.') && !sb.contains('e', Qt::CaseInsensitive))
-        {
-            // Użytkownik wprowadził dwie identyczne liczby całkowite, np. "2;2"
-            return I(a, a);
-        }
-
-        // W każdej innej sytuacji (a < b albo a == b, ale jest kropka bądź 'e'):
-        // traktujemy to jako "przedział niepunktowy" lub "zmiennoprzecinkowy punkt":
-        return I(a - eps, b + eps);
-    }
-
-    // W pozostałych (błędnych) przypadkach:
-    // Zwracamy [0;0] bez rozszerzenia.
-    mpreal ZERO = mpreal(0);
-    return I(ZERO, ZERO);
-}
-
-
-
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
 {
@@ -128,8 +60,11 @@ MainWindow::MainWindow(QWidget *parent)
         // Rozmiar macierzy
         auto *sizeLabel       = new QLabel("Rozmiar macierzy:");
         matrixSizeSpinBox     = new QSpinBox;
-        matrixSizeSpinBox->setRange(2,20);
+        // komórki rysuje QTableView tylko w widocznym obszarze, więc rozmiar
+        // ogranicza pamięć magazynu, a nie liczba widżetów
+        matrixSizeSpinBox->setRange(2,100000);
         matrixSizeSpinBox->setValue(3);
+        matrixSizeSpinBox->setKeyboardTracking(false);  // nowy model po zatwierdzeniu liczby
         topLayout->addWidget(sizeLabel);
         topLayout->addWidget(matrixSizeSpinBox);
 
@@ -143,6 +78,9 @@ MainWindow::MainWindow(QWidget *parent)
             "Wysokoprecyzyjne",
             "Przedziałowe"
         });
+#ifdef CROUT_HAVE_FLOAT128
+        dataTypeComboBox->addItem("Poczwórna precyzja (__float128)");
+#endif
         topLayout->addWidget(typeLabel);
         topLayout->addWidget(dataTypeComboBox);
 
@@ -167,10 +105,14 @@ MainWindow::MainWindow(QWidget *parent)
     auto *inputLayout = new QHBoxLayout;
     {
         // Macierz A
-        matrixLayout   = new QGridLayout;
-        auto *matrixGroup = new QGroupBox("Macierz A");
-        matrixGroup->setLayout(matrixLayout);
-        inputLayout->addWidget(matrixGroup);
+        matrixView = new QTableView;
+        matrixView->horizontalHeader()->setDefaultSectionSize(90);
+        matrixView->horizontalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+        matrixView->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+        auto *matrixGroup  = new QGroupBox("Macierz A");
+        auto *matrixLayout = new QVBoxLayout(matrixGroup);
+        matrixLayout->addWidget(matrixView);
+        inputLayout->addWidget(matrixGroup, 4);
 
         // Separator
         auto *sep = new QFrame;
@@ -179,23 +121,36 @@ MainWindow::MainWindow(QWidget *parent)
         inputLayout->addWidget(sep);
 
         // Wektor b
-        vectorLayout   = new QVBoxLayout;
-        auto *vectorGroup = new QGroupBox("Wektor b");
-        vectorGroup->setLayout(vectorLayout);
-        inputLayout->addWidget(vectorGroup);
+        vectorView = new QTableView;
+        vectorView->horizontalHeader()->hide();
+        vectorView->horizontalHeader()->setStretchLastSection(true);
+        vectorView->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+        auto *vectorGroup  = new QGroupBox("Wektor b");
+        auto *vectorLayout = new QVBoxLayout(vectorGroup);
+        vectorLayout->addWidget(vectorView);
+        inputLayout->addWidget(vectorGroup, 1);
     }
     mainLayout->addLayout(inputLayout);
     mainLayout->addSpacing(15);
 
-    // --- Przycisk „Rozwiąż” ---
+    // --- Przyciski „Rozwiąż” / „Przerwij” i postęp rozkładu ---
     {
-        solveButton = new QPushButton("Rozwiąż");
+        solveButton  = new QPushButton("Rozwiąż");
+        cancelButton = new QPushButton("Przerwij");
+        cancelButton->setEnabled(false);
         auto *btnLayout = new QHBoxLayout;
         btnLayout->addStretch(1);
         btnLayout->addWidget(solveButton);
+        btnLayout->addWidget(cancelButton);
         btnLayout->addStretch(1);
         mainLayout->addLayout(btnLayout);
+
+        progressBar = new QProgressBar;
+        progressBar->setFormat("Rozkład: %v / %m kolumn");
+        progressBar->hide();
+        mainLayout->addWidget(progressBar);
     }
+    solveWatcher = new QFutureWatcher<QString>(this);
     mainLayout->addSpacing(15);
 
     // --- Wyniki ---
@@ -213,8 +168,16 @@ MainWindow::MainWindow(QWidget *parent)
             this, &MainWindow::createMatrixInputs);
     connect(dataTypeComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged),
             this, [this]{ createMatrixInputs(matrixSizeSpinBox->value()); });
+    connect(matrixTypeGroup, &QButtonGroup::idClicked,
+            this, [this]{ createMatrixInputs(matrixSizeSpinBox->value()); });
     connect(solveButton, &QPushButton::clicked,
             this, &MainWindow::solveSystem);
+    connect(cancelButton, &QPushButton::clicked,
+            this, &MainWindow::cancelSolve);
+    connect(this, &MainWindow::solveProgress,
+            this, &MainWindow::showSolveProgress);
+    connect(solveWatcher, &QFutureWatcher<QString>::finished,
+            this, &MainWindow::solveFinished);
 
     // Pierwsze wypełnienie pól
     createMatrixInputs(matrixSizeSpinBox->value());
@@ -226,7 +189,13 @@ MainWindow::MainWindow(QWidget *parent)
     resize(900,700);
 }
 
-MainWindow::~MainWindow() = default;
+MainWindow::~MainWindow()
+{
+    // wątek roboczy zgłasza postęp przez this – przerwij i poczekaj na niego
+    if (solveControl)
+        solveControl->cancel();
+    solveWatcher->waitForFinished();
+}
 
 // --- Helpers (normalizeIntervalText i parseInterval – nie ruszamy) ---
 
@@ -266,131 +235,111 @@ void MainWindow::highlightInvalidField(QLineEdit *f, bool ok, const QString &msg
     }
 }
 
-// --- Tworzenie pól macierzy i wektora b ---
+// --- Modele macierzy A i wektora b ---
+// Typ z dataTypeComboBox, układ A z rodzaju macierzy; wartości od zera
 void MainWindow::createMatrixInputs(int size) {
-    // Usuwamy dotychczasowe widgety
-    QLayoutItem *it;
-    while ((it = matrixLayout->takeAt(0))) { delete it->widget(); delete it; }
-    while ((it = vectorLayout->takeAt(0))) { delete it->widget(); delete it; }
-
-    matrixInputs.clear();
-    matrixInputsInterval.clear();
-    vectorInputs.clear();
-    vectorInputsInterval.clear();
-
-    bool isInterval = (dataTypeComboBox->currentIndex() == 2);
-
-    // Macierz A
-    for (int i = 0; i < size; ++i) {
-        QVector<QLineEdit*> row;
-        for (int j = 0; j < size; ++j) {
-            if (isInterval) {
-                // Dla przedziałów zakładamy domyślnie "[0;0]", wpisane jako "0,0"
-                QLineEdit *cell = new QLineEdit("0;0");
-                cell->setFixedWidth(80);
-                cell->setAlignment(Qt::AlignCenter);
-                matrixLayout->addWidget(cell, i, j);
-                row.append(cell);
-            } else {
-                auto *e = new QLineEdit("0");
-                e->setFixedWidth(60);
-                e->setAlignment(Qt::AlignCenter);
-                matrixLayout->addWidget(e, i, j);
-                row.append(e);
-            }
+    if (solveWatcher->isRunning())
+        return;  // solver czyta magazyn bieżących modeli
+
+    const int dtype = dataTypeComboBox->currentIndex();
+    const auto layout = triRadio->isChecked() ? MatrixModel::Layout::Tridiagonal
+                                              : MatrixModel::Layout::Symmetric;
+
+    auto make = [&](int rows, int cols, MatrixModel::Layout l) -> MatrixModel * {
+        switch (dtype) {
+        case 1:  return new TypedMatrixModel<mpreal>(rows, cols, l, this);
+        case 2:  return new TypedMatrixModel<I>(rows, cols, l, this);
+#ifdef CROUT_HAVE_FLOAT128
+        case 3:  return new TypedMatrixModel<__float128>(rows, cols, l, this);
+#endif
+        default: return new TypedMatrixModel<double>(rows, cols, l, this);
         }
-        if (isInterval)
-            matrixInputsInterval.append(row);
-        else
-            matrixInputs.append(row);
-    }
+    };
 
-    // Wektor b
-    if (isInterval) {
-        for (int i = 0; i < size; ++i) {
-            auto *cell = new QLineEdit("0;0");
-            cell->setFixedWidth(80);
-            cell->setAlignment(Qt::AlignCenter);
-            vectorLayout->addWidget(cell);
-            vectorInputsInterval.append(cell);
-        }
-    } else {
-        for (int i = 0; i < size; ++i) {
-            auto *e = new QLineEdit("0");
-            e->setFixedWidth(60);
-            e->setAlignment(Qt::AlignCenter);
-            vectorLayout->addWidget(e);
-            vectorInputs.append(e);
+    MatrixModel *A = nullptr, *b = nullptr;
+    try {
+        A = make(size, size, layout);
+        b = make(size, 1, MatrixModel::Layout::Dense);
+    } catch (const std::bad_alloc &) {
+        delete A;
+        solutionTextEdit->setPlainText(
+            QString("Za mało pamięci na macierz %1×%1 – rozmiar bez zmian.").arg(size));
+        if (matrixModel) {
+            const QSignalBlocker block(matrixSizeSpinBox);
+            matrixSizeSpinBox->setValue(matrixModel->rowCount());
         }
+        return;
     }
-}
 
-// --- Gettery: zwracają macierz / wektor dla double, mpreal i interval ---
-
-QVector<QVector<double>> MainWindow::getMatrixDouble() const {
-    QVector<QVector<double>> M(matrixInputs.size());
-    for (int i = 0; i < M.size(); ++i) {
-        M[i].resize(matrixInputs[i].size());
-        for (int j = 0; j < M[i].size(); ++j) {
-            M[i][j] = matrixInputs[i][j]->text().toDouble();
-        }
-    }
-    return M;
+    // setModel nie usuwa poprzednich modeli selekcji
+    QItemSelectionModel *oldMatrixSelection = matrixView->selectionModel();
+    QItemSelectionModel *oldVectorSelection = vectorView->selectionModel();
+    matrixView->setModel(A);
+    vectorView->setModel(b);
+    delete oldMatrixSelection;
+    delete oldVectorSelection;
+    delete matrixModel;
+    delete vectorModel;
+    matrixModel = A;
+    vectorModel = b;
 }
 
-QVector<double> MainWindow::getVectorDouble() const {
-    QVector<double> v(vectorInputs.size());
-    for (int i = 0; i < v.size(); ++i) {
-        v[i] = vectorInputs[i]->text().toDouble();
-    }
-    return v;
+void MainWindow::setInputsEnabled(bool on)
+{
+    matrixSizeSpinBox->setEnabled(on);
+    dataTypeComboBox->setEnabled(on);
+    symRadio->setEnabled(on);
+    triRadio->setEnabled(on);
+    matrixView->setEnabled(on);
+    vectorView->setEnabled(on);
+    solveButton->setEnabled(on);
 }
 
-QVector<QVector<mpreal>> MainWindow::getMatrixMpreal() const {
-    QVector<QVector<mpreal>> M(matrixInputs.size());
-    for (int i = 0; i < M.size(); ++i) {
-        M[i].resize(matrixInputs[i].size());
-        for (int j = 0; j < M[i].size(); ++j) {
-            M[i][j] = mpreal(matrixInputs[i][j]->text().toStdString());
-        }
-    }
-    return M;
-}
+namespace {
 
-QVector<mpreal> MainWindow::getVectorMpreal() const {
-    QVector<mpreal> v(vectorInputs.size());
-    for (int i = 0; i < v.size(); ++i) {
-        v[i] = mpreal(vectorInputs[i]->text().toStdString());
-    }
-    return v;
-}
+// Pivoty (przekątna U) i x z solvera biblioteki – wprost na magazynie modeli
+template <typename T>
+struct Solution {
+    std::vector<T> pivots;
+    std::vector<T> x;
+};
 
-QVector<QVector<I>> MainWindow::getMatrixInterval() const {
-    QVector<QVector<I>> M(matrixInputsInterval.size());
-    for (int i = 0; i < M.size(); ++i) {
-        M[i].resize(matrixInputsInterval[i].size());
-        for (int j = 0; j < M[i].size(); ++j) {
-            M[i][j] = readIntervalCell(matrixInputsInterval[i][j]);
-        }
+template <typename T>
+Solution<T> solveModels(const MatrixModel *Am, const MatrixModel *bm)
+{
+    const auto &A = static_cast<const TypedMatrixModel<T> &>(*Am);
+    const auto &b = static_cast<const TypedMatrixModel<T> &>(*bm);
+    Solution<T> s;
+    if (A.layout() == MatrixModel::Layout::Tridiagonal) {
+        auto r = solver::tridiagonal::solveCroutTridiagonal(
+            A.subDiagonal(), A.diagonal(), A.superDiagonal(), b.vector());
+        s.pivots = std::move(r.diag);
+        s.x = std::move(r.x);
+    } else {
+        auto r = solver::symmetric::solveCroutSymmetric(A.matrix(), b.vector());
+        s.pivots.reserve(r.n);
+        for (int i = 0; i < r.n; ++i)
+            s.pivots.push_back(std::move(r.U[std::size_t(i) * r.n + i]));
+        s.x = std::move(r.x);
     }
-    return M;
+    return s;
 }
 
-QVector<I> MainWindow::getVectorInterval() const {
-    QVector<I> v(vectorInputsInterval.size());
-    for (int i = 0; i < v.size(); ++i) {
-        v[i] = readIntervalCell(vectorInputsInterval[i]);
-    }
-    return v;
-}
+} // anonymous
 
 
 // --------------------  MainWindow::solveSystem()  --------------------
+// Solver czyta magazyn modeli bez kopiowania; rozkład i formatowanie wyników
+// idą w wątku roboczym (startSolve), a edycja jest na ten czas zablokowana.
 void MainWindow::solveSystem()
 {
-    const int n     = matrixSizeSpinBox->value();
-    const int dtype = dataTypeComboBox->currentIndex();   // 0=double, 1=mpreal, 2=interval
-    const int mtype = matrixTypeGroup->checkedId();       // 0=symetryczna, 1=trójdiagonalna
+    if (solveWatcher->isRunning())
+        return;
+
+    const int n     = matrixModel->rowCount();
+    const int dtype = dataTypeComboBox->currentIndex();   // 0=double, 1=mpreal, 2=interval, 3=__float128
+    const MatrixModel *A = matrixModel;
+    const MatrixModel *b = vectorModel;
 
     solutionTextEdit->clear();
 
@@ -405,170 +354,98 @@ void MainWindow::solveSystem()
     };
     // ──────────────────────────────────────────────────────────────────
 
-    QStringList out;
-    int status = 0;  // 0=OK, 1=szerokość>0 (interval), 2=NaN/Inf (double), 3=singularność
+    // status: 0=OK, 1=szerokość>0 (interval), 2=NaN/Inf (double), 3=singularność
+    std::function<QString()> job;
 
     /* ======================== double ======================== */
     if (dtype == 0) {
-        auto A = getMatrixDouble();
-        auto b = getVectorDouble();
-
-        QVector<QVector<double>> U;
-        QVector<double>          x, y;
-
-        if (mtype == 0) {
-            // Symetryczny
-            std::tie(std::ignore, U, y, x) = solveCroutSymmetric(A, b);
-        } else {
-            // Trójdiagonalny
-            QVector<double> a(n-1), d(n), c(n-1);
-            for (int i = 0; i < n; ++i) {
-                d[i] = A[i][i];
-                if (i < n-1) c[i] = A[i][i+1];
-                if (i > 0)   a[i-1] = A[i][i-1];
-            }
-            QList<double> lq, dq, uq, yq, xq;
-            std::tie(lq, dq, uq, yq, xq)
-                = solveCroutTridiagonal(a, d, c, b);
-
-            U = QVector<QVector<double>>(n, QVector<double>(n,0.0));
-            x.resize(n);
-            for (int i = 0; i < n; ++i) {
-                U[i][i] = dq[i];
-                if (i < n-1) U[i][i+1] = uq[i];
-                x[i] = xq[i];
-            }
-        }
-
-        // 1) NaN/Inf?
-        for (double v : x) {
-            if (std::isnan(v) || std::isinf(v)) {
-                status = 2;
-                break;
-            }
-        }
-        // 2) singularność (pivot==0)
-        if (status == 0) {
-            for (int i = 0; i < n; ++i) {
-                if (U[i][i] == 0.0) {
-                    status = 3;
+        job = [=]() -> QString {
+            const auto s = solveModels<double>(A, b);
+            int status = 0;
+
+            // 1) NaN/Inf?
+            for (double v : s.x) {
+                if (std::isnan(v) || std::isinf(v)) {
+                    status = 2;
                     break;
                 }
             }
-        }
-        // 3) wypisz tylko, gdy OK
-        if (status == 0) {
+            // 2) singularność (pivot==0)
+            if (status == 0) {
+                for (double p : s.pivots) {
+                    if (p == 0.0) {
+                        status = 3;
+                        break;
+                    }
+                }
+            }
+            // 3) wypisz tylko, gdy OK
+            if (status != 0)
+                return QString("st = %1").arg(status);
+            QStringList out;
             for (int i = 0; i < n; ++i) {
-                QString xs = pad3(QString::asprintf("%.14E", x[i]).toUpper());
+                QString xs = pad3(QString::asprintf("%.14E", s.x[i]).toUpper());
                 out << QString("x[%1]=%2").arg(i+1).arg(xs);
             }
-            solutionTextEdit->setPlainText(out.join('\n'));
-        } else {
-            solutionTextEdit->setPlainText(QString("st = %1").arg(status));
-        }
-        return;
+            return out.join('\n');
+        };
     }
 
     /* ======================= mpreal ======================== */
     else if (dtype == 1) {
         using mp = mpfr::mpreal;
-        auto A = getMatrixMpreal();
-        auto b = getVectorMpreal();
-
-        QVector<QVector<mp>> U;
-        QVector<mp>          x, y;
-
-        if (mtype == 0) {
-            std::tie(std::ignore, U, y, x) = solveCroutSymmetric(A, b);
-        } else {
-            QVector<mp> a(n-1), d(n), c(n-1);
-            for (int i = 0; i < n; ++i) {
-                d[i] = A[i][i];
-                if (i < n-1) c[i] = A[i][i+1];
-                if (i > 0)   a[i-1] = A[i][i-1];
+        // domyślna precyzja MPFR jest osobna w każdym wątku
+        const mp_prec_t prec = mp::get_default_prec();
+
+        job = [=]() -> QString {
+            mp::set_default_prec(prec);
+            // wszystkie mpreal rozwiązania w arenie wątku roboczego; reset przy wyjściu
+            utils::MpArenaScope arena;
+            const auto s = solveModels<mp>(A, b);
+
+            // singularność (pivot==0)
+            for (const mp &p : s.pivots) {
+                if (p == mp(0))
+                    return QString("st = %1").arg(3);
             }
-            QList<mp> lq, dq, uq, yq, xq;
-            std::tie(lq, dq, uq, yq, xq)
-                = solveCroutTridiagonal(a, d, c, b);
-
-            U = QVector<QVector<mp>>(n, QVector<mp>(n,0));
-            x.resize(n);
-            for (int i = 0; i < n; ++i) {
-                U[i][i] = dq[i];
-                if (i < n-1) U[i][i+1] = uq[i];
-                x[i] = xq[i];
-            }
-        }
-
-        // singularność (pivot==0)
-        for (int i = 0; i < n && status == 0; ++i) {
-            if (U[i][i] == mp(0)) {
-                status = 3;
-                break;
-            }
-        }
-        if (status == 0) {
+            QStringList out;
             for (int i = 0; i < n; ++i) {
-                QString xs = pad3(QString::asprintf("%.14E", x[i].toDouble()).toUpper());
+                QString xs = pad3(QString::asprintf("%.14E", s.x[i].toDouble()).toUpper());
                 out << QString("x[%1]=%2").arg(i+1).arg(xs);
             }
-            solutionTextEdit->setPlainText(out.join('\n'));
-        } else {
-            solutionTextEdit->setPlainText(QString("st = %1").arg(status));
-        }
-        return;
+            return out.join('\n');
+        };
     }
 
     /* ===================== Interval ======================= */
     else if (dtype == 2) {
-        using I = IA::Interval<mpfr::mpreal>;
-
-        // 0. Pobranie przedziałów z GUI
-        const auto A = getMatrixInterval();
-        const auto b = getVectorInterval();
-
-        QVector<QVector<I>> U;
-        QVector<I>          x, y;
-        if (mtype == 0) {
-            std::tie(std::ignore, U, y, x) = solveCroutSymmetric(A, b);
-        } else {
-            QVector<I> a(n-1), d(n), c(n-1);
-            for (int i = 0; i < n; ++i) {
-                d[i] = A[i][i];
-                if (i < n-1) c[i] = A[i][i+1];
-                if (i > 0)   a[i-1] = A[i][i-1];
+        const mp_prec_t prec = mpfr::mpreal::get_default_prec();
+
+        job = [=]() -> QString {
+            mpfr::mpreal::set_default_prec(prec);
+            utils::MpArenaScope arena;
+            auto s = solveModels<I>(A, b);
+
+            // 1. Pivot zawierający zero (trójdiagonalna zwraca wtedy x z NaN)
+            //    albo wynik zawierający zero → singularność
+            for (const I &p : s.pivots) {
+                if (p.containsZero())
+                    return QString("st = %1").arg(3);
             }
-            QList<I> lq, dq, uq, yq, xq;
-            std::tie(lq, dq, uq, yq, xq) = solveCroutTridiagonal(a, d, c, b);
-            U = QVector<QVector<I>>(n, QVector<I>(n));
-            x.resize(n);
-            for (int i = 0; i < n; ++i) {
-                U[i][i] = dq[i];
-                if (i < n-1) U[i][i+1] = uq[i];
-                x[i] = xq[i];
-            }
-        }
-
-        // 1. Sprawdzenie, czy któryś wynik zawiera zero → singularność
-        if (status == 0) {
-            for (int i = 0; i < n; ++i) {
-                if (x[i].containsZero()) {
-                    status = 3;
-                    break;
-                }
+            for (const I &v : s.x) {
+                if (v.containsZero())
+                    return QString("st = %1").arg(3);
             }
-        }
 
-        // 2. Przygotowanie wyników do wyświetlenia lub st = kod błędu
-        if (status == 0) {
+            // 2. Przygotowanie wyników do wyświetlenia
             const mpfr::mpreal EPS = mpfr::pow(mpreal(2), -100);  // ~7.9e-31
 
             QStringList lines;
             for (int i = 0; i < n; ++i) {
                 std::string ls, rs;
-                x[i].IEndsToStrings(ls, rs);
+                s.x[i].IEndsToStrings(ls, rs);
 
-                mpfr::mpreal w = x[i].GetWidth();
+                mpfr::mpreal w = s.x[i].GetWidth();
                 if (w < 0) w = -w;
 
                 QString wtxt;
@@ -586,10 +463,100 @@ void MainWindow::solveSystem()
                              .arg(QString::fromStdString(rs).toUpper())
                              .arg(wtxt);
             }
-            solutionTextEdit->setPlainText(lines.join('\n'));
-        } else {
-            solutionTextEdit->setPlainText(QString("st = %1").arg(status));
-        }
-        return;
+            return lines.join('\n');
+        };
     }
+
+#ifdef CROUT_HAVE_FLOAT128
+    /* ===================== __float128 ===================== */
+    else if (dtype == 3) {
+        using Q = __float128;
+
+        job = [=]() -> QString {
+            const auto s = solveModels<Q>(A, b);
+            int status = 0;
+
+            // 1) NaN/Inf?
+            for (Q v : s.x) {
+                if (!float128::isFinite(v)) {
+                    status = 2;
+                    break;
+                }
+            }
+            // 2) singularność (pivot==0)
+            if (status == 0) {
+                for (Q p : s.pivots) {
+                    if (p == 0) {
+                        status = 3;
+                        break;
+                    }
+                }
+            }
+            // 3) pełne 34 cyfry znaczące
+            if (status != 0)
+                return QString("st = %1").arg(status);
+            QStringList out;
+            for (int i = 0; i < n; ++i) {
+                QString xs = pad3(QString::fromStdString(float128::toString(s.x[i])).toUpper());
+                out << QString("x[%1]=%2").arg(i+1).arg(xs);
+            }
+            return out.join('\n');
+        };
+    }
+#endif
+
+    if (job)
+        startSolve(std::move(job));
+}
+
+// --- Rozwiązanie w wątku z QThreadPool ---
+
+void MainWindow::startSolve(std::function<QString()> job)
+{
+    // Sterowanie żyje, dopóki trzyma je wątek roboczy albo okno
+    auto control = std::make_shared<utils::SolveControl>();
+    control->onProgress = [this](std::int64_t done, std::int64_t total) {
+        emit solveProgress(done, total);  // z wątku roboczego → połączenie kolejkowane
+    };
+    solveControl = control;
+
+    setInputsEnabled(false);
+    cancelButton->setEnabled(true);
+    progressBar->setRange(0, 0);  // do pierwszego punktu kontrolnego – wskaźnik zajętości
+    progressBar->show();
+
+    solveWatcher->setFuture(QtConcurrent::run([job = std::move(job), control]() -> QString {
+        utils::control::Scope scope(*control);
+        try {
+            return job();
+        } catch (const utils::SolveCancelled &) {
+            return QStringLiteral("Przerwano.");
+        } catch (const solver::ZeroPivot &) {
+            return QStringLiteral("st = 3");
+        } catch (const std::exception &e) {
+            return QStringLiteral("Błąd: %1").arg(QString::fromUtf8(e.what()));
+        }
+    }));
+}
+
+void MainWindow::cancelSolve()
+{
+    if (solveControl)
+        solveControl->cancel();
+    cancelButton->setEnabled(false);
+}
+
+void MainWindow::showSolveProgress(qint64 done, qint64 total)
+{
+    progressBar->setRange(0, int(total));
+    progressBar->setValue(int(done));
+}
+
+void MainWindow::solveFinished()
+{
+    solutionTextEdit->setPlainText(solveWatcher->result());
+    solveControl.reset();
+    progressBar->hide();
+    cancelButton->setEnabled(false);
+    setInputsEnabled(true);
 }
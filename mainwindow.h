@@ -14,9 +14,18 @@
 #include <QVBoxLayout>    // <-- nowy
 #include <QHBoxLayout>
 #include <QGroupBox>
+#include <QTableView>
+#include <QProgressBar>
+#include <QFutureWatcher>
+
+#include <functional>
+#include <memory>
 
 #include "interval.hpp"
+#include "float128.hpp"
 
+namespace utils { class SolveControl; }
+class MatrixModel;
 
 class MainWindow : public QMainWindow {
     Q_OBJECT
@@ -25,23 +34,26 @@ public:
     explicit MainWindow(QWidget *parent = nullptr);
     ~MainWindow() override;
 
+signals:
+    // Z wątku roboczego: kolumny rozkładu gotowe / n
+    void solveProgress(qint64 done, qint64 total);
+
 private slots:
     void createMatrixInputs(int size);
     void solveSystem();
+    void cancelSolve();
+    void showSolveProgress(qint64 done, qint64 total);
+    void solveFinished();
 
 private:
-    // Gettery
-    QVector<QVector<double>> getMatrixDouble() const;
-    QVector<double>          getVectorDouble() const;
-    QVector<QVector<mpfr::mpreal>> getMatrixMpreal() const;
-    QVector<mpfr::mpreal>         getVectorMpreal() const;
-    QVector<QVector<interval_arithmetic::Interval<mpfr::mpreal>>> getMatrixInterval() const;
-    QVector<interval_arithmetic::Interval<mpfr::mpreal>>         getVectorInterval() const;
-
     // Pomocnicze
     QString normalizeIntervalText(const QString &text) const;
     bool parseInterval(const QString &text, interval_arithmetic::Interval<mpfr::mpreal> &out) const;
     void highlightInvalidField(QLineEdit *f, bool ok, const QString &msg = {}) const;
+    // Uruchamia job (rozkład + tekst wyników) w QThreadPool; wynik trafia do solveFinished
+    void startSolve(std::function<QString()> job);
+    // Rozmiar, typ, rodzaj i edycja macierzy (na czas rozwiązania wyłączone)
+    void setInputsEnabled(bool on);
 
     // GUI
     QSpinBox    *matrixSizeSpinBox;
@@ -49,17 +61,20 @@ private:
     QRadioButton *symRadio, *triRadio;
     QButtonGroup *matrixTypeGroup;
     QPushButton *solveButton;
+    QPushButton *cancelButton;
+    QProgressBar *progressBar;
     QTextEdit   *solutionTextEdit;
 
-    QGridLayout *matrixLayout;
-    QVBoxLayout *vectorLayout;
+    // Bieżące rozwiązanie w tle (solveControl pusty, gdy nic nie działa)
+    QFutureWatcher<QString> *solveWatcher;
+    std::shared_ptr<utils::SolveControl> solveControl;
 
-    // Wartości wpisane przez użytkownika
-    QVector<QVector<QLineEdit*>> matrixInputs;          // double / mp
-QVector<QVector<QLineEdit*>> matrixInputsInterval;  // jedna kratka na element
+    QTableView  *matrixView;
+    QTableView  *vectorView;
 
-QVector<QLineEdit*>          vectorInputs;          // double / mp
-QVector<QLineEdit*>          vectorInputsInterval;  // jedna kratka na element
+    // Wartości wpisane przez użytkownika (matrix_model.h); typ według dataTypeComboBox
+    MatrixModel *matrixModel = nullptr;
+    MatrixModel *vectorModel = nullptr;
 };
 
 #endif // MAINWINDOW_H
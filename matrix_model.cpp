@@ -0,0 +1,172 @@
+#include "matrix_model.h"
+
+#include <limits>
+#include <QLocale>
+#include <QRegularExpression>
+
+using I = interval_arithmetic::Interval<mpfr::mpreal>;
+using mpfr::mpreal;
+
+MatrixModel::MatrixModel(int rows, int cols, Layout layout, QObject *parent)
+    : QAbstractTableModel(parent), rows_(rows), cols_(cols), layout_(layout)
+{
+}
+
+std::size_t MatrixModel::storageSize() const
+{
+    if (layout_ == Layout::Tridiagonal)
+        return rows_ > 0 ? std::size_t(3) * rows_ - 2 : 0;
+    return std::size_t(rows_) * std::size_t(cols_);
+}
+
+std::ptrdiff_t MatrixModel::slot(int i, int j) const
+{
+    if (layout_ != Layout::Tridiagonal)
+        return std::ptrdiff_t(i) * cols_ + j;
+    // a (n-1) | d (n) | c (n-1)
+    const std::ptrdiff_t n = rows_;
+    if (j == i - 1)
+        return j;
+    if (j == i)
+        return n - 1 + i;
+    if (j == i + 1)
+        return 2 * n - 1 + i;
+    return -1;
+}
+
+int MatrixModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : rows_;
+}
+
+int MatrixModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : cols_;
+}
+
+QVariant MatrixModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid())
+        return {};
+    if (role == Qt::TextAlignmentRole)
+        return int(Qt::AlignCenter);
+    if (role != Qt::DisplayRole && role != Qt::EditRole)
+        return {};
+    const std::ptrdiff_t k = slot(index.row(), index.column());
+    return k < 0 ? QVariant() : QVariant(text(std::size_t(k)));
+}
+
+bool MatrixModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if (!index.isValid() || role != Qt::EditRole)
+        return false;
+    const int i = index.row(), j = index.column();
+    const std::ptrdiff_t k = slot(i, j);
+    if (k < 0)
+        return false;
+
+    // Zatwierdzenie edytora bez zmian nie parsuje ponownie – przedział
+    // z zapisem dziesiętnym poszerzałby się o eps przy każdej edycji
+    const QString s = value.toString().trimmed();
+    if (s == text(std::size_t(k)))
+        return true;
+    if (!parse(std::size_t(k), s))
+        return false;
+    emit dataChanged(index, index, {Qt::DisplayRole, Qt::EditRole});
+
+    if (layout_ == Layout::Symmetric && i != j) {
+        copy(std::size_t(slot(j, i)), std::size_t(k));
+        const QModelIndex mirror = this->index(j, i);
+        emit dataChanged(mirror, mirror, {Qt::DisplayRole, Qt::EditRole});
+    }
+    return true;
+}
+
+Qt::ItemFlags MatrixModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid() || slot(index.row(), index.column()) < 0)
+        return Qt::NoItemFlags;
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsEditable;
+}
+
+// --- Konwersje komórek ---
+
+QString cellText(double v)
+{
+    return QString::number(v, 'g', QLocale::FloatingPointShortest);
+}
+
+bool parseCell(const QString &s, double &out)
+{
+    bool ok = false;
+    out = s.toDouble(&ok);
+    return ok;
+}
+
+QString cellText(const mpreal &v)
+{
+    return QString::fromStdString(v.toString());
+}
+
+bool parseCell(const QString &s, mpreal &out)
+{
+    // cały tekst musi być liczbą; precyzja domyślna wątku GUI
+    return mpfr_set_str(out.mpfr_ptr(), s.toStdString().c_str(), 10, mpreal::get_default_rnd()) == 0;
+}
+
+QString cellText(const I &v)
+{
+    auto tmp = v;  // IEndsToStrings nie jest const
+    std::string left, right;
+    tmp.IEndsToStrings(left, right);
+    if (left == right)
+        return QString::fromStdString(left).toUpper();
+    return QString("%1;%2").arg(QString::fromStdString(left).toUpper(),
+                                QString::fromStdString(right).toUpper());
+}
+
+/*--------------------------------------------------------------*/
+/*  Tekst komórki jako IA::Interval                              */
+/*  Separator dziesiętny: '.'                                    */
+/*  Separator przedziału: ';'                                    */
+/*--------------------------------------------------------------*/
+bool parseCell(const QString &s, I &out)
+{
+    // 1) Usuń białe znaki:
+    const QString txt = QString(s).replace(QRegularExpression("\\s+"), "");
+    // 2) Rozdziel tylko po średniku ';'
+    const auto parts = txt.split(';', Qt::SkipEmptyParts);
+    if (parts.size() != 1 && parts.size() != 2)
+        return false;
+
+    // Maszynowe epsilon dla mpreal (~2^(-precision))
+    static const mpreal eps = std::numeric_limits<mpfr::mpreal>::epsilon();
+    // Jeśli w zapisie jest kropka '.' lub 'e'/'E', traktujemy to jako "zmiennoprzecinkowe"
+    auto isFloat = [](const QString &p) { return p.contains('.') || p.contains('e', Qt::CaseInsensitive); };
+
+    mpreal a, b;
+    if (!parseCell(parts[0], a) || !parseCell(parts.back(), b))
+        return false;
+    if (a > b)
+        std::swap(a, b);
+
+    // Punktowy wpis całkowity ("2" albo "2;2") → zero‐width; w każdej innej
+    // sytuacji przedział rozszerzony o eps → szerokość > 0
+    if (a == b && !isFloat(parts[0]) && !isFloat(parts.back()))
+        out = I(a, a);
+    else
+        out = I(a - eps, b + eps);
+    return true;
+}
+
+#ifdef CROUT_HAVE_FLOAT128
+QString cellText(__float128 v)
+{
+    return QString::fromStdString(float128::toString(v)).toUpper();
+}
+
+bool parseCell(const QString &s, __float128 &out)
+{
+    return float128::parse(s.toStdString(), out);
+}
+#endif
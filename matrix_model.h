@@ -0,0 +1,111 @@
+#ifndef MATRIX_MODEL_H
+#define MATRIX_MODEL_H
+
+#include <cstddef>
+#include <vector>
+#include <QAbstractTableModel>
+#include <QString>
+
+#include "solver/crout_types.h"
+#include "interval.hpp"
+#include "float128.hpp"
+
+/**
+ * Edytor macierzy model/widok: QTableView rysuje tylko widoczne komórki, więc
+ * rozmiar nie zależy od liczby widżetów. Wartości leżą w ciągłym magazynie
+ * w postaci, którą solvery biblioteki przyjmują bez kopiowania (MatrixView,
+ * Span); tekst parsowany jest raz, przy edycji komórki.
+ *
+ * Układy magazynu:
+ *   Dense       – rows × cols wierszami (także wektor b jako n × 1),
+ *   Symmetric   – n × n wierszami; zapis (i, j) ustawia też (j, i),
+ *   Tridiagonal – a (n-1) | d (n) | c (n-1) jednym ciągiem; komórek poza
+ *                 pasmem nie ma w pamięci – w widoku są puste i nieedytowalne.
+ */
+class MatrixModel : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    enum class Layout { Dense, Symmetric, Tridiagonal };
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+    Layout layout() const { return layout_; }
+
+protected:
+    MatrixModel(int rows, int cols, Layout layout, QObject *parent);
+
+    // Liczba elementów magazynu dla układu
+    std::size_t storageSize() const;
+    // Indeks komórki (i, j) w magazynie; −1 poza pasmem
+    std::ptrdiff_t slot(int i, int j) const;
+
+    virtual QString text(std::size_t k) const = 0;
+    // false: niepoprawny tekst, wartość bez zmian
+    virtual bool parse(std::size_t k, const QString &s) = 0;
+    virtual void copy(std::size_t to, std::size_t from) = 0;
+
+    int rows_, cols_;
+    Layout layout_;
+};
+
+// Konwersje tekst ↔ wartość komórki dla typów GUI
+QString cellText(double v);
+bool parseCell(const QString &s, double &out);
+QString cellText(const mpfr::mpreal &v);
+bool parseCell(const QString &s, mpfr::mpreal &out);
+QString cellText(const interval_arithmetic::Interval<mpfr::mpreal> &v);
+bool parseCell(const QString &s, interval_arithmetic::Interval<mpfr::mpreal> &out);
+#ifdef CROUT_HAVE_FLOAT128
+QString cellText(__float128 v);
+bool parseCell(const QString &s, __float128 &out);
+#endif
+
+template <typename T>
+class TypedMatrixModel : public MatrixModel {
+public:
+    TypedMatrixModel(int rows, int cols, Layout layout, QObject *parent = nullptr)
+        : MatrixModel(rows, cols, layout, parent), values_(storageSize())
+    {
+    }
+
+    // Widoki na magazyn dla solverów; ważne, dopóki model żyje i nie jest edytowany
+    solver::MatrixView<const T> matrix() const
+    {
+        return solver::MatrixView<const T>(values_.data(), rows_, cols_);
+    }
+    solver::Span<const T> vector() const { return solver::Span<const T>(values_.data(), values_.size()); }
+
+    // Tridiagonal: pod-przekątna, przekątna, nad-przekątna
+    solver::Span<const T> subDiagonal() const { return band(0, rows_ - 1); }
+    solver::Span<const T> diagonal() const { return band(std::size_t(rows_ - 1), rows_); }
+    solver::Span<const T> superDiagonal() const { return band(std::size_t(2 * rows_ - 1), rows_ - 1); }
+
+protected:
+    QString text(std::size_t k) const override { return cellText(values_[k]); }
+
+    bool parse(std::size_t k, const QString &s) override
+    {
+        T v;
+        if (!parseCell(s, v))
+            return false;
+        values_[k] = std::move(v);
+        return true;
+    }
+
+    void copy(std::size_t to, std::size_t from) override { values_[to] = values_[from]; }
+
+private:
+    solver::Span<const T> band(std::size_t offset, int size) const
+    {
+        return solver::Span<const T>(values_.data() + offset, std::size_t(size));
+    }
+
+    std::vector<T> values_;
+};
+
+#endif // MATRIX_MODEL_H
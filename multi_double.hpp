@@ -0,0 +1,417 @@
+#ifndef MULTI_DOUBLE_HPP
+#define MULTI_DOUBLE_HPP
+
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include "mpreal.h"
+
+// Typy double-double (~106 bitów) i quad-double (~212 bitów) zbudowane na
+// przekształceniach bezbłędnych (TwoSum/TwoProd), wg Hida, Li, Bailey (biblioteka QD).
+// Wymagają ścisłej arytmetyki IEEE – nie kompilować z -ffast-math.
+namespace multidouble {
+
+namespace eft {
+
+// s + e = a + b dokładnie
+inline double twoSum(double a, double b, double &e)
+{
+    double s = a + b;
+    double bb = s - a;
+    e = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+// jak twoSum, ale zakłada |a| >= |b|
+inline double quickTwoSum(double a, double b, double &e)
+{
+    double s = a + b;
+    e = b - (s - a);
+    return s;
+}
+
+// p + e = a·b dokładnie; z FMA sprzętowym jedna instrukcja, inaczej podział Dekkera
+inline double twoProd(double a, double b, double &e)
+{
+    double p = a * b;
+#ifdef FP_FAST_FMA
+    e = std::fma(a, b, -p);
+#else
+    constexpr double split = 134217729.0;  // 2^27 + 1
+    double t = split * a, ah = t - (t - a), al = a - ah;
+    t = split * b;
+    double bh = t - (t - b), bl = b - bh;
+    e = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+#endif
+    return p;
+}
+
+inline void threeSum(double &a, double &b, double &c)
+{
+    double t1, t2, t3;
+    t1 = twoSum(a, b, t2);
+    a  = twoSum(c, t1, t3);
+    b  = twoSum(t2, t3, c);
+}
+
+inline void threeSum2(double &a, double &b, double &c)
+{
+    double t1, t2, t3;
+    t1 = twoSum(a, b, t2);
+    a  = twoSum(c, t1, t3);
+    b  = t2 + t3;
+}
+
+inline void renorm(double &c0, double &c1, double &c2, double &c3, double &c4)
+{
+    if (std::isinf(c0))
+        return;
+    double s0, s1, s2 = 0.0, s3 = 0.0;
+    s0 = quickTwoSum(c3, c4, c4);
+    s0 = quickTwoSum(c2, s0, c3);
+    s0 = quickTwoSum(c1, s0, c2);
+    c0 = quickTwoSum(c0, s0, c1);
+
+    s0 = c0;
+    s1 = c1;
+    if (s1 != 0.0) {
+        s1 = quickTwoSum(s1, c2, s2);
+        if (s2 != 0.0) {
+            s2 = quickTwoSum(s2, c3, s3);
+            if (s3 != 0.0)
+                s3 += c4;
+            else
+                s2 = quickTwoSum(s2, c4, s3);
+        } else {
+            s1 = quickTwoSum(s1, c3, s2);
+            if (s2 != 0.0)
+                s2 = quickTwoSum(s2, c4, s3);
+            else
+                s1 = quickTwoSum(s1, c4, s2);
+        }
+    } else {
+        s0 = quickTwoSum(s0, c2, s1);
+        if (s1 != 0.0) {
+            s1 = quickTwoSum(s1, c3, s2);
+            if (s2 != 0.0)
+                s2 = quickTwoSum(s2, c4, s3);
+            else
+                s1 = quickTwoSum(s1, c4, s2);
+        } else {
+            s0 = quickTwoSum(s0, c3, s1);
+            if (s1 != 0.0)
+                s1 = quickTwoSum(s1, c4, s2);
+            else
+                s0 = quickTwoSum(s0, c4, s1);
+        }
+    }
+    c0 = s0; c1 = s1; c2 = s2; c3 = s3;
+}
+
+// Dokładna suma składowych w mpreal; 2100 bitów obejmuje cały zakres wykładników double
+inline mpfr::mpreal exactSum(const double *c, int n, mpfr_prec_t prec)
+{
+    mpfr::mpreal acc(0, 2100);
+    for (int i = 0; i < n; ++i)
+        acc += c[i];
+    acc.set_prec(prec);
+    return acc;
+}
+
+} // namespace eft
+
+/**
+ * Double-double: hi + lo, |lo| <= ulp(hi)/2. Operacje bez rozgałęzień,
+ * więc pętle po tablicach DoubleDouble dają się wektoryzować.
+ */
+struct DoubleDouble {
+    double hi = 0.0, lo = 0.0;
+
+    static constexpr int digits = 106;
+
+    DoubleDouble() = default;
+    constexpr DoubleDouble(double h) : hi(h), lo(0.0) {}
+    constexpr DoubleDouble(int h) : hi(h), lo(0.0) {}
+    constexpr DoubleDouble(double h, double l) : hi(h), lo(l) {}
+
+    explicit DoubleDouble(const mpfr::mpreal &v) {
+        mpfr::mpreal r(v);
+        r.set_prec(2100);  // zwiększenie precyzji jest dokładne
+        hi = r.toDouble(); r -= hi;
+        lo = r.toDouble();
+    }
+
+    double toDouble() const { return hi + lo; }
+    mpfr::mpreal toMpreal(mpfr_prec_t prec = digits) const {
+        const double c[2] = {hi, lo};
+        return eft::exactSum(c, 2, prec);
+    }
+    std::string toString(const std::string &format = "%.32Re") const {
+        return toMpreal().toString(format);
+    }
+
+    bool isZero() const { return hi == 0.0; }
+    bool isNan() const { return std::isnan(hi); }
+};
+
+inline DoubleDouble operator+(const DoubleDouble &a, const DoubleDouble &b)
+{
+    double t1, t2;
+    double s1 = eft::twoSum(a.hi, b.hi, t1);
+    double s2 = eft::twoSum(a.lo, b.lo, t2);
+    t1 += s2;
+    s1 = eft::quickTwoSum(s1, t1, t1);
+    t1 += t2;
+    s1 = eft::quickTwoSum(s1, t1, t1);
+    return {s1, t1};
+}
+
+inline DoubleDouble operator-(const DoubleDouble &a)
+{
+    return {-a.hi, -a.lo};
+}
+
+inline DoubleDouble operator-(const DoubleDouble &a, const DoubleDouble &b)
+{
+    return a + (-b);
+}
+
+inline DoubleDouble operator*(const DoubleDouble &a, const DoubleDouble &b)
+{
+    double e;
+    double p = eft::twoProd(a.hi, b.hi, e);
+    e += a.hi * b.lo + a.lo * b.hi;
+    p = eft::quickTwoSum(p, e, e);
+    return {p, e};
+}
+
+inline DoubleDouble operator*(const DoubleDouble &a, double b)
+{
+    double e;
+    double p = eft::twoProd(a.hi, b, e);
+    e += a.lo * b;
+    p = eft::quickTwoSum(p, e, e);
+    return {p, e};
+}
+
+inline DoubleDouble operator/(const DoubleDouble &a, const DoubleDouble &b)
+{
+    // trzy ilorazy cząstkowe (wariant "accurate" z QD)
+    double q1 = a.hi / b.hi;
+    DoubleDouble r = a - b * q1;
+    double q2 = r.hi / b.hi;
+    r = r - b * q2;
+    double q3 = r.hi / b.hi;
+    q1 = eft::quickTwoSum(q1, q2, q2);
+    return DoubleDouble(q1, q2) + DoubleDouble(q3);
+}
+
+inline DoubleDouble &operator+=(DoubleDouble &a, const DoubleDouble &b) { return a = a + b; }
+inline DoubleDouble &operator-=(DoubleDouble &a, const DoubleDouble &b) { return a = a - b; }
+inline DoubleDouble &operator*=(DoubleDouble &a, const DoubleDouble &b) { return a = a * b; }
+inline DoubleDouble &operator/=(DoubleDouble &a, const DoubleDouble &b) { return a = a / b; }
+
+inline bool operator==(const DoubleDouble &a, const DoubleDouble &b) { return a.hi == b.hi && a.lo == b.lo; }
+inline bool operator!=(const DoubleDouble &a, const DoubleDouble &b) { return !(a == b); }
+inline bool operator<(const DoubleDouble &a, const DoubleDouble &b) { return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo); }
+inline bool operator>(const DoubleDouble &a, const DoubleDouble &b) { return b < a; }
+
+inline DoubleDouble abs(const DoubleDouble &a) { return a.hi < 0.0 ? -a : a; }
+
+inline std::ostream &operator<<(std::ostream &os, const DoubleDouble &v)
+{
+    return os << v.toMpreal();
+}
+
+/**
+ * Quad-double: x0 + x1 + x2 + x3, składowe nienakładające się.
+ * Dodawanie w wariancie "sloppy" z QD (błąd względem |a|+|b|), które
+ * wystarcza dla rozkładów LU; renormalizacja ma rozgałęzienia, więc
+ * QuadDouble wektoryzuje się gorzej niż DoubleDouble.
+ */
+struct QuadDouble {
+    double x[4] = {0.0, 0.0, 0.0, 0.0};
+
+    static constexpr int digits = 212;
+
+    QuadDouble() = default;
+    constexpr QuadDouble(double a) : x{a, 0.0, 0.0, 0.0} {}
+    constexpr QuadDouble(int a) : x{double(a), 0.0, 0.0, 0.0} {}
+    constexpr QuadDouble(double a, double b, double c, double d) : x{a, b, c, d} {}
+    constexpr QuadDouble(const DoubleDouble &d) : x{d.hi, d.lo, 0.0, 0.0} {}
+
+    explicit QuadDouble(const mpfr::mpreal &v) {
+        mpfr::mpreal r(v);
+        r.set_prec(2100);
+        for (double &c : x) {
+            c = r.toDouble();
+            r -= c;
+        }
+    }
+
+    double operator[](int i) const { return x[i]; }
+
+    double toDouble() const { return x[0] + (x[1] + (x[2] + x[3])); }
+    mpfr::mpreal toMpreal(mpfr_prec_t prec = digits) const {
+        return eft::exactSum(x, 4, prec);
+    }
+    std::string toString(const std::string &format = "%.64Re") const {
+        return toMpreal().toString(format);
+    }
+
+    bool isZero() const { return x[0] == 0.0; }
+    bool isNan() const { return std::isnan(x[0]); }
+};
+
+inline QuadDouble operator+(const QuadDouble &a, const QuadDouble &b)
+{
+    double t0, t1, t2, t3;
+    double s0 = eft::twoSum(a[0], b[0], t0);
+    double s1 = eft::twoSum(a[1], b[1], t1);
+    double s2 = eft::twoSum(a[2], b[2], t2);
+    double s3 = eft::twoSum(a[3], b[3], t3);
+
+    s1 = eft::twoSum(s1, t0, t0);
+    eft::threeSum(s2, t0, t1);
+    eft::threeSum2(s3, t0, t2);
+    t0 = t0 + t1 + t3;
+
+    eft::renorm(s0, s1, s2, s3, t0);
+    return {s0, s1, s2, s3};
+}
+
+inline QuadDouble operator-(const QuadDouble &a)
+{
+    return {-a[0], -a[1], -a[2], -a[3]};
+}
+
+inline QuadDouble operator-(const QuadDouble &a, const QuadDouble &b)
+{
+    return a + (-b);
+}
+
+inline QuadDouble operator*(const QuadDouble &a, double b)
+{
+    double q0, q1, q2;
+    double p0 = eft::twoProd(a[0], b, q0);
+    double p1 = eft::twoProd(a[1], b, q1);
+    double p2 = eft::twoProd(a[2], b, q2);
+    double p3 = a[3] * b;
+
+    double s0 = p0, s2;
+    double s1 = eft::twoSum(q0, p1, s2);
+    eft::threeSum(s2, q1, p2);
+    eft::threeSum2(q1, q2, p3);
+    double s3 = q1;
+    double s4 = q2 + p2;
+
+    eft::renorm(s0, s1, s2, s3, s4);
+    return {s0, s1, s2, s3};
+}
+
+inline QuadDouble operator*(const QuadDouble &a, const QuadDouble &b)
+{
+    double q0, q1, q2, q3, q4, q5;
+    double p0 = eft::twoProd(a[0], b[0], q0);
+    double p1 = eft::twoProd(a[0], b[1], q1);
+    double p2 = eft::twoProd(a[1], b[0], q2);
+    double p3 = eft::twoProd(a[0], b[2], q3);
+    double p4 = eft::twoProd(a[1], b[1], q4);
+    double p5 = eft::twoProd(a[2], b[0], q5);
+
+    eft::threeSum(p1, p2, q0);
+
+    // suma sześciu składników rzędu eps² do trzech: (p2,q1,q2) + (p3,p4,p5)
+    eft::threeSum(p2, q1, q2);
+    eft::threeSum(p3, p4, p5);
+    double t0, t1;
+    double s0 = eft::twoSum(p2, p3, t0);
+    double s1 = eft::twoSum(q1, p4, t1);
+    double s2 = q2 + p5;
+    s1 = eft::twoSum(s1, t0, t0);
+    s2 += (t0 + t1);
+
+    // składniki rzędu eps³
+    s1 += a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0] + q0 + q3 + q4 + q5;
+
+    eft::renorm(p0, p1, s0, s1, s2);
+    return {p0, p1, s0, s1};
+}
+
+inline QuadDouble operator/(const QuadDouble &a, const QuadDouble &b)
+{
+    double q0 = a[0] / b[0];
+    QuadDouble r = a - b * q0;
+    double q1 = r[0] / b[0];
+    r = r - b * q1;
+    double q2 = r[0] / b[0];
+    r = r - b * q2;
+    double q3 = r[0] / b[0];
+    r = r - b * q3;
+    double q4 = r[0] / b[0];
+
+    eft::renorm(q0, q1, q2, q3, q4);
+    return {q0, q1, q2, q3};
+}
+
+inline QuadDouble &operator+=(QuadDouble &a, const QuadDouble &b) { return a = a + b; }
+inline QuadDouble &operator-=(QuadDouble &a, const QuadDouble &b) { return a = a - b; }
+inline QuadDouble &operator*=(QuadDouble &a, const QuadDouble &b) { return a = a * b; }
+inline QuadDouble &operator/=(QuadDouble &a, const QuadDouble &b) { return a = a / b; }
+
+inline bool operator==(const QuadDouble &a, const QuadDouble &b)
+{
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2] && a[3] == b[3];
+}
+inline bool operator!=(const QuadDouble &a, const QuadDouble &b) { return !(a == b); }
+inline bool operator<(const QuadDouble &a, const QuadDouble &b)
+{
+    for (int i = 0; i < 4; ++i)
+        if (a[i] != b[i])
+            return a[i] < b[i];
+    return false;
+}
+inline bool operator>(const QuadDouble &a, const QuadDouble &b) { return b < a; }
+
+inline QuadDouble abs(const QuadDouble &a) { return a[0] < 0.0 ? -a : a; }
+
+inline std::ostream &operator<<(std::ostream &os, const QuadDouble &v)
+{
+    return os << v.toMpreal();
+}
+
+static_assert(std::is_trivially_copyable<DoubleDouble>::value, "DoubleDouble musi być POD");
+static_assert(std::is_trivially_copyable<QuadDouble>::value, "QuadDouble musi być POD");
+
+/**
+ * Σ x[k]·y[k]. Dla DoubleDouble cztery niezależne akumulatory w tablicy
+ * (działania bez rozgałęzień – kompilator składa je w wektory, a łańcuchy
+ * zależności się nie blokują); QuadDouble ogranicza przepustowość
+ * renormalizacji, więc wystarcza zwykła pętla.
+ */
+template<typename T>
+inline T dot(const T *x, const T *y, int n)
+{
+    T s(0.0);
+    for (int k = 0; k < n; ++k)
+        s += x[k] * y[k];
+    return s;
+}
+
+template<>
+inline DoubleDouble dot<DoubleDouble>(const DoubleDouble *x, const DoubleDouble *y, int n)
+{
+    DoubleDouble s[4] = {};
+    int k = 0;
+    for (; k + 4 <= n; k += 4)
+        for (int l = 0; l < 4; ++l)
+            s[l] += x[k + l] * y[k + l];
+    for (; k < n; ++k)
+        s[0] += x[k] * y[k];
+    return (s[0] + s[1]) + (s[2] + s[3]);
+}
+
+} // namespace multidouble
+
+#endif // MULTI_DOUBLE_HPP
@@ -0,0 +1,115 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "utils/instrumentation.h"
+
+namespace solver {
+
+/**
+ * Widok ciągłego ciągu elementów (wskaźnik + długość) – odpowiednik
+ * std::span z C++20 dla API biblioteki w C++17. Tworzony bez kopiowania
+ * z każdego kontenera z data() i size(): std::vector, std::array,
+ * std::span, QVector.
+ */
+template <typename T>
+class Span {
+public:
+    Span() = default;
+    Span(T *data, std::size_t size) : data_(data), size_(size) {}
+
+    template <typename C,
+              typename = std::enable_if_t<
+                  std::is_convertible<decltype(std::declval<C &>().data()), T *>::value>>
+    Span(C &c) : data_(c.data()), size_(static_cast<std::size_t>(c.size())) {}
+
+    // Span<T> → Span<const T>
+    template <typename U, typename = std::enable_if_t<std::is_convertible<U *, T *>::value>>
+    Span(Span<U> o) : data_(o.data()), size_(o.size()) {}
+
+    T *data() const { return data_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    T &operator[](std::size_t i) const { return data_[i]; }
+    T *begin() const { return data_; }
+    T *end() const { return data_ + size_; }
+
+private:
+    T *data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+ * Widok macierzy zapisanej wierszami: element (i, j) to data[i·stride + j].
+ * stride ≥ cols pozwala podać podmacierz lub wiersze z wyrównaniem.
+ */
+template <typename T>
+class MatrixView {
+public:
+    MatrixView() = default;
+    MatrixView(T *data, int rows, int cols, std::ptrdiff_t stride)
+        : data_(data), rows_(rows), cols_(cols), stride_(stride) {}
+    MatrixView(T *data, int rows, int cols) : MatrixView(data, rows, cols, cols) {}
+    // Macierz kwadratowa n×n
+    MatrixView(T *data, int n) : MatrixView(data, n, n, n) {}
+
+    // MatrixView<T> → MatrixView<const T>
+    template <typename U, typename = std::enable_if_t<std::is_convertible<U *, T *>::value>>
+    MatrixView(MatrixView<U> o) : MatrixView(o.data(), o.rows(), o.cols(), o.stride()) {}
+
+    T *data() const { return data_; }
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    std::ptrdiff_t stride() const { return stride_; }
+
+    // Wiersz i; m[i][j] to element (i, j)
+    T *operator[](int i) const { return data_ + i * stride_; }
+
+private:
+    T *data_ = nullptr;
+    int rows_ = 0;
+    int cols_ = 0;
+    std::ptrdiff_t stride_ = 0;
+};
+
+/**
+ * Zerowy pivot w rozkładzie (general, symmetric, out-of-core). Osobny typ,
+ * żeby wywołujący odróżniali osobliwość macierzy od błędów I/O, które też
+ * są std::runtime_error.
+ */
+class ZeroPivot : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * Wynik solverów pełnych (general, symmetric): L·y = b, U·x = y.
+ * L i U to macierze n×n zapisane wierszami (dla symmetric U = D·Lᵀ).
+ */
+template <typename T>
+struct CroutResult {
+    int n = 0;
+    std::vector<T> L, U;
+    std::vector<T> y, x;
+    // czasy faz i liczniki; collected == false bez CROUT_INSTRUMENTATION
+    utils::SolveStats stats;
+
+    MatrixView<const T> lower() const { return {L.data(), n}; }
+    MatrixView<const T> upper() const { return {U.data(), n}; }
+};
+
+/**
+ * Wynik solvera trójdiagonalnego: l – pod-przekątna L (n-1), diag – przekątna U,
+ * up – nad-przekątna U (n-1); L·y = rhs, U·x = y. Zerowy pivot (przedziały:
+ * pivot zawierający zero): y i x to NaN, rozkład urwany na tym diag[i].
+ */
+template <typename T>
+struct TridiagonalResult {
+    std::vector<T> l, diag, up;
+    std::vector<T> y, x;
+    utils::SolveStats stats;
+};
+
+} // namespace solver
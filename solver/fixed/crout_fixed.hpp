@@ -0,0 +1,70 @@
+#pragma once
+#include <optional>
+#include "solver/crout_types.h"
+#include "solver/fixed/small_matrix.hpp"
+#include "utils/instrumentation.h"
+
+namespace solver {
+namespace fixed {
+
+namespace detail {
+
+// widok → stos, jądro Kernel<N>, stos → CroutResult
+template <int N, typename T, typename Kernel>
+CroutResult<T> runFixed(MatrixView<const T> A, Span<const T> b, Kernel kernel)
+{
+    SmallMatrix<T, N> As, L, U;
+    SmallVector<T, N> bs, y, x;
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j)
+            As[i][j] = A[i][j];
+        bs[i] = b[i];
+    }
+
+    kernel(As, bs, L, U, y, x);
+
+    CroutResult<T> r;
+    r.n = N;
+    r.L.assign(&L[0][0], &L[0][0] + N * N);
+    r.U.assign(&U[0][0], &U[0][0] + N * N);
+    r.y.assign(y.begin(), y.end());
+    r.x.assign(x.begin(), x.end());
+    return r;
+}
+
+} // namespace detail
+
+/**
+ * Ścieżka dla małych układów: gdy 1 ≤ n ≤ CROUT_SMALL_MAX, rozwiązuje
+ * jądrem o stałym rozmiarze; inaczej zwraca std::nullopt. Z instrumentacją
+ * zawsze std::nullopt – rozwinięte jądro nie ma faz ani liczników, a silnik
+ * daje ten sam wynik bit w bit.
+ */
+template <typename T>
+std::optional<CroutResult<T>> trySolveGeneralFixed(MatrixView<const T> A, Span<const T> b)
+{
+    std::optional<CroutResult<T>> out;
+    if (utils::instrument::kEnabled || A.cols() != A.rows() || b.size() != static_cast<std::size_t>(A.rows()))
+        return out;
+    dispatchFixed(A.rows(), [&](auto n) {
+        constexpr int N = decltype(n)::value;
+        out = detail::runFixed<N>(A, b, solveCroutFixed<N, T>);
+    });
+    return out;
+}
+
+template <typename T>
+std::optional<CroutResult<T>> trySolveSymmetricFixed(MatrixView<const T> A, Span<const T> b)
+{
+    std::optional<CroutResult<T>> out;
+    if (utils::instrument::kEnabled || A.cols() != A.rows() || b.size() != static_cast<std::size_t>(A.rows()))
+        return out;
+    dispatchFixed(A.rows(), [&](auto n) {
+        constexpr int N = decltype(n)::value;
+        out = detail::runFixed<N>(A, b, solveCroutSymmetricFixed<N, T>);
+    });
+    return out;
+}
+
+} // namespace fixed
+} // namespace solver
@@ -0,0 +1,217 @@
+#pragma once
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "solver/crout_types.h"
+
+// Największe n obsługiwane jądrami o stałym rozmiarze; 0 wyłącza
+// (ustawiane w CMake: -DCROUT_SMALL_MAX=...)
+#ifndef CROUT_SMALL_MAX
+#define CROUT_SMALL_MAX 16
+#endif
+
+// Pełne rozwinięcie pętli o granicach znanych w czasie kompilacji
+#if defined(__clang__)
+#define CROUT_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#define CROUT_UNROLL _Pragma("GCC unroll 64")
+#else
+#define CROUT_UNROLL
+#endif
+
+namespace solver {
+namespace fixed {
+
+/**
+ * Macierz N×N na stosie – bez alokacji i bez rozmiaru w czasie wykonania.
+ * Przeznaczona dla małych układów (n ≤ CROUT_SMALL_MAX), gdzie koszt
+ * QVector i pętli o zmiennych granicach przewyższa samą arytmetykę.
+ */
+template <typename T, int N>
+struct SmallMatrix {
+    static_assert(N > 0, "SmallMatrix needs N > 0");
+    T m[N][N];
+
+    T *operator[](int i) { return m[i]; }
+    const T *operator[](int i) const { return m[i]; }
+};
+
+template <typename T, int N>
+using SmallVector = std::array<T, N>;
+
+/**
+ * Crout–Doolittle (A = L·U, L[i][i] = 1) o stałym rozmiarze N.
+ * Ta sama kolejność działań co general::croutGeneral (suma iloczynów
+ * od k = 0, potem odjęcie), więc wyniki są identyczne bit w bit.
+ * Zerowy pivot → ZeroPivot("Zero pivot").
+ */
+template <int N, typename T>
+void solveCroutFixed(const SmallMatrix<T, N> &A, const SmallVector<T, N> &b,
+                     SmallMatrix<T, N> &L, SmallMatrix<T, N> &U,
+                     SmallVector<T, N> &y, SmallVector<T, N> &x)
+{
+    CROUT_UNROLL
+    for (int i = 0; i < N; ++i) {
+        CROUT_UNROLL
+        for (int j = 0; j < N; ++j) {
+            L[i][j] = T(0.0);
+            U[i][j] = T(0.0);
+        }
+    }
+
+    CROUT_UNROLL
+    for (int i = 0; i < N; ++i) {
+        L[i][i] = T(1.0);
+        // U row
+        CROUT_UNROLL
+        for (int j = i; j < N; ++j) {
+            T s = T(0.0);
+            CROUT_UNROLL
+            for (int k = 0; k < i; ++k)
+                s += L[i][k] * U[k][j];
+            U[i][j] = A[i][j] - s;
+        }
+        if (i + 1 < N && U[i][i] == T(0.0))
+            throw ZeroPivot("Zero pivot");
+        // L column
+        CROUT_UNROLL
+        for (int j = i + 1; j < N; ++j) {
+            T s = T(0.0);
+            CROUT_UNROLL
+            for (int k = 0; k < i; ++k)
+                s += L[j][k] * U[k][i];
+            L[j][i] = (A[j][i] - s) / U[i][i];
+        }
+    }
+
+    // forward: L·y = b
+    CROUT_UNROLL
+    for (int i = 0; i < N; ++i) {
+        T s = T(0.0);
+        CROUT_UNROLL
+        for (int k = 0; k < i; ++k)
+            s += L[i][k] * y[k];
+        y[i] = b[i] - s;
+    }
+
+    // back: U·x = y
+    CROUT_UNROLL
+    for (int i = N - 1; i >= 0; --i) {
+        if (U[i][i] == T(0.0))
+            throw ZeroPivot("Zero pivot");
+        T s = T(0.0);
+        CROUT_UNROLL
+        for (int k = i + 1; k < N; ++k)
+            s += U[i][k] * x[k];
+        x[i] = (y[i] - s) / U[i][i];
+    }
+}
+
+/**
+ * Crout–LDLᵀ o stałym rozmiarze N; kolejność działań jak
+ * symmetric::croutSymmetric. Zwraca L, U = D·Lᵀ, y (L·y = b) i x.
+ */
+template <int N, typename T>
+void solveCroutSymmetricFixed(const SmallMatrix<T, N> &A, const SmallVector<T, N> &b,
+                              SmallMatrix<T, N> &L, SmallMatrix<T, N> &U,
+                              SmallVector<T, N> &y, SmallVector<T, N> &x)
+{
+    SmallVector<T, N> D, W;
+
+    CROUT_UNROLL
+    for (int i = 0; i < N; ++i) {
+        CROUT_UNROLL
+        for (int j = 0; j < N; ++j) {
+            L[i][j] = T(0.0);
+            U[i][j] = T(0.0);
+        }
+    }
+
+    CROUT_UNROLL
+    for (int j = 0; j < N; ++j) {
+        CROUT_UNROLL
+        for (int k = 0; k < j; ++k)
+            W[k] = D[k] * L[j][k];
+
+        T s = T(0.0);
+        CROUT_UNROLL
+        for (int k = 0; k < j; ++k)
+            s += L[j][k] * W[k];
+        D[j] = A[j][j] - s;
+        if (D[j] == T(0.0))
+            throw ZeroPivot("Zero pivot in LDLT decomposition");
+
+        L[j][j] = T(1.0);
+        CROUT_UNROLL
+        for (int i = j + 1; i < N; ++i) {
+            T t = T(0.0);
+            CROUT_UNROLL
+            for (int k = 0; k < j; ++k)
+                t += L[i][k] * W[k];
+            L[i][j] = (A[i][j] - t) / D[j];
+        }
+    }
+
+    CROUT_UNROLL
+    for (int i = 0; i < N; ++i) {
+        CROUT_UNROLL
+        for (int j = i; j < N; ++j)
+            U[i][j] = D[i] * L[j][i];
+    }
+
+    // Forward: L·y = b
+    CROUT_UNROLL
+    for (int i = 0; i < N; ++i) {
+        T s = T(0.0);
+        CROUT_UNROLL
+        for (int k = 0; k < i; ++k)
+            s += L[i][k] * y[k];
+        y[i] = b[i] - s;
+    }
+
+    // Middle + backward: Lᵀ·x = D⁻¹·y
+    SmallVector<T, N> z;
+    CROUT_UNROLL
+    for (int i = 0; i < N; ++i)
+        z[i] = y[i] / D[i];
+
+    CROUT_UNROLL
+    for (int i = N - 1; i >= 0; --i) {
+        T s = T(0.0);
+        CROUT_UNROLL
+        for (int k = i + 1; k < N; ++k)
+            s += L[k][i] * x[k];
+        x[i] = z[i] - s;
+    }
+}
+
+namespace detail {
+
+template <typename F, int... Ns>
+bool dispatchFixed(int n, F &&f, std::integer_sequence<int, Ns...>)
+{
+    return ((n == Ns + 1 ? (f(std::integral_constant<int, Ns + 1>{}), true) : false) || ...);
+}
+
+} // namespace detail
+
+/**
+ * Wywołuje f(std::integral_constant<int, n>{}) dla 1 ≤ n ≤ Max.
+ * Zwraca false, gdy n jest poza zakresem (wtedy zostaje zwykły silnik).
+ */
+template <int Max = CROUT_SMALL_MAX, typename F>
+bool dispatchFixed(int n, F &&f)
+{
+    if constexpr (Max <= 0) {
+        (void)n;
+        (void)f;
+        return false;
+    } else {
+        return detail::dispatchFixed(n, std::forward<F>(f),
+                                     std::make_integer_sequence<int, Max>{});
+    }
+}
+
+} // namespace fixed
+} // namespace solver
@@ -1,25 +1,16 @@
 #pragma once
-#include <tuple>
-#include <QVector>
-#include <stdexcept>
+#include "solver/crout_types.h"
 
 namespace solver {
 namespace general {
 
 /**
  * Rozwiązuje A x = b metodą Crout–Doolittle (A = L·U, L[i][i]=1).
- * Zwraca krotkę (L, U, y, x):
+ * Zwraca L, U, y, x:
  *   L·y = b,
  *   U·x = y.
  */
-std::tuple<
-    QVector<QVector<double>>,
-    QVector<QVector<double>>,
-    QVector<double>,
-    QVector<double>
->
-solveCroutGeneral(const QVector<QVector<double>> &A,
-                  const QVector<double>         &b);
+CroutResult<double> solveCroutGeneral(MatrixView<const double> A, Span<const double> b);
 
 } // namespace general
 } // namespace solver
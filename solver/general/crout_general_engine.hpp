@@ -0,0 +1,138 @@
+#pragma once
+#include <algorithm>
+#include <stdexcept>
+#include "solver/crout_types.h"
+#include "solver/traits/counting_ops.hpp"
+#include "solver/traits/scalar_ops.hpp"
+#include "utils/instrumentation.h"
+#include "utils/solve_control.h"
+#include "utils/trace.h"
+
+namespace solver {
+namespace general {
+
+/**
+ * Crout–Doolittle (A = L·U, L[i][i] = 1) dla dowolnego typu z cechami
+ * traits::ScalarOps<T>. Zwraca L, U, y, x: L·y = b, U·x = y.
+ *
+ * L i Uᵀ trzymane są wierszami, więc każda suma Crouta to jeden Ops::dot po
+ * dwóch ciągłych wierszach. Gdy Ops::panel > 0, rozkład idzie panelami
+ * kolumn, a dopełnienie Schura liczy Ops::subMatMulNT.
+ *
+ * Z CROUT_INSTRUMENTATION wynik ma w stats czasy faz i liczniki
+ * (utils/instrumentation.h). Co kolumnę rozkładu punkt przerwania
+ * utils::control::checkpoint (utils/solve_control.h).
+ */
+template <typename T, typename Ops = traits::ScalarOps<T>>
+CroutResult<T> croutGeneral(MatrixView<const T> A, Span<const T> b)
+{
+    const int n = A.rows();
+    if (A.cols() != n)
+        throw std::invalid_argument("Matrix must be square.");
+    if (b.size() != static_cast<std::size_t>(n))
+        throw std::invalid_argument("Vector size does not match matrix dimension.");
+
+    using Stats = utils::SolveStats;
+    utils::instrument::Scope collect;
+    const traits::Instrumented<Ops> ops{};
+    utils::instrument::PhaseClock phase(&Stats::factorizationNs);
+
+    auto L  = ops.matrix(n, n);
+    auto Ut = ops.matrix(n, n);
+    auto y  = ops.vector(n);
+    auto x  = ops.vector(n);
+    auto sum = ops.reg();
+
+    // S: A z odjętymi wkładami paneli już rozłożonych; bv: b w magazynie cech
+    auto S  = ops.matrix(n, n);
+    auto bv = ops.vector(n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j)
+            ops.put(S.row(i) + j, A[i][j]);
+        ops.put(bv.data() + i, b[i]);
+    }
+
+    const int nb = (Ops::panel > 0 && n > 2 * Ops::panel) ? Ops::panel : std::max(n, 1);
+
+    for (int k0 = 0; k0 < n; k0 += nb) {
+        const int k1 = std::min(n, k0 + nb);
+
+        // Crout wewnątrz panelu: sumy tylko po kolumnach k0..i-1
+        utils::trace::Scope panelTask("factor", "panel", k0 / nb);
+        for (int i = k0; i < k1; ++i) {
+            utils::control::checkpoint(i, n);
+            ops.setOne(L.row(i) + i);
+            // U row
+            for (int j = i; j < n; ++j) {
+                ops.dot(sum, L.row(i) + k0, Ut.row(j) + k0, i - k0);
+                ops.sub(Ut.row(j) + i, S.row(i) + j, sum);
+            }
+            if constexpr (Ops::checksPivot) {
+                if (i + 1 < n && ops.isZero(Ut.row(i) + i))
+                    throw ZeroPivot("Zero pivot");
+            }
+            // L column
+            for (int j = i + 1; j < n; ++j) {
+                ops.dot(sum, L.row(j) + k0, Ut.row(i) + k0, i - k0);
+                ops.subDiv(L.row(j) + i, S.row(j) + i, sum, Ut.row(i) + i);
+            }
+        }
+
+        // S22 -= L21·U12
+        if constexpr (Ops::panel > 0) {
+            const int m = n - k1;
+            utils::trace::Scope updateTask("factor", "schur update", k0 / nb);
+            if (m > 0)
+                ops.subMatMulNT(m, m, k1 - k0,
+                                L.row(k1) + k0, n, Ut.row(k1) + k0, n,
+                                S.row(k1) + k1, n);
+        }
+    }
+    utils::control::checkpoint(n, n);
+
+    // U wierszami – do podstawiania wstecz i jako wynik
+    auto U = ops.matrix(n, n);
+    for (int i = 0; i < n; ++i)
+        for (int j = i; j < n; ++j)
+            ops.copy(U.row(i) + j, Ut.row(j) + i);
+
+    // forward: L·y = b  (L[i][i] == 1)
+    phase.next(&Stats::forwardNs);
+    for (int i = 0; i < n; ++i) {
+        ops.dot(sum, L.row(i), y.data(), i);
+        ops.sub(y.data() + i, bv.data() + i, sum);
+    }
+
+    // back: U·x = y
+    phase.next(&Stats::backwardNs);
+    for (int i = n - 1; i >= 0; --i) {
+        if constexpr (Ops::checksPivot) {
+            if (ops.isZero(U.row(i) + i))
+                throw ZeroPivot("Zero pivot");
+        }
+        ops.dot(sum, U.row(i) + i + 1, x.data() + i + 1, n - i - 1);
+        ops.subDiv(x.data() + i, y.data() + i, sum, U.row(i) + i);
+    }
+
+    phase.stop();
+
+    CroutResult<T> r;
+    r.n = n;
+    r.L.reserve(std::size_t(n) * n);
+    r.U.reserve(std::size_t(n) * n);
+    r.y.reserve(n);
+    r.x.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j)
+            r.L.push_back(ops.get(L.row(i) + j));
+        for (int j = 0; j < n; ++j)
+            r.U.push_back(ops.get(U.row(i) + j));
+        r.y.push_back(ops.get(y.data() + i));
+        r.x.push_back(ops.get(x.data() + i));
+    }
+    r.stats = collect.stop();
+    return r;
+}
+
+} // namespace general
+} // namespace solver
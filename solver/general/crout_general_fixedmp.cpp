@@ -0,0 +1,28 @@
+#include "crout_general_fixedmp.h"
+#include "crout_general_engine.hpp"
+#include "solver/traits/scalar_ops_fixedmp.hpp"
+
+namespace solver {
+namespace general {
+
+template<int Bits>
+CroutResult<fixedmp::FixedMp<Bits>>
+solveCroutGeneral(MatrixView<const fixedmp::FixedMp<Bits>> A,
+                  Span<const fixedmp::FixedMp<Bits>> b)
+{
+    return croutGeneral(A, b);
+}
+
+#define CROUT_GENERAL_FIXEDMP(BITS)                                              \
+    template CroutResult<fixedmp::FixedMp<BITS>>                                 \
+    solveCroutGeneral<BITS>(MatrixView<const fixedmp::FixedMp<BITS>>,            \
+                            Span<const fixedmp::FixedMp<BITS>>);
+
+CROUT_GENERAL_FIXEDMP(128)
+CROUT_GENERAL_FIXEDMP(192)
+CROUT_GENERAL_FIXEDMP(256)
+
+#undef CROUT_GENERAL_FIXEDMP
+
+} // namespace general
+} // namespace solver
@@ -0,0 +1,18 @@
+#pragma once
+#include "fixed_mp.hpp"
+#include "solver/crout_types.h"
+
+namespace solver {
+namespace general {
+
+/**
+ * Crout (LU) w stałej precyzji fixedmp::FixedMp<Bits> – bez alokacji limbów.
+ * Instancje: 128, 192, 256 bitów. Zwraca L, U, y, x.
+ */
+template<int Bits>
+CroutResult<fixedmp::FixedMp<Bits>>
+solveCroutGeneral(MatrixView<const fixedmp::FixedMp<Bits>> A,
+                  Span<const fixedmp::FixedMp<Bits>> b);
+
+} // namespace general
+} // namespace solver
@@ -0,0 +1,19 @@
+#include "crout_general_float128.h"
+
+#ifdef CROUT_HAVE_FLOAT128
+
+#include "crout_general_engine.hpp"
+
+namespace solver {
+namespace general {
+
+CroutResult<__float128> solveCroutGeneral(MatrixView<const __float128> A,
+                                          Span<const __float128> b)
+{
+    return croutGeneral(A, b);
+}
+
+} // namespace general
+} // namespace solver
+
+#endif // CROUT_HAVE_FLOAT128
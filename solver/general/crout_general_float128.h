@@ -0,0 +1,20 @@
+#pragma once
+#include "float128.hpp"
+#include "solver/crout_types.h"
+
+#ifdef CROUT_HAVE_FLOAT128
+
+namespace solver {
+namespace general {
+
+/**
+ * Crout (LU) w poczwórnej precyzji IEEE (__float128, 113 bitów mantysy).
+ * Zwraca L, U, y, x.
+ */
+CroutResult<__float128> solveCroutGeneral(MatrixView<const __float128> A,
+                                          Span<const __float128> b);
+
+} // namespace general
+} // namespace solver
+
+#endif // CROUT_HAVE_FLOAT128
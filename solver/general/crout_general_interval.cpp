@@ -1,51 +1,55 @@
 #include "crout_general_interval.h"
+#include "crout_general_engine.hpp"
+#include "solver/traits/scalar_ops_interval.hpp"  // SoA, IDot, panele mid/rad dla double
+
+namespace IA = interval_arithmetic;
+using I  = IA::Interval<mpfr::mpreal>;
+using ID = IA::Interval<double>;
+
 namespace solver {
     namespace general {
-    
-std::tuple<QVector<QVector<Interval<mpreal>>>, QVector<QVector<Interval<mpreal>>>, QVector<Interval<mpreal>>, QVector<Interval<mpreal>>>
-solveCroutGeneral(const QVector<QVector<Interval<mpreal>>> &A, const QVector<Interval<mpreal>> &b)
+
+CroutResult<I> solveCroutGeneral(MatrixView<const I> A, Span<const I> b)
 {
-    int n = A.size();
-    QVector<QVector<Interval<mpreal>>> L(n, QVector<Interval<mpreal>>(n));
-    QVector<QVector<Interval<mpreal>>> U(n, QVector<Interval<mpreal>>(n));
-    QVector<Interval<mpreal>> y(n), x(n);
+    return croutGeneral(A, b);
+}
 
-    for (int i = 0; i < n; ++i)
-    {
-        L[i][i] = Interval<mpreal>(1, 1);
-        for (int j = i; j < n; ++j)
-        {
-            Interval<mpreal> sum(0, 0);
-            for (int k = 0; k < i; ++k)
-                sum = sum + L[i][k] * U[k][j];
-            U[i][j] = A[i][j] - sum;
-        }
-        for (int j = i + 1; j < n; ++j)
-        {
-            Interval<mpreal> sum(0, 0);
-            for (int k = 0; k < i; ++k)
-                sum = sum + L[j][k] * U[k][i];
-            L[j][i] = (A[j][i] - sum) / U[i][i];
-        }
-    }
+CroutResult<ID> solveCroutGeneral(MatrixView<const ID> A, Span<const ID> b)
+{
+    return croutGeneral(A, b);
+}
 
-    for (int i = 0; i < n; ++i)
-    {
-        Interval<mpreal> sum(0, 0);
-        for (int k = 0; k < i; ++k)
-            sum = sum + L[i][k] * y[k];
-        y[i] = (b[i] - sum) / L[i][i];
-    }
+#ifdef CROUT_HAVE_FLOAT128
+using IQ = IA::Interval<__float128>;
+
+CroutResult<IQ> solveCroutGeneral(MatrixView<const IQ> A, Span<const IQ> b)
+{
+    return croutGeneral(A, b);
+}
+#endif
 
-    for (int i = n - 1; i >= 0; --i)
+std::vector<ID>
+residualEnclosure(MatrixView<const ID> A, Span<const ID> b, Span<const ID> x)
+{
+    const int n = A.rows();
+    if (A.cols() != n || b.size() != std::size_t(n) || x.size() != std::size_t(n))
+        throw std::invalid_argument("residualEnclosure: niezgodne wymiary");
+
+    IA::IntervalMatrix<double> Ai(n, n);
+    IA::IntervalVector<double> bi(n), xi(n);
+    for (int i = 0; i < n; ++i)
     {
-        Interval<mpreal> sum(0, 0);
-        for (int k = i + 1; k < n; ++k)
-            sum = sum + U[i][k] * x[k];
-        x[i] = (y[i] - sum) / U[i][i];
+        for (int j = 0; j < n; ++j)
+            Ai.set(i, j, A[i][j]);
+        bi.set(i, b[i]);
+        xi.set(i, x[i]);
     }
 
-    return {L, U, y, x};
+    IA::IntervalVector<double> r = IA::midrad::IResidual(IA::midrad::toMidRad(Ai), bi, xi);
+    std::vector<ID> rv(n);
+    for (int i = 0; i < n; ++i)
+        rv[i] = r.get(i);
+    return rv;
 }
     }
-}
\ No newline at end of file
+}
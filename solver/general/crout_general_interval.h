@@ -1,19 +1,37 @@
 #ifndef CROUT_GENERAL_INTERVAL_H
 #define CROUT_GENERAL_INTERVAL_H
 
-#include <QVector>
-#include <tuple>
+#include <vector>
 #include "interval.hpp"
 #include "mpreal.h"
+#include "float128.hpp"
+#include "solver/crout_types.h"
 
-using namespace mpfr;
-using namespace interval_arithmetic;
 namespace solver {
     namespace general {
-    
-std::tuple<QVector<QVector<Interval<mpreal>>>, QVector<QVector<Interval<mpreal>>>, QVector<Interval<mpreal>>, QVector<Interval<mpreal>>>
-solveCroutGeneral(const QVector<QVector<Interval<mpreal>>> &A, const QVector<Interval<mpreal>> &b);
+
+CroutResult<interval_arithmetic::Interval<mpfr::mpreal>>
+solveCroutGeneral(MatrixView<const interval_arithmetic::Interval<mpfr::mpreal>> A,
+                  Span<const interval_arithmetic::Interval<mpfr::mpreal>> b);
+
+// Końce double: sumy Crouta liczone wektorowo (interval_simd.hpp), dla dużych n
+// wersja blokowa z dopełnieniem Schura przez iloczyny mid/rad (interval_midrad.hpp).
+CroutResult<interval_arithmetic::Interval<double>>
+solveCroutGeneral(MatrixView<const interval_arithmetic::Interval<double>> A,
+                  Span<const interval_arithmetic::Interval<double>> b);
+
+#ifdef CROUT_HAVE_FLOAT128
+// Końce __float128 (113 bitów): tryb zaokrąglania przez fesetround, jak dla double.
+CroutResult<interval_arithmetic::Interval<__float128>>
+solveCroutGeneral(MatrixView<const interval_arithmetic::Interval<__float128>> A,
+                  Span<const interval_arithmetic::Interval<__float128>> b);
+#endif
+
+// Obudowa residuum b - A·x (iloczyn mid/rad).
+std::vector<interval_arithmetic::Interval<double>>
+residualEnclosure(MatrixView<const interval_arithmetic::Interval<double>> A,
+                  Span<const interval_arithmetic::Interval<double>> b,
+                  Span<const interval_arithmetic::Interval<double>> x);
    }
 }
 #endif // CROUT_GENERAL_INTERVAL_H
- 
\ No newline at end of file
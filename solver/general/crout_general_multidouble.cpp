@@ -0,0 +1,23 @@
+#include "crout_general_multidouble.h"
+#include "crout_general_engine.hpp"
+#include "solver/traits/scalar_ops_multidouble.hpp"
+
+namespace solver {
+namespace general {
+
+CroutResult<multidouble::DoubleDouble>
+solveCroutGeneral(MatrixView<const multidouble::DoubleDouble> A,
+                  Span<const multidouble::DoubleDouble> b)
+{
+    return croutGeneral(A, b);
+}
+
+CroutResult<multidouble::QuadDouble>
+solveCroutGeneral(MatrixView<const multidouble::QuadDouble> A,
+                  Span<const multidouble::QuadDouble> b)
+{
+    return croutGeneral(A, b);
+}
+
+} // namespace general
+} // namespace solver
@@ -0,0 +1,21 @@
+#pragma once
+#include "multi_double.hpp"
+#include "solver/crout_types.h"
+
+namespace solver {
+namespace general {
+
+/**
+ * Crout (LU) w arytmetyce double-double (~106 bitów) i quad-double (~212 bitów).
+ * Zwraca L, U, y, x.
+ */
+CroutResult<multidouble::DoubleDouble>
+solveCroutGeneral(MatrixView<const multidouble::DoubleDouble> A,
+                  Span<const multidouble::DoubleDouble> b);
+
+CroutResult<multidouble::QuadDouble>
+solveCroutGeneral(MatrixView<const multidouble::QuadDouble> A,
+                  Span<const multidouble::QuadDouble> b);
+
+} // namespace general
+} // namespace solver
@@ -0,0 +1,123 @@
+#include "crout_outofcore.h"
+#include "crout_outofcore_engine.hpp"
+#include "crout_tridiagonal_stream.hpp"
+#include "float128.hpp"
+#include "solver/traits/scalar_ops_interval.hpp"
+#include "solver/traits/scalar_ops_mpreal.hpp"
+#include "solver/traits/scalar_ops_multidouble.hpp"
+
+namespace IA = interval_arithmetic;
+
+namespace solver {
+namespace outofcore {
+
+// ───────────────────────────────────────────────────────────────────────────────
+// Inicjalizacja arytmetyki przedziałowej (tylko przy 1-szym wejściu do pliku)
+namespace {
+using I = IA::Interval<mpfr::mpreal>;
+
+bool initInterval()
+{
+    I::Initialize();           // domyślna precyzja / outdigits
+    I::SetMode(IA::DINT_MODE); // zawsze zaokrąglaj w przeciwnych kierunkach
+    return true;
+}
+const bool _intervalReady = initInterval();
+
+template <typename T, typename Put>
+OutOfCoreResult<T> run(int n, bool symmetric, Put put, Span<const T> b, const OutOfCoreOptions &options)
+{
+    utils::instrument::Scope collect;
+    TiledCrout<T> crout(n, symmetric, options);
+    {
+        utils::instrument::PhaseClock phase(&utils::SolveStats::factorizationNs);
+        crout.load(put);
+        crout.factor();
+    }
+    OutOfCoreResult<T> r = crout.solve(b);
+    r.stats = collect.stop();
+    return r;
+}
+
+template <typename T>
+OutOfCoreResult<T> fromView(MatrixView<const T> A, Span<const T> b, bool symmetric,
+                            const OutOfCoreOptions &options)
+{
+    if (A.rows() != A.cols())
+        throw std::invalid_argument("Matrix must be square.");
+    const traits::ScalarOps<T> ops;
+    return run<T>(A.rows(), symmetric, [&](auto dst, int i, int j) { ops.put(dst, A[i][j]); },
+                  b, options);
+}
+
+template <typename T>
+OutOfCoreResult<T> fromFile(const utils::MatrixFile &A, Span<const T> b, bool symmetric,
+                            const OutOfCoreOptions &options)
+{
+    if (A.scalar() != utils::ScalarTypeOf<T>::value)
+        throw std::invalid_argument("Matrix file scalar type does not match.");
+    if (A.rows() != A.cols())
+        throw std::invalid_argument("Matrix must be square.");
+    const traits::ScalarOps<T> ops;
+    return run<T>(int(A.rows()), symmetric, [&](auto dst, int i, int j) {
+        putFileElement<T>(ops, dst, A, A.indexOf(std::uint64_t(i), std::uint64_t(j)));
+    }, b, options);
+}
+} // anonymous
+// ───────────────────────────────────────────────────────────────────────────────
+
+template <typename T>
+OutOfCoreResult<T> solveCroutGeneral(MatrixView<const T> A, Span<const T> b, const OutOfCoreOptions &options)
+{
+    return fromView(A, b, false, options);
+}
+
+template <typename T>
+OutOfCoreResult<T> solveCroutSymmetric(MatrixView<const T> A, Span<const T> b, const OutOfCoreOptions &options)
+{
+    return fromView(A, b, true, options);
+}
+
+template <typename T>
+OutOfCoreResult<T> solveCroutGeneral(const utils::MatrixFile &A, Span<const T> b, const OutOfCoreOptions &options)
+{
+    return fromFile(A, b, false, options);
+}
+
+template <typename T>
+OutOfCoreResult<T> solveCroutSymmetric(const utils::MatrixFile &A, Span<const T> b, const OutOfCoreOptions &options)
+{
+    return fromFile(A, b, true, options);
+}
+
+template <typename T>
+StreamResult solveTridiagonalStream(const utils::MatrixFile &A, const utils::MatrixFile &b,
+                                    const std::string &xPath, const OutOfCoreOptions &options)
+{
+    return StreamingTridiagonal<T>(A, b, options).solve(xPath);
+}
+
+#define CROUT_OUTOFCORE(T)                                                                                   \
+    template OutOfCoreResult<T> solveCroutGeneral(MatrixView<const T>, Span<const T>, const OutOfCoreOptions &);   \
+    template OutOfCoreResult<T> solveCroutSymmetric(MatrixView<const T>, Span<const T>, const OutOfCoreOptions &); \
+    template OutOfCoreResult<T> solveCroutGeneral(const utils::MatrixFile &, Span<const T>,                  \
+                                                  const OutOfCoreOptions &);                                 \
+    template OutOfCoreResult<T> solveCroutSymmetric(const utils::MatrixFile &, Span<const T>,                \
+                                                    const OutOfCoreOptions &);                               \
+    template StreamResult solveTridiagonalStream<T>(const utils::MatrixFile &, const utils::MatrixFile &,    \
+                                                    const std::string &, const OutOfCoreOptions &);
+
+CROUT_OUTOFCORE(double)
+CROUT_OUTOFCORE(multidouble::DoubleDouble)
+CROUT_OUTOFCORE(multidouble::QuadDouble)
+CROUT_OUTOFCORE(mpfr::mpreal)
+CROUT_OUTOFCORE(IA::Interval<double>)
+CROUT_OUTOFCORE(IA::Interval<mpfr::mpreal>)
+#ifdef CROUT_HAVE_FLOAT128
+CROUT_OUTOFCORE(__float128)
+#endif
+
+#undef CROUT_OUTOFCORE
+
+} // namespace outofcore
+} // namespace solver
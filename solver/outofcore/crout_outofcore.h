@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "solver/crout_types.h"
+#include "utils/matrix_file.h"
+
+namespace solver {
+namespace outofcore {
+
+/**
+ * Rozkład Crouta (LU, L[i][i] = 1) i LDLᵀ dla macierzy większych niż pamięć.
+ *
+ * Macierz dzielona jest na kafelki tile × tile zapisane w pliku roboczym
+ * (utils::TileFile); w pamięci jest tylko kilka wierszy kafelków naraz:
+ * bieżący panel, aktualizowany wiersz, następny wiersz czytany w tle
+ * i poprzedni zapisywany w tle. Czynniki zostają w pliku do podstawiania,
+ * które też czyta kafelki strumieniem – wynikiem są tylko y i x.
+ *
+ * Typy: double, DoubleDouble, QuadDouble, __float128, mpreal,
+ * Interval<double>, Interval<mpreal>; obliczenia idą przez te same cechy
+ * traits::ScalarOps<T> co solvery w pamięci (bloki MPFR, przedziały SoA).
+ * Typy MPFR liczone są z domyślną precyzją wątku wołającego.
+ */
+struct OutOfCoreOptions {
+    // Bajty na kafelki w pamięci; wyznacza bok kafelka (długość bloku
+    // trójdiagonalnej), gdy tile == 0
+    std::size_t memoryLimit = std::size_t(1) << 30;
+    int tile = 0;
+    // Plik roboczy; pusty → katalog tymczasowy. Usuwany po rozwiązaniu.
+    std::string tilePath;
+};
+
+// L·y = b, U·x = y (symmetric: D·Lᵀ·x = y)
+template <typename T>
+struct OutOfCoreResult {
+    std::vector<T> y, x;
+    // liczniki tylko z wątku wywołującego (bez czytania/zapisu kafelków w tle)
+    utils::SolveStats stats;
+};
+
+// Macierz z widoku – także zmapowanego pliku .crm, czytanego tylko kafelkami
+template <typename T>
+OutOfCoreResult<T> solveCroutGeneral(MatrixView<const T> A, Span<const T> b,
+                                     const OutOfCoreOptions &options = {});
+template <typename T>
+OutOfCoreResult<T> solveCroutSymmetric(MatrixView<const T> A, Span<const T> b,
+                                       const OutOfCoreOptions &options = {});
+
+// Macierz z pliku .crm dowolnego układu, także z rekordami MPFR
+template <typename T>
+OutOfCoreResult<T> solveCroutGeneral(const utils::MatrixFile &A, Span<const T> b,
+                                     const OutOfCoreOptions &options = {});
+template <typename T>
+OutOfCoreResult<T> solveCroutSymmetric(const utils::MatrixFile &A, Span<const T> b,
+                                       const OutOfCoreOptions &options = {});
+
+/**
+ * Trójdiagonalna z pliku .crm (układ Tridiagonal) strumieniowo: pasma
+ * i b czytane są kolejno blokami, diag i y z przebiegu w przód trafiają do
+ * pliku roboczego, a x – liczone od końca – prosto do pliku xPath (.crm Dense
+ * n×1, typy MPFR w bieżącej precyzji). Pamięć zależy tylko od długości bloku,
+ * nie od n. Wyniki jak solver::tridiagonal::solveCroutTridiagonal.
+ *
+ * Zerowy pivot nie rzuca wyjątku: singular = true, a x wypełnione jest NaN.
+ * W stats rozkład i podstawianie w przód to jeden przebieg – faza factorization.
+ */
+struct StreamResult {
+    std::uint64_t n = 0;
+    bool singular = false;
+    utils::SolveStats stats;
+};
+
+template <typename T>
+StreamResult solveTridiagonalStream(const utils::MatrixFile &A, const utils::MatrixFile &b,
+                                    const std::string &xPath, const OutOfCoreOptions &options = {});
+
+} // namespace outofcore
+} // namespace solver
@@ -0,0 +1,498 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <mpfr.h>
+#include "mpreal.h"
+#include "solver/crout_types.h"
+#include "solver/outofcore/crout_outofcore.h"
+#include "solver/outofcore/outofcore_io.hpp"
+#include "solver/traits/counting_ops.hpp"
+#include "solver/traits/scalar_ops.hpp"
+#include "utils/matrix_file.h"
+#include "utils/solve_control.h"
+#include "utils/tile_file.h"
+#include "utils/trace.h"
+
+namespace solver {
+namespace outofcore {
+
+/**
+ * Kafelkowy Crout / LDLᵀ na pliku roboczym dla cech traits::ScalarOps<T>.
+ *
+ * Kafelek (I, J) to blok wierszy I·nb.. i kolumn J·nb.., w pamięci Ops::Matrix
+ * nb × nb, w pliku nb² rekordów w układzie .crm (utils::storeElement). Po
+ * rozkładzie kafelki pod przekątną to L, nad nią Uᵀ (kolumny U wierszami, jak
+ * Ut w silniku w pamięci), na przekątnej L z jedynką domyślną; Uᵀ kafelków
+ * przekątnych leży w osobnych slotach za macierzą. LDLᵀ zapisuje tylko dolny
+ * trójkąt, a D trzyma w pamięci (n elementów).
+ *
+ * Krok k (right-looking): rozkład kafelka przekątnego, panel wiersza k
+ * (general: Uᵀ kafelków (k, J)), potem wiersze I > k po kolei – L kafelka
+ * (I, k) i dopełnienie Schura reszty wiersza przez Ops::subMatMulNT. Wiersz
+ * I + 1 czytany jest w tle, gdy liczy się wiersz I, a wiersz I − 1 w tle
+ * zapisywany; pierwszy wiersz po panelu zostaje w pamięci jako następny panel.
+ */
+template <typename T, typename Ops = traits::ScalarOps<T>>
+class TiledCrout {
+public:
+    using Tile = typename Ops::Matrix;
+    using Row  = std::vector<Tile>;
+    using Ptr  = typename Ops::Ptr;
+    using CPtr = typename Ops::CPtr;
+
+    TiledCrout(int n, bool symmetric, const OutOfCoreOptions &options)
+        : n_(n), symmetric_(symmetric), prec_(mpfr::mpreal::get_default_prec()),
+          codec_(ops_, prec_), elem_(codec_.size()), D_(ops_.vector(symmetric ? n : 0))
+    {
+        if (n <= 0)
+            throw std::invalid_argument("Matrix must not be empty.");
+        // w pamięci naraz: panel, wiersz liczony, czytany i zapisywany (+ L·D)
+        const std::size_t rows = symmetric ? 5 : 4;
+        std::size_t nb = options.tile > 0 ? std::size_t(options.tile)
+                                          : options.memoryLimit / (rows * std::size_t(n) * elem_);
+        nb_ = int(std::clamp<std::size_t>(nb, std::size_t(std::min(n, kMinTile)), std::size_t(n)));
+        t_  = (n + nb_ - 1) / nb_;
+        file_ = utils::TileFile::create(options.tilePath, std::uint64_t(t_) * t_ + t_,
+                                        std::size_t(nb_) * nb_ * elem_);
+    }
+
+    int tile() const { return nb_; }
+
+    // Wypełnia plik kafelkami A; put(dst, i, j) wpisuje A[i][j] do dst.
+    // LDLᵀ czyta tylko dolny trójkąt.
+    template <typename Put>
+    void load(Put put)
+    {
+        for (int I = 0; I < t_; ++I)
+            for (int J = 0; J <= (symmetric_ ? I : t_ - 1); ++J) {
+                Row owned;
+                owned.push_back(ops_.matrix(nb_, nb_));
+                for (int i = 0; i < dim(I); ++i)
+                    for (int j = 0; j < dim(J); ++j)
+                        put(owned[0].row(i) + j, I * nb_ + i, J * nb_ + j);
+                std::vector<std::pair<std::uint64_t, const Tile *>> tiles{{index(I, J), &owned[0]}};
+                writeAsync(std::move(tiles), std::move(owned));
+            }
+        drain();
+    }
+
+    void factor()
+    {
+        if (symmetric_)
+            factorSymmetric();
+        else
+            factorGeneral();
+    }
+
+    OutOfCoreResult<T> solve(Span<const T> b) const;
+
+private:
+    static constexpr int kMinTile = 16;
+
+    int dim(int I) const { return std::min(nb_, n_ - I * nb_); }
+    std::uint64_t index(int I, int J) const { return std::uint64_t(I) * t_ + J; }
+    // Uᵀ kafelka przekątnego I (general)
+    std::uint64_t diagonalUt(int I) const { return std::uint64_t(t_) * t_ + I; }
+    // (I, J) kafelka k w pliku; slot Uᵀ przekątnej I → (I, I)
+    std::pair<int, int> coords(std::uint64_t k) const
+    {
+        const std::uint64_t square = std::uint64_t(t_) * t_;
+        if (k >= square)
+            return {int(k - square), int(k - square)};
+        return {int(k / t_), int(k % t_)};
+    }
+
+    // ─────────────────────────── wejście / wyjście ──────────────────────────
+
+    Tile readTile(std::uint64_t k) const
+    {
+        const auto [I, J] = coords(k);
+        utils::trace::Scope task("io", "read tile", I, J);
+        std::vector<unsigned char> buf(file_.tileBytes());
+        file_.read(k, buf.data());
+        Tile t = ops_.matrix(nb_, nb_);
+        for (int i = 0; i < nb_; ++i)
+            for (int j = 0; j < nb_; ++j)
+                codec_.decode(buf.data() + (std::size_t(i) * nb_ + j) * elem_, t.row(i) + j);
+        return t;
+    }
+
+    void writeTile(std::uint64_t k, const Tile &t)
+    {
+        const auto [I, J] = coords(k);
+        utils::trace::Scope task("io", "write tile", I, J);
+        std::vector<unsigned char> buf(file_.tileBytes());
+        for (int i = 0; i < nb_; ++i)
+            for (int j = 0; j < nb_; ++j)
+                codec_.encode(buf.data() + (std::size_t(i) * nb_ + j) * elem_, t.row(i) + j);
+        file_.write(k, buf.data());
+    }
+
+    // Kafelki (I, j0..j1-1) w tle; domyślna precyzja MPFR jest lokalna dla wątku
+    std::future<Row> readRowAsync(int I, int j0, int j1) const
+    {
+        return std::async(std::launch::async, [this, I, j0, j1] {
+            utils::trace::setThreadName("tile I/O");
+            mpfr::mpreal::set_default_prec(prec_);
+            Row row;
+            row.reserve(std::size_t(j1 - j0));
+            for (int J = j0; J < j1; ++J)
+                row.push_back(readTile(index(I, J)));
+            return row;
+        });
+    }
+
+    // Zapis w tle – najwyżej jeden naraz; owned to kafelki zwalniane po zapisie,
+    // pozostałe muszą żyć do drain()
+    void writeAsync(std::vector<std::pair<std::uint64_t, const Tile *>> tiles, Row owned = {})
+    {
+        drain();
+        writing_ = std::async(std::launch::async,
+                              [this, tiles = std::move(tiles), owned = std::move(owned)] {
+                                  utils::trace::setThreadName("tile I/O");
+                                  for (const auto &t : tiles)
+                                      writeTile(t.first, *t.second);
+                              });
+    }
+
+    void drain()
+    {
+        if (writing_.valid()) {
+            utils::trace::Scope wait("wait", "tile write");
+            writing_.get();
+        }
+    }
+
+    // Wiersz kafelków czytany w tle; czas oczekiwania widać na osi czasu
+    static Row await(std::future<Row> &row, int I)
+    {
+        utils::trace::Scope wait("wait", "tile read", I);
+        return row.get();
+    }
+
+    // Kafelki po kolei z czytaniem następnego w tle; fn(k, tile)
+    template <typename F>
+    void stream(const std::vector<std::uint64_t> &order, F fn) const
+    {
+        auto fetch = [this](std::uint64_t k) {
+            return std::async(std::launch::async, [this, k] {
+                utils::trace::setThreadName("tile I/O");
+                mpfr::mpreal::set_default_prec(prec_);
+                return readTile(k);
+            });
+        };
+        std::future<Tile> next;
+        if (!order.empty())
+            next = fetch(order[0]);
+        for (std::size_t s = 0; s < order.size(); ++s) {
+            Tile t = [&] {
+                const auto [I, J] = coords(order[s]);
+                utils::trace::Scope wait("wait", "tile read", I, J);
+                return next.get();
+            }();
+            if (s + 1 < order.size())
+                next = fetch(order[s + 1]);
+            fn(s, t);
+        }
+    }
+
+    // ─────────────────────────────── general ────────────────────────────────
+
+    void factorGeneral()
+    {
+        auto sum = ops_.reg();
+        auto first = readRowAsync(0, 0, t_);
+        Row panel = await(first, 0);  // (k, k..t-1) po krokach < k
+
+        for (int k = 0; k < t_; ++k) {
+            const int mk = dim(k);
+            // zapisy kroku k − 1 już zakończone (drain)
+            utils::control::checkpoint(std::int64_t(k) * nb_, n_);
+
+            // zapis w tle wskazuje na panel i U – przy wyjątku czekamy na niego
+            Row U;
+            const WriteGuard guard(writing_);
+
+            // S_kk = L_kk·U_kk w miejscu (L), Uᵀ osobno – jak silnik w pamięci
+            std::optional<utils::trace::Scope> task(std::in_place, "factor", "diagonal tile", k, k);
+            U.reserve(std::size_t(t_ - k));
+            U.push_back(ops_.matrix(nb_, nb_));
+            Tile &L = panel[0];
+            Tile &Ukk = U[0];
+            for (int i = 0; i < mk; ++i) {
+                for (int j = i; j < mk; ++j) {
+                    ops_.dot(sum, L.row(i), Ukk.row(j), i);
+                    ops_.sub(Ukk.row(j) + i, L.row(i) + j, sum);
+                }
+                if constexpr (Ops::checksPivot) {
+                    if (k * nb_ + i + 1 < n_ && ops_.isZero(Ukk.row(i) + i))
+                        throw ZeroPivot("Zero pivot");
+                }
+                ops_.setOne(L.row(i) + i);
+                for (int j = i + 1; j < mk; ++j) {
+                    ops_.dot(sum, L.row(j), Ukk.row(i), i);
+                    ops_.subDiv(L.row(j) + i, L.row(j) + i, sum, Ukk.row(i) + i);
+                }
+            }
+
+            // Uᵀ_kJ = (L_kk⁻¹·S_kJ)ᵀ
+            task.emplace("factor", "U row", k);
+            for (int J = k + 1; J < t_; ++J) {
+                U.push_back(ops_.matrix(nb_, nb_));
+                const Tile &S = panel[std::size_t(J - k)];
+                Tile &Ut = U.back();
+                for (int c = 0; c < dim(J); ++c)
+                    for (int i = 0; i < mk; ++i) {
+                        ops_.dot(sum, L.row(i), Ut.row(c), i);
+                        ops_.sub(Ut.row(c) + i, S.row(i) + c, sum);
+                    }
+            }
+            task.reset();
+            panel.erase(panel.begin() + 1, panel.end());  // S_kJ już niepotrzebne, L_kk zostaje do zapisu
+
+            std::vector<std::pair<std::uint64_t, const Tile *>> done{{index(k, k), &panel[0]},
+                                                                     {diagonalUt(k), &U[0]}};
+            for (int J = k + 1; J < t_; ++J)
+                done.push_back({index(k, J), &U[std::size_t(J - k)]});
+            writeAsync(std::move(done));
+
+            // wiersze I > k: L_Ik = S_Ik·U_kk⁻¹, potem S_IJ −= L_Ik·U_kJ
+            Row nextPanel;
+            std::future<Row> next;
+            if (k + 1 < t_)
+                next = readRowAsync(k + 1, k, t_);
+            for (int I = k + 1; I < t_; ++I) {
+                Row row = await(next, I);
+                if (I + 1 < t_)
+                    next = readRowAsync(I + 1, k, t_);
+                const int mi = dim(I);
+
+                utils::trace::Scope rowTask("factor", "update row", I, k);
+                Tile &Lik = row[0];
+                for (int r = 0; r < mi; ++r)
+                    for (int j = 0; j < mk; ++j) {
+                        ops_.dot(sum, Lik.row(r), Ukk.row(j), j);
+                        ops_.subDiv(Lik.row(r) + j, Lik.row(r) + j, sum, Ukk.row(j) + j);
+                    }
+                for (int J = k + 1; J < t_; ++J)
+                    ops_.subMatMulNT(mi, dim(J), mk, Lik.row(0), nb_, U[std::size_t(J - k)].row(0), nb_,
+                                     row[std::size_t(J - k)].row(0), nb_);
+
+                std::vector<std::pair<std::uint64_t, const Tile *>> tiles{{index(I, k), &row[0]}};
+                if (I == k + 1) {
+                    // reszta wiersza to panel kroku k + 1 – bez zapisu i ponownego czytania
+                    nextPanel.assign(std::make_move_iterator(row.begin() + 1),
+                                     std::make_move_iterator(row.end()));
+                    row.erase(row.begin() + 1, row.end());
+                } else {
+                    for (int J = k + 1; J < t_; ++J)
+                        tiles.push_back({index(I, J), &row[std::size_t(J - k)]});
+                }
+                writeAsync(std::move(tiles), std::move(row));
+            }
+            drain();  // U i L_kk przestają żyć
+            panel = std::move(nextPanel);
+        }
+        utils::control::checkpoint(n_, n_);
+    }
+
+    // ────────────────────────────── symmetric ───────────────────────────────
+
+    void factorSymmetric()
+    {
+        auto sum = ops_.reg();
+        auto first = readRowAsync(0, 0, 1);
+        Row diag = await(first, 0);  // S_kk po krokach < k
+
+        for (int k = 0; k < t_; ++k) {
+            const int mk = dim(k);
+            const Ptr D = D_.data() + std::ptrdiff_t(k) * nb_;
+            utils::control::checkpoint(std::int64_t(k) * nb_, n_);
+            // zapis w tle wskazuje na diag i Lcol – przy wyjątku czekamy na niego
+            Row Lcol;
+            const WriteGuard guard(writing_);
+
+            // S_kk = L_kk·D_k·L_kkᵀ w miejscu; W wiersz j = D ∘ L_kk[j]
+            std::optional<utils::trace::Scope> task(std::in_place, "factor", "diagonal tile", k, k);
+            Tile &L = diag[0];
+            Tile W = ops_.matrix(nb_, nb_);
+            for (int j = 0; j < mk; ++j) {
+                ops_.mulRows(W.row(j), D, L.row(j), j);
+                ops_.dot(sum, L.row(j), W.row(j), j);
+                ops_.sub(D + j, L.row(j) + j, sum);
+                if constexpr (Ops::checksPivot) {
+                    if (ops_.isZero(D + j))
+                        throw ZeroPivot("Zero pivot in LDLT decomposition");
+                }
+                ops_.setOne(L.row(j) + j);
+                for (int i = j + 1; i < mk; ++i) {
+                    ops_.dot(sum, L.row(i), W.row(j), j);
+                    ops_.subDiv(L.row(i) + j, L.row(i) + j, sum, D + j);
+                }
+            }
+            task.reset();
+            writeAsync({{index(k, k), &diag[0]}});
+
+            // kolumna k: L_Ik dla I > k (indeks I − k − 1); adresy trafiają do
+            // zapisu w tle, więc bez realokacji. LD = L_Ik·D_k bieżącego wiersza.
+            Lcol.reserve(std::size_t(t_ - k));
+            Tile LD = ops_.matrix(nb_, nb_);
+            Row nextDiag;
+            std::future<Row> next;
+            if (k + 1 < t_)
+                next = readRowAsync(k + 1, k, k + 2);
+            for (int I = k + 1; I < t_; ++I) {
+                Row row = await(next, I);
+                if (I + 1 < t_)
+                    next = readRowAsync(I + 1, k, I + 2);
+                const int mi = dim(I);
+
+                utils::trace::Scope rowTask("factor", "update row", I, k);
+                Lcol.push_back(std::move(row[0]));
+                Tile &Lik = Lcol.back();
+                for (int r = 0; r < mi; ++r)
+                    for (int j = 0; j < mk; ++j) {
+                        ops_.dot(sum, Lik.row(r), W.row(j), j);
+                        ops_.subDiv(Lik.row(r) + j, Lik.row(r) + j, sum, D + j);
+                    }
+                for (int r = 0; r < mi; ++r)
+                    ops_.mulRows(LD.row(r), D, Lik.row(r), mk);
+
+                // S_IJ −= (L_Ik·D_k)·L_Jkᵀ dla k < J ≤ I
+                for (int J = k + 1; J <= I; ++J)
+                    ops_.subMatMulNT(mi, dim(J), mk, LD.row(0), nb_, Lcol[std::size_t(J - k - 1)].row(0), nb_,
+                                     row[std::size_t(J - k)].row(0), nb_);
+
+                std::vector<std::pair<std::uint64_t, const Tile *>> tiles{{index(I, k), &Lik}};
+                if (I == k + 1) {
+                    nextDiag.push_back(std::move(row[1]));  // S_{k+1,k+1} – następny krok
+                    writeAsync(std::move(tiles));
+                } else {
+                    for (int J = k + 1; J <= I; ++J)
+                        tiles.push_back({index(I, J), &row[std::size_t(J - k)]});
+                    writeAsync(std::move(tiles), std::move(row));
+                }
+            }
+            drain();
+            diag = std::move(nextDiag);
+        }
+        utils::control::checkpoint(n_, n_);
+    }
+
+    const traits::Instrumented<Ops> ops_{};
+    int n_;
+    bool symmetric_;
+    mpfr_prec_t prec_;
+    ElementCodec<T, Ops> codec_;
+    std::size_t elem_;
+    int nb_ = 0;
+    int t_ = 0;
+    typename Ops::Vector D_;
+    utils::TileFile file_;
+    std::future<void> writing_;
+};
+
+template <typename T, typename Ops>
+OutOfCoreResult<T> TiledCrout<T, Ops>::solve(Span<const T> b) const
+{
+    if (b.size() != static_cast<std::size_t>(n_))
+        throw std::invalid_argument("Vector size does not match matrix dimension.");
+
+    using Stats = utils::SolveStats;
+    utils::instrument::PhaseClock phase(&Stats::forwardNs);
+    auto sum = ops_.reg();
+    auto y = ops_.vector(n_);
+    auto z = ops_.vector(n_);
+    auto x = ops_.vector(n_);
+    for (int i = 0; i < n_; ++i)
+        ops_.put(y.data() + i, b[i]);
+    auto at = [&](auto &v, int I) { return v.data() + std::ptrdiff_t(I) * nb_; };
+
+    // L·y = b wierszami kafelków: (I, 0..I)
+    std::vector<std::uint64_t> order;
+    std::vector<std::pair<int, int>> where;
+    for (int I = 0; I < t_; ++I)
+        for (int J = 0; J <= I; ++J) {
+            order.push_back(index(I, J));
+            where.push_back({I, J});
+        }
+    stream(order, [&](std::size_t s, const Tile &L) {
+        const auto [I, J] = where[s];
+        utils::trace::Scope task("solve", "forward tile", I, J);
+        const auto yi = at(y, I);
+        for (int r = 0; r < dim(I); ++r) {
+            // kafelek przekątny: tylko część pod przekątną, L[r][r] == 1
+            ops_.dot(sum, L.row(r), I == J ? yi : at(y, J), I == J ? r : dim(J));
+            ops_.sub(yi + r, yi + r, sum);
+        }
+    });
+
+    // symmetric: D·z = y
+    phase.next(&Stats::scalingNs);
+    for (int i = 0; i < n_; ++i) {
+        if (symmetric_)
+            ops_.div(z.data() + i, y.data() + i, D_.data() + i);
+        else
+            ops_.copy(z.data() + i, y.data() + i);
+    }
+
+    // U·x = z od ostatniego wiersza kafelków. Uᵀ_IJ – general: kafelek (I, J)
+    // i osobny slot przekątnej, symmetric: L_JI z jedynkami na przekątnej.
+    // Kolumny U są wierszami kafelka, więc odejmujemy je kolejno od z.
+    phase.next(&Stats::backwardNs);
+    order.clear();
+    where.clear();
+    for (int I = t_ - 1; I >= 0; --I) {
+        for (int J = t_ - 1; J > I; --J) {
+            order.push_back(symmetric_ ? index(J, I) : index(I, J));
+            where.push_back({I, J});
+        }
+        order.push_back(symmetric_ ? index(I, I) : diagonalUt(I));
+        where.push_back({I, I});
+    }
+    stream(order, [&](std::size_t s, const Tile &Ut) {
+        const auto [I, J] = where[s];
+        utils::trace::Scope task("solve", "backward tile", I, J);
+        const auto zi = at(z, I);
+        const auto xi = at(x, I);
+        if (I != J) {
+            const auto xj = at(x, J);
+            for (int c = 0; c < dim(J); ++c)
+                for (int r = 0; r < dim(I); ++r)
+                    ops_.subMul(zi + r, Ut.row(c) + r, xj + c, zi + r);
+            return;
+        }
+        for (int i = dim(I) - 1; i >= 0; --i) {
+            if (symmetric_) {
+                ops_.copy(xi + i, zi + i);
+            } else {
+                if constexpr (Ops::checksPivot) {
+                    if (ops_.isZero(Ut.row(i) + i))
+                        throw ZeroPivot("Zero pivot");
+                }
+                ops_.div(xi + i, zi + i, Ut.row(i) + i);
+            }
+            for (int r = 0; r < i; ++r)
+                ops_.subMul(zi + r, Ut.row(i) + r, xi + i, zi + r);
+        }
+    });
+    phase.stop();
+
+    OutOfCoreResult<T> res;
+    res.y.reserve(n_);
+    res.x.reserve(n_);
+    for (int i = 0; i < n_; ++i) {
+        res.y.push_back(ops_.get(y.data() + i));
+        res.x.push_back(ops_.get(x.data() + i));
+    }
+    return res;
+}
+
+} // namespace outofcore
+} // namespace solver
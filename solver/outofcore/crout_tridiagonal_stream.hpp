@@ -0,0 +1,270 @@
+#pragma once
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "mpreal.h"
+#include "solver/outofcore/crout_outofcore.h"
+#include "solver/outofcore/outofcore_io.hpp"
+#include "solver/traits/counting_ops.hpp"
+#include "solver/traits/scalar_ops.hpp"
+#include "utils/matrix_file.h"
+#include "utils/tile_file.h"
+#include "utils/trace.h"
+
+namespace solver {
+namespace outofcore {
+
+/**
+ * Crout trójdiagonalny strumieniowo, blokami po m elementów – te same
+ * operacje Ops co solver::tridiagonal::croutTridiagonal, więc ten sam wynik.
+ *
+ * Przebieg w przód czyta a, d, c, b kolejno z mapowań .crm, liczy diag i y
+ * i zapisuje je w tle do pliku roboczego (blok k → kafelek k: m rekordów diag,
+ * potem m rekordów y); l żyje tylko przez jeden krok. Przebieg wstecz czyta
+ * kafelki od końca z czytaniem poprzedniego w tle, c ponownie z wejścia,
+ * i koduje x prosto w zmapowany plik wynikowy. W pamięci jest stała liczba
+ * bloków, niezależnie od n.
+ */
+template <typename T, typename Ops = traits::ScalarOps<T>>
+class StreamingTridiagonal {
+public:
+    using Vector = typename Ops::Vector;
+    using Ptr    = typename Ops::Ptr;
+
+    StreamingTridiagonal(const utils::MatrixFile &A, const utils::MatrixFile &b, const OutOfCoreOptions &options)
+        : A_(A), b_(b), n_(A.rows()), prec_(mpfr::mpreal::get_default_prec()), codec_(ops_, prec_)
+    {
+        if (A.scalar() != utils::ScalarTypeOf<T>::value || b.scalar() != A.scalar())
+            throw std::invalid_argument("Matrix file scalar type does not match.");
+        if (A.layout() != utils::StorageLayout::Tridiagonal || A.cols() != n_ || n_ == 0)
+            throw std::invalid_argument("Streaming solver needs a file in tridiagonal layout.");
+        if (b.layout() != utils::StorageLayout::Dense || b.cols() != 1 || b.rows() != n_)
+            throw std::invalid_argument("Vector size does not match matrix dimension.");
+
+        // w pamięci naraz: a, d, c, b, dwa bufory (diag, y) przebiegu w przód
+        std::uint64_t m = options.tile > 0 ? std::uint64_t(options.tile)
+                                           : options.memoryLimit / (8 * codec_.size());
+        m_ = int(std::clamp<std::uint64_t>(m, std::min<std::uint64_t>(n_, kMinBlock),
+                                           std::min<std::uint64_t>(n_, INT_MAX / 2)));
+        blocks_ = (n_ + m_ - 1) / std::uint64_t(m_);
+        file_ = utils::TileFile::create(options.tilePath, blocks_, 2 * std::size_t(m_) * codec_.size());
+    }
+
+    int block() const { return m_; }
+
+    StreamResult solve(const std::string &xPath)
+    {
+        using Stats = utils::SolveStats;
+        utils::instrument::Scope collect;
+        StreamResult r;
+        r.n = n_;
+        {
+            utils::instrument::PhaseClock phase(&Stats::factorizationNs);
+            r.singular = !forward();
+            phase.next(&Stats::backwardNs);
+            backward(xPath, r.singular);
+        }
+        r.stats = collect.stop();
+        return r;
+    }
+
+private:
+    static constexpr std::uint64_t kMinBlock = 64;
+
+    // diag i y jednego bloku
+    struct Block {
+        Vector diag, y;
+    };
+
+    int len(std::uint64_t k) const { return int(std::min<std::uint64_t>(m_, n_ - k * m_)); }
+
+    // Indeksy w danych układu Tridiagonal: a (n-1), d (n), c (n-1)
+    std::int64_t aIndex(std::uint64_t i) const { return std::int64_t(i) - 1; }
+    std::int64_t dIndex(std::uint64_t i) const { return std::int64_t(n_ - 1 + i); }
+    std::int64_t cIndex(std::uint64_t i) const { return std::int64_t(2 * n_ - 1 + i); }
+
+    Block makeBlock() const { return {ops_.vector(m_), ops_.vector(m_)}; }
+
+    // false przy zerowym pivocie (tylko Ops::checksPivot)
+    bool forward()
+    {
+        auto a = ops_.vector(m_), d = ops_.vector(m_), c = ops_.vector(m_), rhs = ops_.vector(m_);
+        auto l = ops_.vector(1);
+        // diag, y i c ostatniego elementu poprzedniego bloku
+        auto carry = ops_.vector(3);
+        Block buf[2] = {makeBlock(), makeBlock()};
+        // zapis w tle wskazuje na buf – przy wyjątku (np. uszkodzony rekord
+        // MPFR w następnym bloku) czekamy na niego, zanim buf zniknie
+        const WriteGuard guard(writing_);
+
+        for (std::uint64_t k = 0; k < blocks_; ++k) {
+            const std::uint64_t start = k * m_;
+            const int m = len(k);
+            // poprzedni zapis w tle używa drugiego bufora
+            Block &cur = buf[k % 2];
+            const Ptr diag = cur.diag.data(), y = cur.y.data();
+            utils::trace::Scope task("factor", "forward block", int(k));
+
+            for (int j = 0; j < m; ++j) {
+                const std::uint64_t i = start + j;
+                putFileElement<T>(ops_, d.data() + j, A_, dIndex(i));
+                putFileElement<T>(ops_, rhs.data() + j, b_, std::int64_t(i));
+                if (i > 0)
+                    putFileElement<T>(ops_, a.data() + j, A_, aIndex(i));
+                if (i + 1 < n_)
+                    putFileElement<T>(ops_, c.data() + j, A_, cIndex(i));
+            }
+
+            for (int j = 0; j < m; ++j) {
+                if (start + j == 0) {
+                    ops_.copy(diag, d.data());
+                    ops_.copy(y, rhs.data());
+                } else {
+                    const auto prevDiag = j ? diag + (j - 1) : carry.data();
+                    const auto prevY    = j ? y + (j - 1) : carry.data() + 1;
+                    const auto prevC    = j ? c.data() + (j - 1) : carry.data() + 2;
+                    ops_.div(l.data(), a.data() + j, prevDiag);
+                    ops_.subMul(diag + j, l.data(), prevC, d.data() + j);
+                    ops_.subMul(y + j, l.data(), prevY, rhs.data() + j);
+                }
+                if constexpr (Ops::checksPivot) {
+                    if (ops_.isZero(diag + j)) {
+                        drain();
+                        return false;
+                    }
+                }
+            }
+
+            ops_.copy(carry.data(), diag + (m - 1));
+            ops_.copy(carry.data() + 1, y + (m - 1));
+            if (start + m < n_)
+                ops_.copy(carry.data() + 2, c.data() + (m - 1));
+            writeAsync(k, cur);
+        }
+        drain();
+        return true;
+    }
+
+    void backward(const std::string &xPath, bool singular)
+    {
+        utils::MatrixFile X = utils::MatrixFile::create(
+            xPath, utils::makeHeader(utils::ScalarTypeOf<T>::value, utils::StorageLayout::Dense, n_, 1, 0, 0, prec_));
+        const std::size_t rec = codec_.size();
+        unsigned char *out = X.payload();
+
+        auto x = ops_.vector(m_), c = ops_.vector(m_);
+        // x pierwszego elementu następnego bloku
+        auto xNext = ops_.vector(1);
+
+        if (singular) {
+            // jak solver w pamięci: osobliwość to x wypełnione NaN
+            if constexpr (Ops::checksPivot) {
+                ops_.setNan(x.data());
+                for (std::uint64_t i = 0; i < n_; ++i)
+                    codec_.encode(out + i * rec, x.data());
+            }
+            X.flush();
+            return;
+        }
+
+        std::future<Block> next = readAsync(blocks_ - 1);
+        for (std::uint64_t k = blocks_; k-- > 0;) {
+            Block cur = [&] {
+                utils::trace::Scope wait("wait", "block read", int(k));
+                return next.get();
+            }();
+            utils::trace::Scope task("solve", "backward block", int(k));
+            if (k > 0)
+                next = readAsync(k - 1);
+            const std::uint64_t start = k * m_;
+            const int m = len(k);
+            const Ptr diag = cur.diag.data(), y = cur.y.data();
+
+            for (int j = 0; j < m; ++j)
+                if (start + j + 1 < n_)
+                    putFileElement<T>(ops_, c.data() + j, A_, cIndex(start + j));
+
+            for (int j = m - 1; j >= 0; --j) {
+                if (start + j + 1 == n_) {
+                    ops_.div(x.data() + j, y + j, diag + j);
+                    continue;
+                }
+                const auto xi1 = j + 1 < m ? x.data() + (j + 1) : xNext.data();
+                ops_.subMul(x.data() + j, c.data() + j, xi1, y + j);
+                ops_.div(x.data() + j, x.data() + j, diag + j);
+            }
+            ops_.copy(xNext.data(), x.data());
+
+            for (int j = 0; j < m; ++j)
+                codec_.encode(out + (start + j) * rec, x.data() + j);
+        }
+        X.flush();
+    }
+
+    // ─────────────────────────── plik roboczy ─────────────────────────────
+
+    // Zapis bloku w tle – najwyżej jeden naraz, bufor żyje do drain()
+    // (forward() pilnuje tego WriteGuard także przy wyjątku)
+    void writeAsync(std::uint64_t k, const Block &blk)
+    {
+        drain();
+        writing_ = std::async(std::launch::async, [this, k, &blk] {
+            utils::trace::setThreadName("block I/O");
+            utils::trace::Scope task("io", "write block", int(k));
+            const std::size_t rec = codec_.size();
+            std::vector<unsigned char> buf(file_.tileBytes());
+            for (int j = 0; j < len(k); ++j) {
+                codec_.encode(buf.data() + std::size_t(j) * rec, blk.diag.data() + j);
+                codec_.encode(buf.data() + (std::size_t(m_) + j) * rec, blk.y.data() + j);
+            }
+            file_.write(k, buf.data());
+        });
+    }
+
+    void drain()
+    {
+        if (writing_.valid()) {
+            utils::trace::Scope wait("wait", "block write");
+            writing_.get();
+        }
+    }
+
+    // Blok k w tle; domyślna precyzja MPFR jest lokalna dla wątku
+    std::future<Block> readAsync(std::uint64_t k) const
+    {
+        return std::async(std::launch::async, [this, k] {
+            utils::trace::setThreadName("block I/O");
+            utils::trace::Scope task("io", "read block", int(k));
+            mpfr::mpreal::set_default_prec(prec_);
+            const std::size_t rec = codec_.size();
+            std::vector<unsigned char> buf(file_.tileBytes());
+            file_.read(k, buf.data());
+            Block blk = makeBlock();
+            for (int j = 0; j < len(k); ++j) {
+                codec_.decode(buf.data() + std::size_t(j) * rec, blk.diag.data() + j);
+                codec_.decode(buf.data() + (std::size_t(m_) + j) * rec, blk.y.data() + j);
+            }
+            return blk;
+        });
+    }
+
+    const traits::Instrumented<Ops> ops_{};
+    const utils::MatrixFile &A_;
+    const utils::MatrixFile &b_;
+    std::uint64_t n_;
+    mpfr_prec_t prec_;
+    ElementCodec<T, Ops> codec_;
+    int m_ = 0;
+    std::uint64_t blocks_ = 0;
+    utils::TileFile file_;
+    std::future<void> writing_;
+};
+
+} // namespace outofcore
+} // namespace solver
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <type_traits>
+#include <mpfr.h>
+#include "mpreal.h"
+#include "solver/traits/scalar_ops.hpp"
+#include "utils/matrix_file.h"
+
+namespace solver {
+namespace outofcore {
+
+/**
+ * Elementy magazynu Ops w rekordach o układzie .crm (utils::storeElement) –
+ * tak trafiają do plików roboczych rozkładów poza pamięcią. Bloki MPFR
+ * kopiowane są rekord ↔ mpfr_t bez tymczasowego mpreal; precyzja stała,
+ * więc zapis i odczyt są dokładne.
+ */
+template <typename T, typename Ops = traits::ScalarOps<T>>
+class ElementCodec {
+public:
+    using Ptr  = typename Ops::Ptr;
+    using CPtr = typename Ops::CPtr;
+
+    ElementCodec(const Ops &ops, mpfr_prec_t prec)
+        : ops_(ops), prec_(prec), size_(utils::elementSize(utils::ScalarTypeOf<T>::value, prec)) {}
+
+    // Bajty jednego rekordu
+    std::size_t size() const { return size_; }
+
+    void encode(unsigned char *rec, CPtr p) const
+    {
+        if constexpr (std::is_same<CPtr, mpfr_srcptr>::value)
+            utils::encodeMpfr(rec, p, prec_, MPFR_RNDN);
+        else
+            utils::storeElement<T>(rec, ops_.get(p), prec_);
+    }
+
+    void decode(const unsigned char *rec, Ptr p) const
+    {
+        if constexpr (std::is_same<Ptr, mpfr_ptr>::value) {
+            __mpfr_struct view;
+            mpfr_set(p, utils::decodeMpfr(rec, prec_, view), MPFR_RNDN);
+        } else {
+            ops_.put(p, utils::loadElement<T>(rec, prec_));
+        }
+    }
+
+private:
+    const Ops &ops_;
+    mpfr_prec_t prec_;
+    std::size_t size_;
+};
+
+// dst := element k pliku .crm (k < 0 → zero, poza zapisanym obszarem);
+// rekordy MPFR prosto do bloku, w precyzji dst
+template <typename T, typename Ops>
+void putFileElement(const Ops &ops, typename Ops::Ptr dst, const utils::MatrixFile &f, std::int64_t k)
+{
+    if constexpr (std::is_same<typename Ops::Ptr, mpfr_ptr>::value) {
+        __mpfr_struct view;
+        if (k < 0)
+            mpfr_set_zero(dst, 1);
+        else
+            mpfr_set(dst, f.mpfrView(std::uint64_t(k), view), MPFR_RNDN);
+    } else {
+        ops.put(dst, k >= 0 ? f.get<T>(std::uint64_t(k)) : T());
+    }
+}
+
+/**
+ * Zapis w tle dostaje wskaźniki na bufory wołającego. Strażnik deklarowany
+ * zaraz po tych buforach czeka przy wyjątku na zakończenie zapisu, zanim
+ * bufory zostaną zwolnione; wyjątek samego zapisu zostaje w future
+ * i nie przesłania pierwszego.
+ */
+class WriteGuard {
+public:
+    explicit WriteGuard(std::future<void> &writing) : writing_(writing) {}
+    ~WriteGuard()
+    {
+        if (writing_.valid())
+            writing_.wait();
+    }
+    WriteGuard(const WriteGuard &) = delete;
+    WriteGuard &operator=(const WriteGuard &) = delete;
+
+private:
+    std::future<void> &writing_;
+};
+
+} // namespace outofcore
+} // namespace solver
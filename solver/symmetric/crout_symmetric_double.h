@@ -1,22 +1,14 @@
 #pragma once
-#include <tuple>
-#include <QVector>
+#include "solver/crout_types.h"
 
 namespace solver {
 namespace symmetric {
 
 /**
  * Rozkład LDLᵀ dla macierzy symetrycznej (niekoniecznie SPD).
- * Zwraca (L, U=D·Lᵀ, y, x).
+ * Zwraca L, U=D·Lᵀ, y, x.
  */
-std::tuple<
-    QVector<QVector<double>>,
-    QVector<QVector<double>>,
-    QVector<double>,
-    QVector<double>
->
-solveCroutSymmetric(const QVector<QVector<double>> &A,
-                    const QVector<double>         &b);
+CroutResult<double> solveCroutSymmetric(MatrixView<const double> A, Span<const double> b);
 
 } // namespace symmetric
 } // namespace solver
@@ -0,0 +1,147 @@
+#pragma once
+#include <algorithm>
+#include <stdexcept>
+#include "solver/crout_types.h"
+#include "solver/traits/counting_ops.hpp"
+#include "solver/traits/scalar_ops.hpp"
+#include "utils/instrumentation.h"
+#include "utils/solve_control.h"
+#include "utils/trace.h"
+
+namespace solver {
+namespace symmetric {
+
+/**
+ * Crout–LDLᵀ (L[i][i] = 1) dla dowolnego typu z cechami traits::ScalarOps<T>.
+ * Zwraca L, U = D·Lᵀ, y, x: L·y = b, D·z = y, Lᵀ·x = z.
+ *
+ * W = D ∘ L[j] liczone jest raz na kolumnę j, więc Σ L[i][k]·D[k]·L[j][k]
+ * to jeden Ops::dot(L[i], W). Gdy Ops::panel > 0, dopełnienie Schura
+ * S22 −= (L21·D11)·L21ᵀ liczy Ops::subMatMulNT. Faza scaling w stats
+ * to D·z = y.
+ */
+template <typename T, typename Ops = traits::ScalarOps<T>>
+CroutResult<T> croutSymmetric(MatrixView<const T> A, Span<const T> b)
+{
+    const int n = A.rows();
+    if (A.cols() != n)
+        throw std::invalid_argument("Matrix must be square.");
+    if (b.size() != static_cast<std::size_t>(n))
+        throw std::invalid_argument("Vector size does not match matrix dimension.");
+
+    using Stats = utils::SolveStats;
+    utils::instrument::Scope collect;
+    const traits::Instrumented<Ops> ops{};
+    utils::instrument::PhaseClock phase(&Stats::factorizationNs);
+
+    auto L = ops.matrix(n, n);
+    auto D = ops.vector(n);
+    auto W = ops.vector(n);
+    auto y = ops.vector(n);
+    auto z = ops.vector(n);
+    auto x = ops.vector(n);
+    auto sum = ops.reg();
+
+    // S: A z odjętymi wkładami paneli już rozłożonych; bv: b w magazynie cech
+    auto S  = ops.matrix(n, n);
+    auto bv = ops.vector(n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j)
+            ops.put(S.row(i) + j, A[i][j]);
+        ops.put(bv.data() + i, b[i]);
+    }
+
+    const int nb = (Ops::panel > 0 && n > 2 * Ops::panel) ? Ops::panel : std::max(n, 1);
+
+    // Crout–LDLᵀ, panelami kolumn [k0, k1)
+    for (int k0 = 0; k0 < n; k0 += nb) {
+        const int k1 = std::min(n, k0 + nb);
+
+        utils::trace::Scope panelTask("factor", "panel", k0 / nb);
+        for (int j = k0; j < k1; ++j) {
+            utils::control::checkpoint(j, n);
+            const int c = j - k0;
+            ops.mulRows(W.data() + k0, D.data() + k0, L.row(j) + k0, c);
+
+            // D[j] = S[j][j] − Σ L[j][k]·D[k]·L[j][k]
+            ops.dot(sum, L.row(j) + k0, W.data() + k0, c);
+            ops.sub(D.data() + j, S.row(j) + j, sum);
+            if constexpr (Ops::checksPivot) {
+                if (ops.isZero(D.data() + j))
+                    throw ZeroPivot("Zero pivot in LDLT decomposition");
+            }
+
+            // L[i][j] = (S[i][j] − Σ L[i][k]·D[k]·L[j][k]) / D[j]
+            ops.setOne(L.row(j) + j);
+            for (int i = j + 1; i < n; ++i) {
+                ops.dot(sum, L.row(i) + k0, W.data() + k0, c);
+                ops.subDiv(L.row(i) + j, S.row(i) + j, sum, D.data() + j);
+            }
+        }
+
+        // S22 −= (L21·D11)·L21ᵀ
+        if constexpr (Ops::panel > 0) {
+            const int m = n - k1;
+            utils::trace::Scope updateTask("factor", "schur update", k0 / nb);
+            if (m > 0) {
+                auto LD = ops.matrix(m, k1 - k0);
+                for (int r = 0; r < m; ++r)
+                    ops.mulRows(LD.row(r), D.data() + k0, L.row(k1 + r) + k0, k1 - k0);
+                ops.subMatMulNT(m, m, k1 - k0,
+                                LD.row(0), k1 - k0, L.row(k1) + k0, n,
+                                S.row(k1) + k1, n);
+            }
+        }
+    }
+    utils::control::checkpoint(n, n);
+
+    // U = D·Lᵀ i Lᵀ wierszami (do podstawiania wstecz)
+    auto U  = ops.matrix(n, n);
+    auto Lt = ops.matrix(n, n);
+    for (int i = 0; i < n; ++i)
+        for (int j = i; j < n; ++j) {
+            ops.mul(U.row(i) + j, D.data() + i, L.row(j) + i);
+            ops.copy(Lt.row(i) + j, L.row(j) + i);
+        }
+
+    // Forward: L·y = b  (L[i][i] == 1)
+    phase.next(&Stats::forwardNs);
+    for (int i = 0; i < n; ++i) {
+        ops.dot(sum, L.row(i), y.data(), i);
+        ops.sub(y.data() + i, bv.data() + i, sum);
+    }
+
+    // Middle: D·z = y
+    phase.next(&Stats::scalingNs);
+    for (int i = 0; i < n; ++i)
+        ops.div(z.data() + i, y.data() + i, D.data() + i);
+
+    // Backward: Lᵀ·x = z  (Lᵀ[i][i] == 1)
+    phase.next(&Stats::backwardNs);
+    for (int i = n - 1; i >= 0; --i) {
+        ops.dot(sum, Lt.row(i) + i + 1, x.data() + i + 1, n - i - 1);
+        ops.sub(x.data() + i, z.data() + i, sum);
+    }
+
+    phase.stop();
+
+    CroutResult<T> r;
+    r.n = n;
+    r.L.reserve(std::size_t(n) * n);
+    r.U.reserve(std::size_t(n) * n);
+    r.y.reserve(n);
+    r.x.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j)
+            r.L.push_back(ops.get(L.row(i) + j));
+        for (int j = 0; j < n; ++j)
+            r.U.push_back(ops.get(U.row(i) + j));
+        r.y.push_back(ops.get(y.data() + i));
+        r.x.push_back(ops.get(x.data() + i));
+    }
+    r.stats = collect.stop();
+    return r;
+}
+
+} // namespace symmetric
+} // namespace solver
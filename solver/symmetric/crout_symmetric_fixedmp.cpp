@@ -0,0 +1,28 @@
+#include "crout_symmetric_fixedmp.h"
+#include "crout_symmetric_engine.hpp"
+#include "solver/traits/scalar_ops_fixedmp.hpp"
+
+namespace solver {
+namespace symmetric {
+
+template<int Bits>
+CroutResult<fixedmp::FixedMp<Bits>>
+solveCroutSymmetric(MatrixView<const fixedmp::FixedMp<Bits>> A,
+                    Span<const fixedmp::FixedMp<Bits>> b)
+{
+    return croutSymmetric(A, b);
+}
+
+#define CROUT_SYMMETRIC_FIXEDMP(BITS)                                            \
+    template CroutResult<fixedmp::FixedMp<BITS>>                                 \
+    solveCroutSymmetric<BITS>(MatrixView<const fixedmp::FixedMp<BITS>>,          \
+                              Span<const fixedmp::FixedMp<BITS>>);
+
+CROUT_SYMMETRIC_FIXEDMP(128)
+CROUT_SYMMETRIC_FIXEDMP(192)
+CROUT_SYMMETRIC_FIXEDMP(256)
+
+#undef CROUT_SYMMETRIC_FIXEDMP
+
+} // namespace symmetric
+} // namespace solver
@@ -0,0 +1,18 @@
+#pragma once
+#include "fixed_mp.hpp"
+#include "solver/crout_types.h"
+
+namespace solver {
+namespace symmetric {
+
+/**
+ * LDLᵀ (Crout) w stałej precyzji fixedmp::FixedMp<Bits>.
+ * Instancje: 128, 192, 256 bitów. Zwraca L, U=D·Lᵀ, y, x.
+ */
+template<int Bits>
+CroutResult<fixedmp::FixedMp<Bits>>
+solveCroutSymmetric(MatrixView<const fixedmp::FixedMp<Bits>> A,
+                    Span<const fixedmp::FixedMp<Bits>> b);
+
+} // namespace symmetric
+} // namespace solver
@@ -0,0 +1,19 @@
+#include "crout_symmetric_float128.h"
+
+#ifdef CROUT_HAVE_FLOAT128
+
+#include "crout_symmetric_engine.hpp"
+
+namespace solver {
+namespace symmetric {
+
+CroutResult<__float128> solveCroutSymmetric(MatrixView<const __float128> A,
+                                            Span<const __float128> b)
+{
+    return croutSymmetric(A, b);
+}
+
+} // namespace symmetric
+} // namespace solver
+
+#endif // CROUT_HAVE_FLOAT128
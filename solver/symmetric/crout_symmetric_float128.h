@@ -0,0 +1,20 @@
+#pragma once
+#include "float128.hpp"
+#include "solver/crout_types.h"
+
+#ifdef CROUT_HAVE_FLOAT128
+
+namespace solver {
+namespace symmetric {
+
+/**
+ * Crout–LDLᵀ w poczwórnej precyzji IEEE (__float128).
+ * Zwraca L, U = D·Lᵀ, y, x.
+ */
+CroutResult<__float128> solveCroutSymmetric(MatrixView<const __float128> A,
+                                            Span<const __float128> b);
+
+} // namespace symmetric
+} // namespace solver
+
+#endif // CROUT_HAVE_FLOAT128
@@ -1,27 +1,34 @@
 #pragma once
-#include <tuple>
-#include <QVector>
 #include "interval.hpp"
+#include "float128.hpp"
+#include "solver/crout_types.h"
 
 namespace solver {
 namespace symmetric {
 
 using I = interval_arithmetic::Interval<mpfr::mpreal>;
+using ID = interval_arithmetic::Interval<double>;
 
 /**
  * Crout–LDLᵀ dla macierzy symetrycznej w precyzji przedziałowej.
- * Zwraca (L, U, y, x), gdzie U = D·Lᵀ.
+ * Zwraca L, U, y, x, gdzie U = D·Lᵀ.
  */
-std::tuple<
-    QVector<QVector<I>>,  // L
-    QVector<QVector<I>>,  // U
-    QVector<I>,           // y
-    QVector<I>            // x
->
-solveCroutSymmetric(
-    const QVector<QVector<I>>& A,
-    const QVector<I>&          b
-);
+CroutResult<I> solveCroutSymmetric(MatrixView<const I> A, Span<const I> b);
+
+/**
+ * To samo dla końców double; sumy Crouta i wiersze D·L liczone wektorowo
+ * (interval_simd.hpp).
+ */
+CroutResult<ID> solveCroutSymmetric(MatrixView<const ID> A, Span<const ID> b);
+
+#ifdef CROUT_HAVE_FLOAT128
+using IQ = interval_arithmetic::Interval<__float128>;
+
+/**
+ * Końce __float128; zaokrąglanie kierunkowe przez fesetround (soft-fp je respektuje).
+ */
+CroutResult<IQ> solveCroutSymmetric(MatrixView<const IQ> A, Span<const IQ> b);
+#endif
 
 } // namespace symmetric
 } // namespace solver
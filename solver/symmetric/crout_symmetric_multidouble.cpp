@@ -0,0 +1,23 @@
+#include "crout_symmetric_multidouble.h"
+#include "crout_symmetric_engine.hpp"
+#include "solver/traits/scalar_ops_multidouble.hpp"
+
+namespace solver {
+namespace symmetric {
+
+CroutResult<multidouble::DoubleDouble>
+solveCroutSymmetric(MatrixView<const multidouble::DoubleDouble> A,
+                    Span<const multidouble::DoubleDouble> b)
+{
+    return croutSymmetric(A, b);
+}
+
+CroutResult<multidouble::QuadDouble>
+solveCroutSymmetric(MatrixView<const multidouble::QuadDouble> A,
+                    Span<const multidouble::QuadDouble> b)
+{
+    return croutSymmetric(A, b);
+}
+
+} // namespace symmetric
+} // namespace solver
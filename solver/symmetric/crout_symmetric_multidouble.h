@@ -0,0 +1,21 @@
+#pragma once
+#include "multi_double.hpp"
+#include "solver/crout_types.h"
+
+namespace solver {
+namespace symmetric {
+
+/**
+ * Rozkład LDLᵀ w arytmetyce double-double i quad-double.
+ * Zwraca L, U=D·Lᵀ, y, x.
+ */
+CroutResult<multidouble::DoubleDouble>
+solveCroutSymmetric(MatrixView<const multidouble::DoubleDouble> A,
+                    Span<const multidouble::DoubleDouble> b);
+
+CroutResult<multidouble::QuadDouble>
+solveCroutSymmetric(MatrixView<const multidouble::QuadDouble> A,
+                    Span<const multidouble::QuadDouble> b);
+
+} // namespace symmetric
+} // namespace solver
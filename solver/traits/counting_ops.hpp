@@ -0,0 +1,138 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+#include "mpreal.h"
+#include "solver/traits/scalar_ops.hpp"
+#include "utils/instrumentation.h"
+
+namespace interval_arithmetic {
+template <typename T> class Interval;
+}
+
+namespace solver {
+namespace traits {
+
+// Wywołania mpfr_* na jedno działanie Ops; dla Interval<mpreal> działania
+// na końcach (ISub 2, IMul/IDiv 8, składnik IDot 4 + 1 na koniec)
+template <typename T>
+struct MpfrCost {
+    static constexpr std::uint64_t dotInit = 0, dotTerm = 0, sub = 0, subDiv = 0, subMul = 0,
+                                   mul = 0, div = 0, store = 0;
+};
+
+template <>
+struct MpfrCost<mpfr::mpreal> {
+    static constexpr std::uint64_t dotInit = 1, dotTerm = 1, sub = 1, subDiv = 2, subMul = 2,
+                                   mul = 1, div = 1, store = 1;
+};
+
+template <>
+struct MpfrCost<interval_arithmetic::Interval<mpfr::mpreal>> {
+    static constexpr std::uint64_t dotInit = 0, dotTerm = 10, sub = 2, subDiv = 10, subMul = 10,
+                                   mul = 8, div = 8, store = 0;
+};
+
+/**
+ * Cechy Ops z licznikami utils::SolveStats: każde działanie zlecone przez
+ * silnik dolicza flops, wywołania MPFR, sprawdzenia pivota i magazyny, po
+ * czym woła Ops. Operacje złożone (mulRows, subMatMulNT) liczone są w całości
+ * – wewnątrz Ops woła swoje własne działania, już bez liczników.
+ *
+ * Silniki biorą typ przez Instrumented<Ops>: bez CROUT_INSTRUMENTATION to
+ * po prostu Ops.
+ */
+template <typename Ops>
+struct CountingOps : Ops {
+    using Ptr  = typename Ops::Ptr;
+    using CPtr = typename Ops::CPtr;
+    using Reg  = typename Ops::Reg;
+    using Cost = MpfrCost<typename Ops::value_type>;
+    using S    = utils::SolveStats;
+
+    static void count(std::uint64_t flops, std::uint64_t mpfr)
+    {
+        utils::instrument::add(&S::flops, flops);
+        if (mpfr)
+            utils::instrument::add(&S::mpfrOps, mpfr);
+    }
+
+    typename Ops::Matrix matrix(int rows, int cols) const
+    {
+        utils::instrument::add(&S::allocations);
+        return Ops::matrix(rows, cols);
+    }
+    typename Ops::Vector vector(int n) const
+    {
+        utils::instrument::add(&S::allocations);
+        return Ops::vector(n);
+    }
+
+    template <typename V>
+    void put(Ptr p, const V &v) const
+    {
+        count(0, Cost::store);
+        Ops::put(p, v);
+    }
+    void copy(Ptr d, CPtr s) const
+    {
+        count(0, Cost::store);
+        Ops::copy(d, s);
+    }
+    bool isZero(CPtr p) const
+    {
+        utils::instrument::add(&S::pivotChecks);
+        return Ops::isZero(p);
+    }
+
+    void dot(Reg &s, CPtr x, CPtr y, int n) const
+    {
+        count(2 * std::uint64_t(n), Cost::dotInit + Cost::dotTerm * std::uint64_t(n));
+        Ops::dot(s, x, y, n);
+    }
+    void sub(Ptr d, CPtr a, const Reg &s) const
+    {
+        count(1, Cost::sub);
+        Ops::sub(d, a, s);
+    }
+    void subDiv(Ptr d, CPtr a, const Reg &s, CPtr q) const
+    {
+        count(2, Cost::subDiv);
+        Ops::subDiv(d, a, s, q);
+    }
+    void subMul(Ptr d, CPtr a, CPtr b, CPtr c) const
+    {
+        count(2, Cost::subMul);
+        Ops::subMul(d, a, b, c);
+    }
+    void mul(Ptr d, CPtr a, CPtr b) const
+    {
+        count(1, Cost::mul);
+        Ops::mul(d, a, b);
+    }
+    void div(Ptr d, CPtr a, CPtr q) const
+    {
+        count(1, Cost::div);
+        Ops::div(d, a, q);
+    }
+
+    template <typename P, typename A, typename B>
+    void mulRows(P d, A a, B b, int n) const
+    {
+        count(std::uint64_t(n), Cost::mul * std::uint64_t(n));
+        Ops::mulRows(d, a, b, n);
+    }
+    template <typename P, typename X, typename Y>
+    void subMatMulNT(int m, int n, int k, X x, int ldx, Y y, int ldy, P s, int lds) const
+    {
+        const std::uint64_t cells = std::uint64_t(m) * std::uint64_t(n);
+        count(cells * (2 * std::uint64_t(k) + 1),
+              cells * (Cost::dotInit + Cost::dotTerm * std::uint64_t(k) + Cost::sub));
+        Ops::subMatMulNT(m, n, k, x, ldx, y, ldy, s, lds);
+    }
+};
+
+template <typename Ops>
+using Instrumented = std::conditional_t<utils::instrument::kEnabled, CountingOps<Ops>, Ops>;
+
+} // namespace traits
+} // namespace solver
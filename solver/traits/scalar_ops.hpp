@@ -0,0 +1,117 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace solver {
+namespace traits {
+
+// Macierz wierszami w jednym wektorze; row(i) wskazuje początek wiersza
+template <typename T>
+class FlatMatrix {
+public:
+    FlatMatrix(int rows, int cols)
+        : cols_(cols), data_(static_cast<std::size_t>(rows) * cols) {}
+
+    T *row(int i) { return data_.data() + static_cast<std::size_t>(i) * cols_; }
+    const T *row(int i) const { return data_.data() + static_cast<std::size_t>(i) * cols_; }
+
+private:
+    int cols_;
+    std::vector<T> data_;
+};
+
+template <typename T>
+class FlatVector {
+public:
+    explicit FlatVector(int n) : data_(n) {}
+
+    T *data() { return data_.data(); }
+    const T *data() const { return data_.data(); }
+
+private:
+    std::vector<T> data_;
+};
+
+/**
+ * Operacje skalarne dla silników Crouta (solver/<rodzaj>/crout_*_engine.hpp).
+ *
+ * Silnik nie dotyka elementów bezpośrednio: dostaje od cech magazyn (Matrix,
+ * Vector), uchwyty elementów (Ptr/CPtr; uchwyt + k to k-ty element dalej
+ * w wierszu) i rejestr roboczy Reg. Dzięki temu ten sam algorytm działa na
+ * tablicach wartości, blokach MPFR (utils/mp_matrix.h) i przedziałach SoA
+ * (interval_array.hpp).
+ *
+ * ScalarOpsBase daje wersje dla typów z operatorami arytmetycznymi; cechy
+ * konkretnego typu (CRTP) nadpisują tylko to, co robią inaczej – zwykle dot.
+ * Operacje złożone (mulRows, subMatMulNT) wołają operacje pochodnej.
+ */
+template <typename T, typename Derived>
+struct ScalarOpsBase {
+    using value_type = T;
+    using Matrix     = FlatMatrix<T>;
+    using Vector     = FlatVector<T>;
+    using Ptr        = T *;
+    using CPtr       = const T *;
+    using Reg        = T;
+
+    // Szerokość panelu w wersji blokowej; 0 = zwykły Crout
+    static constexpr int panel = 0;
+    // Zerowy pivot przerywa rozkład (przedziały: pivot zawierający zero)
+    static constexpr bool checksPivot = true;
+
+    Matrix matrix(int rows, int cols) const { return Matrix(rows, cols); }
+    Vector vector(int n) const { return Vector(n); }
+    Reg reg() const { return T(0.0); }
+
+    void put(Ptr p, const T &v) const { *p = v; }
+    T get(CPtr p) const { return *p; }
+    void copy(Ptr d, CPtr s) const { *d = *s; }
+    void setOne(Ptr p) const { *p = T(1.0); }
+    void setNan(Ptr p) const { *p = T(std::numeric_limits<double>::quiet_NaN()); }
+    bool isZero(CPtr p) const { return *p == T(0.0); }
+
+    // s = Σ_{k<n} x[k]·y[k]
+    void dot(Reg &s, CPtr x, CPtr y, int n) const {
+        s = T(0.0);
+        for (int k = 0; k < n; ++k)
+            s += x[k] * y[k];
+    }
+    // d = a − s
+    void sub(Ptr d, CPtr a, const Reg &s) const { *d = *a - s; }
+    // d = (a − s) / q
+    void subDiv(Ptr d, CPtr a, const Reg &s, CPtr q) const { *d = (*a - s) / *q; }
+    // d = c − a·b
+    void subMul(Ptr d, CPtr a, CPtr b, CPtr c) const { *d = *c - *a * *b; }
+    void mul(Ptr d, CPtr a, CPtr b) const { *d = *a * *b; }
+    void div(Ptr d, CPtr a, CPtr q) const { *d = *a / *q; }
+
+    // d[k] = a[k]·b[k] dla k < n
+    template <typename P, typename A, typename B>
+    void mulRows(P d, A a, B b, int n) const {
+        for (int k = 0; k < n; ++k)
+            self().mul(d + k, a + k, b + k);
+    }
+
+    // S(i, j) −= Σ_{p<k} X(i, p)·Y(j, p) dla i < m, j < n; ld* to kroki wierszy
+    template <typename P, typename X, typename Y>
+    void subMatMulNT(int m, int n, int k, X x, int ldx, Y y, int ldy, P s, int lds) const {
+        auto sum = self().reg();
+        for (int i = 0; i < m; ++i)
+            for (int j = 0; j < n; ++j) {
+                self().dot(sum, x + std::ptrdiff_t(i) * ldx, y + std::ptrdiff_t(j) * ldy, k);
+                P sij = s + (std::ptrdiff_t(i) * lds + j);
+                self().sub(sij, sij, sum);
+            }
+    }
+
+protected:
+    const Derived &self() const { return static_cast<const Derived &>(*this); }
+};
+
+// Typy z operatorami arytmetycznymi (double, float, __float128) – bez zmian
+template <typename T>
+struct ScalarOps : ScalarOpsBase<T, ScalarOps<T>> {};
+
+} // namespace traits
+} // namespace solver
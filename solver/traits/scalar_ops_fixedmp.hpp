@@ -0,0 +1,28 @@
+#pragma once
+#include "solver/traits/scalar_ops.hpp"
+#include "fixed_mp.hpp"
+
+namespace solver {
+namespace traits {
+
+// FixedMp<Bits>: akumulacja przez mpfr_fma (FixedMp::addMul), jedno
+// zaokrąglenie na składnik
+template <int Bits>
+struct ScalarOps<fixedmp::FixedMp<Bits>>
+    : ScalarOpsBase<fixedmp::FixedMp<Bits>, ScalarOps<fixedmp::FixedMp<Bits>>> {
+    using Base = ScalarOpsBase<fixedmp::FixedMp<Bits>, ScalarOps<fixedmp::FixedMp<Bits>>>;
+    using typename Base::Reg;
+    using typename Base::Ptr;
+    using typename Base::CPtr;
+
+    void dot(Reg &s, CPtr x, CPtr y, int n) const {
+        s.setZero();
+        for (int k = 0; k < n; ++k)
+            s.addMul(x[k], y[k]);
+    }
+    void setNan(Ptr p) const { p->setNan(); }
+    bool isZero(CPtr p) const { return p->isZero(); }
+};
+
+} // namespace traits
+} // namespace solver
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include "interval.hpp"               // najpierw definicja klasy Interval
+#include "interval_rounding_fix.hpp"  // potem specjalizacja SetRounding<mpreal>
+#include "interval_array.hpp"         // SoA i IDot
+#include "interval_simd.hpp"          // jądra wektorowe dla Interval<double>
+#include "interval_midrad.hpp"        // dopełnienie Schura przez iloczyny mid/rad
+#include "solver/traits/scalar_ops.hpp"
+
+namespace solver {
+namespace traits {
+
+// Uchwyt elementu macierzy SoA: para wskaźników na lewy i prawy koniec
+template <typename T>
+struct SoaPtr {
+    T *lo;
+    T *hi;
+
+    SoaPtr(T *l, T *h) : lo(l), hi(h) {}
+    // Ptr → CPtr
+    template <typename U, typename = std::enable_if_t<std::is_convertible<U *, T *>::value>>
+    SoaPtr(const SoaPtr<U> &o) : lo(o.lo), hi(o.hi) {}
+
+    SoaPtr operator+(std::ptrdiff_t k) const { return {lo + k, hi + k}; }
+};
+
+template <typename T>
+class SoaMatrix {
+public:
+    SoaMatrix(int rows, int cols) : m_(rows, cols) {}
+
+    SoaPtr<T> row(int i) { return {m_.loRow(i), m_.hiRow(i)}; }
+    SoaPtr<const T> row(int i) const { return {m_.loRow(i), m_.hiRow(i)}; }
+
+private:
+    interval_arithmetic::IntervalMatrix<T> m_;
+};
+
+template <typename T>
+class SoaVector {
+public:
+    explicit SoaVector(int n) : v_(n) {}
+
+    SoaPtr<T> data() { return {v_.lo(), v_.hi()}; }
+    SoaPtr<const T> data() const { return {v_.lo(), v_.hi()}; }
+
+private:
+    interval_arithmetic::IntervalVector<T> v_;
+};
+
+/**
+ * Interval<T>: magazyn SoA (interval_array.hpp), iloczyny skalarne przez IDot
+ * – dla double jądra wektorowe, a dopełnienie Schura w wersji blokowej przez
+ * iloczyny mid/rad. Zerowy pivot to przedział zawierający zero – ten sam
+ * warunek, przy którym IDiv rzuca wyjątek – więc silniki zgłaszają go jak dla
+ * skalarów (ZeroPivot, a w trójdiagonalnej y i x z końcami NaN).
+ *
+ * Kontekstu zaokrąglania nie trzeba: każde działanie Interval ustawia tryb
+ * samo (SetRounding). Initialize/SetMode zostają w statycznej inicjalizacji
+ * plików solverów – SetPrecision zmienia domyślną precyzję mpreal dla całego
+ * programu, więc nie może się wykonać dopiero przy pierwszym rozwiązaniu.
+ */
+template <typename T>
+struct ScalarOps<interval_arithmetic::Interval<T>>
+    : ScalarOpsBase<interval_arithmetic::Interval<T>, ScalarOps<interval_arithmetic::Interval<T>>> {
+    using I      = interval_arithmetic::Interval<T>;
+    using Matrix = SoaMatrix<T>;
+    using Vector = SoaVector<T>;
+    using Ptr    = SoaPtr<T>;
+    using CPtr   = SoaPtr<const T>;
+    using Reg    = I;
+
+    static constexpr int  panel       = std::is_same<T, double>::value ? 64 : 0;
+
+    Matrix matrix(int rows, int cols) const { return Matrix(rows, cols); }
+    Vector vector(int n) const { return Vector(n); }
+    Reg reg() const { return I(0, 0); }
+
+    void put(Ptr p, const I &v) const {
+        *p.lo = v.a;
+        *p.hi = v.b;
+    }
+    I get(CPtr p) const { return I(*p.lo, *p.hi); }
+    void copy(Ptr d, CPtr s) const {
+        *d.lo = *s.lo;
+        *d.hi = *s.hi;
+    }
+    void setOne(Ptr p) const { put(p, I(1, 1)); }
+    void setNan(Ptr p) const {
+        *p.lo = std::numeric_limits<double>::quiet_NaN();
+        *p.hi = std::numeric_limits<double>::quiet_NaN();
+    }
+    bool isZero(CPtr p) const { return *p.lo <= 0 && *p.hi >= 0; }
+
+    void dot(Reg &s, CPtr x, CPtr y, int n) const {
+        s = interval_arithmetic::IDot(x.lo, x.hi, y.lo, y.hi, n);
+    }
+    void sub(Ptr d, CPtr a, const Reg &s) const { put(d, interval_arithmetic::ISub(get(a), s)); }
+    void subDiv(Ptr d, CPtr a, const Reg &s, CPtr q) const {
+        put(d, interval_arithmetic::IDiv(interval_arithmetic::ISub(get(a), s), get(q)));
+    }
+    void subMul(Ptr d, CPtr a, CPtr b, CPtr c) const {
+        put(d, interval_arithmetic::ISub(get(c), interval_arithmetic::IMul(get(a), get(b))));
+    }
+    void mul(Ptr d, CPtr a, CPtr b) const { put(d, interval_arithmetic::IMul(get(a), get(b))); }
+    void div(Ptr d, CPtr a, CPtr q) const { put(d, interval_arithmetic::IDiv(get(a), get(q))); }
+
+    void mulRows(Ptr d, CPtr a, CPtr b, int n) const {
+        if constexpr (std::is_same<T, double>::value)
+            interval_arithmetic::simd::IMulN(a.lo, a.hi, b.lo, b.hi, d.lo, d.hi, n);
+        else
+            for (int k = 0; k < n; ++k)
+                mul(d + k, a + k, b + k);
+    }
+    void subMatMulNT(int m, int n, int k, CPtr x, int ldx, CPtr y, int ldy, Ptr s, int lds) const {
+        interval_arithmetic::ISubMatMulNT(m, n, k, x.lo, x.hi, ldx, y.lo, y.hi, ldy, s.lo, s.hi, lds);
+    }
+};
+
+} // namespace traits
+} // namespace solver
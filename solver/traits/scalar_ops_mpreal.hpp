@@ -0,0 +1,63 @@
+#pragma once
+#include <mpfr.h>
+#include "mpreal.h"
+#include "solver/traits/scalar_ops.hpp"
+#include "utils/mp_matrix.h"
+
+namespace solver {
+namespace traits {
+
+/**
+ * mpreal: magazyn w blokach MPFR (utils::MpMatrix / MpVector), uchwyty to
+ * mpfr_ptr, a każde działanie to mpfr_* w miejscu – po utworzeniu macierzy
+ * i rejestrów pętle silnika nie alokują pamięci. Precyzja i zaokrąglenie
+ * pobierane są raz, przy tworzeniu cech.
+ */
+template <>
+struct ScalarOps<mpfr::mpreal> : ScalarOpsBase<mpfr::mpreal, ScalarOps<mpfr::mpreal>> {
+    using Matrix = utils::MpMatrix;
+    using Vector = utils::MpVector;
+    using Ptr    = mpfr_ptr;
+    using CPtr   = mpfr_srcptr;
+    using Reg    = mpfr::mpreal;
+
+    mpfr_prec_t prec = mpfr::mpreal::get_default_prec();
+    mpfr_rnd_t  rnd  = mpfr::mpreal::get_default_rnd();
+
+    Matrix matrix(int rows, int cols) const { return Matrix(rows, cols, prec); }
+    Vector vector(int n) const { return Vector(n, prec); }
+    Reg reg() const { return Reg(0, prec); }
+
+    void put(Ptr p, const mpfr::mpreal &v) const { mpfr_set(p, v.mpfr_srcptr(), rnd); }
+    mpfr::mpreal get(CPtr p) const { return mpfr::mpreal(p); }
+    void copy(Ptr d, CPtr s) const { mpfr_set(d, s, rnd); }
+    void setOne(Ptr p) const { mpfr_set_ui(p, 1, rnd); }
+    void setNan(Ptr p) const { mpfr_set_nan(p); }
+    bool isZero(CPtr p) const { return mpfr_zero_p(p); }
+
+    // mpfr_fma w miejscu: jedno zaokrąglenie na składnik i bez alokacji
+    void dot(Reg &s, CPtr x, CPtr y, int n) const {
+        mpfr_ptr acc = s.mpfr_ptr();
+        mpfr_set_zero(acc, 1);
+        for (int k = 0; k < n; ++k)
+            mpfr_fma(acc, x + k, y + k, acc, rnd);
+    }
+    void sub(Ptr d, CPtr a, const Reg &s) const { mpfr_sub(d, a, s.mpfr_srcptr(), rnd); }
+    void subDiv(Ptr d, CPtr a, const Reg &s, CPtr q) const {
+        mpfr_sub(d, a, s.mpfr_srcptr(), rnd);
+        mpfr_div(d, d, q, rnd);
+    }
+    // d = c − a·b z jednym zaokrągleniem: −(a·b − c) przez mpfr_fms.
+    // Negacja jest dokładna, ale odwraca kierunek – stąd zamiana RNDU/RNDD.
+    void subMul(Ptr d, CPtr a, CPtr b, CPtr c) const {
+        const mpfr_rnd_t flipped = rnd == MPFR_RNDU ? MPFR_RNDD
+                                 : rnd == MPFR_RNDD ? MPFR_RNDU : rnd;
+        mpfr_fms(d, a, b, c, flipped);
+        mpfr_neg(d, d, MPFR_RNDN);
+    }
+    void mul(Ptr d, CPtr a, CPtr b) const { mpfr_mul(d, a, b, rnd); }
+    void div(Ptr d, CPtr a, CPtr q) const { mpfr_div(d, a, q, rnd); }
+};
+
+} // namespace traits
+} // namespace solver
@@ -0,0 +1,26 @@
+#pragma once
+#include "solver/traits/scalar_ops.hpp"
+#include "multi_double.hpp"
+
+namespace solver {
+namespace traits {
+
+// double-double / quad-double: iloczyn skalarny z multidouble::dot
+// (dla DoubleDouble bez renormalizacji po każdym składniku)
+template <typename T>
+struct MultiDoubleOps : ScalarOpsBase<T, ScalarOps<T>> {
+    using typename ScalarOpsBase<T, ScalarOps<T>>::Reg;
+    using typename ScalarOpsBase<T, ScalarOps<T>>::CPtr;
+
+    void dot(Reg &s, CPtr x, CPtr y, int n) const { s = multidouble::dot(x, y, n); }
+    bool isZero(CPtr p) const { return p->isZero(); }
+};
+
+template <>
+struct ScalarOps<multidouble::DoubleDouble> : MultiDoubleOps<multidouble::DoubleDouble> {};
+
+template <>
+struct ScalarOps<multidouble::QuadDouble> : MultiDoubleOps<multidouble::QuadDouble> {};
+
+} // namespace traits
+} // namespace solver
@@ -1,19 +1,15 @@
 #ifndef CROUT_TRIDIAGONAL_DOUBLE_H
 #define CROUT_TRIDIAGONAL_DOUBLE_H
 
-#include <QVector>
-#include <tuple>
+#include "solver/crout_types.h"
+
 namespace solver {
     namespace tridiagonal {
-std::tuple<
-    QVector<double>, // a (subdiagonal)
-    QVector<double>, // b (main diagonal)
-    QVector<double>, // c (superdiagonal)
-    QVector<double>, // y (Ly = b)
-    QVector<double>  // x (Ux = y)
->
-solveCroutTridiagonal(const QVector<double> &a, const QVector<double> &b, const QVector<double> &c, const QVector<double> &rhs);
+// a – subdiagonal (n-1), d – main diagonal (n), c – superdiagonal (n-1).
+// Zwraca l, diag, up, y (Ly = rhs), x (Ux = y).
+TridiagonalResult<double>
+solveCroutTridiagonal(Span<const double> a, Span<const double> d,
+                      Span<const double> c, Span<const double> rhs);
   }
 }
 #endif // CROUT_TRIDIAGONAL_DOUBLE_H
-  
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+#include <stdexcept>
+#include "solver/crout_types.h"
+#include "solver/traits/counting_ops.hpp"
+#include "solver/traits/scalar_ops.hpp"
+#include "utils/instrumentation.h"
+#include "utils/solve_control.h"
+
+namespace solver {
+namespace tridiagonal {
+
+/**
+ * Crout dla macierzy trójdiagonalnej i dowolnego typu z cechami
+ * traits::ScalarOps<T>. a – pod-przekątna (n-1), d – przekątna (n),
+ * c – nad-przekątna (n-1). Zwraca l, diag, up, y, x: L·y = rhs, U·x = y.
+ *
+ * Zerowy pivot nie rzuca wyjątku: y i x wypełniane są NaN, a wywołujący
+ * rozpoznaje osobliwość po diag[i] == 0 – dla Interval<T> po diag[i]
+ * zawierającym zero (Ops::isZero), bo taki przedział IDiv by odrzucił.
+ */
+// Co tyle elementów punkt przerwania utils::control::checkpoint – krok
+// rozkładu to kilka działań, więc sprawdzanie przy każdym byłoby widoczne
+inline constexpr int kCheckpointStride = 4096;
+
+template <typename T, typename Ops = traits::ScalarOps<T>>
+TridiagonalResult<T> croutTridiagonal(Span<const T> a, Span<const T> d,
+                                      Span<const T> c, Span<const T> rhs)
+{
+    const int n = static_cast<int>(d.size());
+    if (n == 0 || a.size() != d.size() - 1 || c.size() != d.size() - 1 || rhs.size() != d.size())
+        throw std::invalid_argument("Invalid vector sizes");
+
+    using Stats = utils::SolveStats;
+    utils::instrument::Scope collect;
+    const traits::Instrumented<Ops> ops{};
+    utils::instrument::PhaseClock phase(&Stats::factorizationNs);
+
+    auto av = ops.vector(n - 1), cv = ops.vector(n - 1);
+    auto dv = ops.vector(n), bv = ops.vector(n);
+    for (int i = 0; i < n; ++i) {
+        ops.put(dv.data() + i, d[i]);
+        ops.put(bv.data() + i, rhs[i]);
+        if (i < n - 1) {
+            ops.put(av.data() + i, a[i]);
+            ops.put(cv.data() + i, c[i]);
+        }
+    }
+
+    auto l = ops.vector(n - 1), up = ops.vector(n - 1);
+    auto diag = ops.vector(n), y = ops.vector(n), x = ops.vector(n);
+
+    auto result = [&]() {
+        phase.stop();
+        TridiagonalResult<T> r;
+        for (int i = 0; i < n; ++i) {
+            r.diag.push_back(ops.get(diag.data() + i));
+            r.y.push_back(ops.get(y.data() + i));
+            r.x.push_back(ops.get(x.data() + i));
+            if (i < n - 1) {
+                r.l.push_back(ops.get(l.data() + i));
+                r.up.push_back(ops.get(up.data() + i));
+            }
+        }
+        r.stats = collect.stop();
+        return r;
+    };
+
+    auto pivotZero = [&](int i) {
+        if constexpr (Ops::checksPivot) {
+            if (!ops.isZero(diag.data() + i))
+                return false;
+            for (int k = 0; k < n; ++k) {
+                ops.setNan(y.data() + k);
+                ops.setNan(x.data() + k);
+            }
+            return true;
+        } else {
+            (void)i;
+            return false;
+        }
+    };
+
+    // dekompozycja Crouta
+    ops.copy(diag.data(), dv.data());
+    if (n > 1)
+        ops.copy(up.data(), cv.data());
+    if (pivotZero(0))
+        return result();
+    for (int i = 1; i < n; ++i) {
+        if (i % kCheckpointStride == 0)
+            utils::control::checkpoint(i, n);
+        ops.div(l.data() + (i - 1), av.data() + (i - 1), diag.data() + (i - 1));
+        ops.subMul(diag.data() + i, l.data() + (i - 1), cv.data() + (i - 1), dv.data() + i);
+        if (pivotZero(i))
+            return result();
+        if (i < n - 1)
+            ops.copy(up.data() + i, cv.data() + i);
+    }
+    utils::control::checkpoint(n, n);
+
+    // forward substitution Ly = rhs
+    phase.next(&Stats::forwardNs);
+    ops.copy(y.data(), bv.data());
+    for (int i = 1; i < n; ++i)
+        ops.subMul(y.data() + i, l.data() + (i - 1), y.data() + (i - 1), bv.data() + i);
+
+    // back substitution Ux = y
+    phase.next(&Stats::backwardNs);
+    ops.div(x.data() + (n - 1), y.data() + (n - 1), diag.data() + (n - 1));
+    for (int i = n - 2; i >= 0; --i) {
+        ops.subMul(x.data() + i, up.data() + i, x.data() + i + 1, y.data() + i);
+        ops.div(x.data() + i, x.data() + i, diag.data() + i);
+    }
+
+    return result();
+}
+
+} // namespace tridiagonal
+} // namespace solver
@@ -0,0 +1,33 @@
+#include "crout_tridiagonal_fixedmp.h"
+#include "crout_tridiagonal_engine.hpp"
+#include "solver/traits/scalar_ops_fixedmp.hpp"
+
+namespace solver {
+namespace tridiagonal {
+
+template<int Bits>
+TridiagonalResult<fixedmp::FixedMp<Bits>>
+solveCroutTridiagonal(
+    Span<const fixedmp::FixedMp<Bits>> a,
+    Span<const fixedmp::FixedMp<Bits>> d,
+    Span<const fixedmp::FixedMp<Bits>> c,
+    Span<const fixedmp::FixedMp<Bits>> rhs)
+{
+    return croutTridiagonal(a, d, c, rhs);
+}
+
+#define CROUT_TRIDIAGONAL_FIXEDMP(BITS)                                         \
+    template TridiagonalResult<fixedmp::FixedMp<BITS>>                          \
+    solveCroutTridiagonal<BITS>(Span<const fixedmp::FixedMp<BITS>>,             \
+                                Span<const fixedmp::FixedMp<BITS>>,             \
+                                Span<const fixedmp::FixedMp<BITS>>,             \
+                                Span<const fixedmp::FixedMp<BITS>>);
+
+CROUT_TRIDIAGONAL_FIXEDMP(128)
+CROUT_TRIDIAGONAL_FIXEDMP(192)
+CROUT_TRIDIAGONAL_FIXEDMP(256)
+
+#undef CROUT_TRIDIAGONAL_FIXEDMP
+
+} // namespace tridiagonal
+} // namespace solver
@@ -0,0 +1,20 @@
+#ifndef CROUT_TRIDIAGONAL_FIXEDMP_H
+#define CROUT_TRIDIAGONAL_FIXEDMP_H
+
+#include "fixed_mp.hpp"
+#include "solver/crout_types.h"
+
+namespace solver {
+    namespace tridiagonal {
+// Instancje: FixedMp<128>, <192>, <256>. Osobliwość → y, x wypełnione NaN.
+template<int Bits>
+TridiagonalResult<fixedmp::FixedMp<Bits>>
+solveCroutTridiagonal(
+    Span<const fixedmp::FixedMp<Bits>> a,  // subdiagonal (n - 1)
+    Span<const fixedmp::FixedMp<Bits>> d,  // main diagonal (n)
+    Span<const fixedmp::FixedMp<Bits>> c,  // superdiagonal (n - 1)
+    Span<const fixedmp::FixedMp<Bits>> rhs // right-hand side (n)
+);
+ }
+}
+#endif // CROUT_TRIDIAGONAL_FIXEDMP_H
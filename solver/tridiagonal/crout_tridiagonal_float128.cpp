@@ -0,0 +1,20 @@
+#include "crout_tridiagonal_float128.h"
+
+#ifdef CROUT_HAVE_FLOAT128
+
+#include "crout_tridiagonal_engine.hpp"
+
+namespace solver {
+namespace tridiagonal {
+
+TridiagonalResult<__float128>
+solveCroutTridiagonal(Span<const __float128> a, Span<const __float128> d,
+                      Span<const __float128> c, Span<const __float128> rhs)
+{
+    return croutTridiagonal(a, d, c, rhs);
+}
+
+} // namespace tridiagonal
+} // namespace solver
+
+#endif // CROUT_HAVE_FLOAT128
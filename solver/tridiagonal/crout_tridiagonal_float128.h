@@ -0,0 +1,18 @@
+#ifndef CROUT_TRIDIAGONAL_FLOAT128_H
+#define CROUT_TRIDIAGONAL_FLOAT128_H
+
+#include "float128.hpp"
+#include "solver/crout_types.h"
+
+#ifdef CROUT_HAVE_FLOAT128
+
+namespace solver {
+    namespace tridiagonal {
+TridiagonalResult<__float128>
+solveCroutTridiagonal(Span<const __float128> a, Span<const __float128> d,
+                      Span<const __float128> c, Span<const __float128> rhs);
+  }
+}
+
+#endif // CROUT_HAVE_FLOAT128
+#endif // CROUT_TRIDIAGONAL_FLOAT128_H
@@ -2,26 +2,35 @@
 #define CROUT_TRIDIAGONAL_INTERVAL_H
 
 #include "interval.hpp"
-#include <QVector>
-#include <tuple>
+#include "float128.hpp"
+#include "solver/crout_types.h"
 
-using namespace mpfr;
-using namespace interval_arithmetic;
 namespace solver {
     namespace tridiagonal {
-std::tuple<
-    QVector<Interval<mpreal>>, // L
-    QVector<Interval<mpreal>>, // D
-    QVector<Interval<mpreal>>, // U
-    QVector<Interval<mpreal>>, // y
-    QVector<Interval<mpreal>>  // x
->
+TridiagonalResult<interval_arithmetic::Interval<mpfr::mpreal>>
 solveCroutTridiagonal(
-    const QVector<Interval<mpreal>> &a,
-    const QVector<Interval<mpreal>> &b,
-    const QVector<Interval<mpreal>> &c,
-    const QVector<Interval<mpreal>> &rhs);
+    Span<const interval_arithmetic::Interval<mpfr::mpreal>> a,
+    Span<const interval_arithmetic::Interval<mpfr::mpreal>> d,
+    Span<const interval_arithmetic::Interval<mpfr::mpreal>> c,
+    Span<const interval_arithmetic::Interval<mpfr::mpreal>> rhs);
+
+// Końce double; zaokrąglanie kierunkowe przez fesetround
+TridiagonalResult<interval_arithmetic::Interval<double>>
+solveCroutTridiagonal(
+    Span<const interval_arithmetic::Interval<double>> a,
+    Span<const interval_arithmetic::Interval<double>> d,
+    Span<const interval_arithmetic::Interval<double>> c,
+    Span<const interval_arithmetic::Interval<double>> rhs);
+
+#ifdef CROUT_HAVE_FLOAT128
+// Końce __float128; zaokrąglanie kierunkowe przez fesetround
+TridiagonalResult<interval_arithmetic::Interval<__float128>>
+solveCroutTridiagonal(
+    Span<const interval_arithmetic::Interval<__float128>> a,
+    Span<const interval_arithmetic::Interval<__float128>> d,
+    Span<const interval_arithmetic::Interval<__float128>> c,
+    Span<const interval_arithmetic::Interval<__float128>> rhs);
+#endif
   }
 }
 #endif // CROUT_TRIDIAGONAL_INTERVAL_H
-  
\ No newline at end of file
@@ -1,27 +1,19 @@
 #ifndef CROUT_TRIDIAGONAL_MPREAL_H
 #define CROUT_TRIDIAGONAL_MPREAL_H
 
-#include <QVector>
-#include <tuple>
 #include "mpreal.h"
+#include "solver/crout_types.h"
 
-using namespace mpfr;
 namespace solver {
     namespace tridiagonal {
-std::tuple<
-    QVector<mpreal>, // L (subdiagonal with diagonal elements)
-    QVector<mpreal>, // b (main diagonal)
-    QVector<mpreal>, // c (superdiagonal)
-    QVector<mpreal>, // y (Ly = b)
-    QVector<mpreal>  // x (Ux = y)
->
+// Zwraca l (n-1), diag (n), up (n-1), y (Ly = rhs), x (Ux = y)
+TridiagonalResult<mpfr::mpreal>
 solveCroutTridiagonal(
-    const QVector<mpreal> &a,  // subdiagonal (n - 1)
-    const QVector<mpreal> &b,  // main diagonal (n)
-    const QVector<mpreal> &c,  // superdiagonal (n - 1)
-    const QVector<mpreal> &rhs // right-hand side (n)
+    Span<const mpfr::mpreal> a,  // subdiagonal (n - 1)
+    Span<const mpfr::mpreal> d,  // main diagonal (n)
+    Span<const mpfr::mpreal> c,  // superdiagonal (n - 1)
+    Span<const mpfr::mpreal> rhs // right-hand side (n)
 );
  }
 }
 #endif // CROUT_TRIDIAGONAL_MPREAL_H
-   
\ No newline at end of file
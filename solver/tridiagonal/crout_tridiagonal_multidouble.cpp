@@ -0,0 +1,23 @@
+#include "crout_tridiagonal_multidouble.h"
+#include "crout_tridiagonal_engine.hpp"
+#include "solver/traits/scalar_ops_multidouble.hpp"
+
+namespace solver {
+namespace tridiagonal {
+
+TridiagonalResult<multidouble::DoubleDouble>
+solveCroutTridiagonal(Span<const multidouble::DoubleDouble> a, Span<const multidouble::DoubleDouble> d,
+                      Span<const multidouble::DoubleDouble> c, Span<const multidouble::DoubleDouble> rhs)
+{
+    return croutTridiagonal(a, d, c, rhs);
+}
+
+TridiagonalResult<multidouble::QuadDouble>
+solveCroutTridiagonal(Span<const multidouble::QuadDouble> a, Span<const multidouble::QuadDouble> d,
+                      Span<const multidouble::QuadDouble> c, Span<const multidouble::QuadDouble> rhs)
+{
+    return croutTridiagonal(a, d, c, rhs);
+}
+
+} // namespace tridiagonal
+} // namespace solver
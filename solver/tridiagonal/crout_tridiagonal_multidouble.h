@@ -0,0 +1,18 @@
+#ifndef CROUT_TRIDIAGONAL_MULTIDOUBLE_H
+#define CROUT_TRIDIAGONAL_MULTIDOUBLE_H
+
+#include "multi_double.hpp"
+#include "solver/crout_types.h"
+
+namespace solver {
+    namespace tridiagonal {
+TridiagonalResult<multidouble::DoubleDouble>
+solveCroutTridiagonal(Span<const multidouble::DoubleDouble> a, Span<const multidouble::DoubleDouble> d,
+                      Span<const multidouble::DoubleDouble> c, Span<const multidouble::DoubleDouble> rhs);
+
+TridiagonalResult<multidouble::QuadDouble>
+solveCroutTridiagonal(Span<const multidouble::QuadDouble> a, Span<const multidouble::QuadDouble> d,
+                      Span<const multidouble::QuadDouble> c, Span<const multidouble::QuadDouble> rhs);
+  }
+}
+#endif // CROUT_TRIDIAGONAL_MULTIDOUBLE_H
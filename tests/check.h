@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdarg>
+#include <cstdio>
+
+// Minimalne sprawdzenia dla testów ctest (tests/*_test.cpp): CHECK wypisuje
+// nieudany warunek i liczy błędy, a main kończy się test::result() – kod
+// wyjścia 1, gdy któreś sprawdzenie nie przeszło. Bez zewnętrznego frameworka.
+
+namespace test {
+
+inline int failures = 0;
+
+// Po kMaxReported błędach tylko liczymy – pętle po tysiącach elementów
+// zalałyby wyjście
+constexpr int kMaxReported = 20;
+
+inline bool check(bool ok, const char *expr, const char *file, int line, const char *fmt = nullptr, ...)
+{
+    if (ok)
+        return true;
+    if (++failures <= kMaxReported) {
+        std::fprintf(stderr, "%s:%d: CHECK(%s) failed", file, line, expr);
+        if (fmt) {
+            std::fputs(": ", stderr);
+            va_list args;
+            va_start(args, fmt);
+            std::vfprintf(stderr, fmt, args);
+            va_end(args);
+        }
+        std::fputc('\n', stderr);
+    }
+    return false;
+}
+
+inline int result()
+{
+    if (failures)
+        std::fprintf(stderr, "%d check(s) failed\n", failures);
+    return failures ? 1 : 0;
+}
+
+} // namespace test
+
+#define CHECK(cond) ::test::check(static_cast<bool>(cond), #cond, __FILE__, __LINE__)
+// CHECKF(warunek, "format", ...) – z opisem przypadku przy błędzie
+#define CHECKF(cond, ...) ::test::check(static_cast<bool>(cond), #cond, __FILE__, __LINE__, __VA_ARGS__)
@@ -0,0 +1,222 @@
+// Iloczyny mid/rad (interval_midrad.hpp) i blokowy Crout przedziałowy.
+//
+// ISubMatMulNT musi zawierać dokładne S - X·Yᵀ (liczone w MPFR) i nie może
+// być szersze niż 1.5× wynik dokładny plus błąd zaokrągleń – rozmiary trafiają
+// w ogony kafelków 4×8/4×16 i w granicę kawałka KB = 256 po k. Solvery
+// general/symmetric dla Interval<double> przy n > 128 idą przez panele
+// i dopełnienie Schura mid/rad; ich x musi zawierać rozwiązanie liczone
+// w mpreal na 256 bitach.
+//
+// ctest uruchamia ten program też z CROUT_SIMD=scalar i CROUT_SIMD=avx2.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "interval_midrad.hpp"
+#include "mpreal.h"
+#include "solver/general/crout_general_interval.h"
+#include "solver/general/crout_general_mpreal.h"
+#include "solver/symmetric/crout_symmetric_interval.h"
+#include "solver/symmetric/crout_symmetric_mpreal.h"
+#include "tests/check.h"
+
+namespace IA = interval_arithmetic;
+using ID = IA::Interval<double>;
+using mpfr::mpreal;
+
+namespace {
+
+// Iloczyny końców double są dokładne w 106 bitach, sumy ≤ 300 składników
+// przy wykładnikach -40..42 – w 512
+constexpr int kExactPrec = 512;
+constexpr double kSentinel = 12345.0;
+
+std::mt19937 rng(2024);
+
+double magnitude()
+{
+    std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+    std::uniform_int_distribution<int> exponent(-20, 20);
+    return std::ldexp(mantissa(rng), exponent(rng));
+}
+
+// Losowy przedział: dodatni, ujemny, zawierający zero albo punkt. Same punkty
+// sprawdzają osobno część ↓/↑(mA·mB) – przy szerokich przedziałach ginie w promieniu.
+void randomInterval(double &lo, double &hi, bool points)
+{
+    const double u = magnitude(), v = magnitude();
+    switch (points ? 3 : std::uniform_int_distribution<int>(0, 3)(rng)) {
+    case 0:  lo = std::min(u, v);  hi = std::max(u, v);  break;
+    case 1:  lo = -std::max(u, v); hi = -std::min(u, v); break;
+    case 2:  lo = -u;              hi = v;               break;
+    default: lo = hi = (u < v ? u : -u);                 break;
+    }
+}
+
+void checkSubMatMul(int m, int n, int k, bool points)
+{
+    // Kroki wierszy większe niż szerokości – wypełnienie musi zostać nietknięte
+    const int ldx = k + 3, ldy = k + 1, lds = n + 5;
+    std::vector<double> xlo(static_cast<std::size_t>(m) * ldx), xhi(xlo.size());
+    std::vector<double> ylo(static_cast<std::size_t>(n) * ldy), yhi(ylo.size());
+    std::vector<double> slo(static_cast<std::size_t>(m) * lds, kSentinel), shi(slo.size(), kSentinel);
+    for (std::size_t s = 0; s < xlo.size(); ++s)
+        randomInterval(xlo[s], xhi[s], points);
+    for (std::size_t s = 0; s < ylo.size(); ++s)
+        randomInterval(ylo[s], yhi[s], points);
+    for (int i = 0; i < m; ++i)
+        for (int j = 0; j < n; ++j) {
+            const std::size_t s = static_cast<std::size_t>(i) * lds + j;
+            randomInterval(slo[s], shi[s], points);
+        }
+    const std::vector<double> s0lo = slo, s0hi = shi;
+
+    IA::midrad::ISubMatMulNT(m, n, k, xlo.data(), xhi.data(), ldx, ylo.data(), yhi.data(), ldy,
+                             slo.data(), shi.data(), lds);
+
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < n; ++j) {
+            // Dokładnie: Σ [min, max] iloczynów końców, potem S - suma
+            mpreal sumLo(0, kExactPrec), sumHi(0, kExactPrec), bound(0, kExactPrec);
+            for (int p = 0; p < k; ++p) {
+                const std::size_t a = static_cast<std::size_t>(i) * ldx + p;
+                const std::size_t b = static_cast<std::size_t>(j) * ldy + p;
+                mpreal q[4] = {mpreal(xlo[a], kExactPrec) * ylo[b], mpreal(xlo[a], kExactPrec) * yhi[b],
+                               mpreal(xhi[a], kExactPrec) * ylo[b], mpreal(xhi[a], kExactPrec) * yhi[b]};
+                const mpreal lo = std::min({q[0], q[1], q[2], q[3]});
+                const mpreal hi = std::max({q[0], q[1], q[2], q[3]});
+                sumLo += lo;
+                sumHi += hi;
+                bound += std::max(abs(lo), abs(hi));
+            }
+            const std::size_t s = static_cast<std::size_t>(i) * lds + j;
+            const mpreal exactLo = mpreal(s0lo[s], kExactPrec) - sumHi;
+            const mpreal exactHi = mpreal(s0hi[s], kExactPrec) - sumLo;
+            CHECKF(slo[s] <= exactLo && shi[s] >= exactHi,
+                   "m=%d n=%d k=%d (%d,%d): result does not enclose S - X*Y^T", m, n, k, i, j);
+
+            // Rump: promień ≤ 1.5× dokładny, plus zaokrąglenia trzech gemm i odejmowania
+            const mpreal slack = 4.0 * (k + 8) * std::ldexp(1.0, -53) *
+                                 (bound + std::max(std::fabs(s0lo[s]), std::fabs(s0hi[s])));
+            CHECKF(mpreal(shi[s], kExactPrec) - slo[s] <= 1.5 * (exactHi - exactLo) + slack,
+                   "m=%d n=%d k=%d (%d,%d): enclosure too wide", m, n, k, i, j);
+        }
+        for (int j = n; j < lds; ++j) {
+            const std::size_t s = static_cast<std::size_t>(i) * lds + j;
+            CHECKF(slo[s] == kSentinel && shi[s] == kSentinel,
+                   "m=%d n=%d k=%d: row padding (%d,%d) overwritten", m, n, k, i, j);
+        }
+    }
+}
+
+bool contains(const ID &v, const mpreal &x) { return v.a <= x && x <= v.b; }
+
+// Losowa macierz z dominującą przekątną (symetryczna, gdy symmetric), punktowa
+void diagonallyDominant(int n, bool symmetric, std::vector<double> &A, std::vector<double> &b)
+{
+    std::uniform_real_distribution<double> entry(-1.0, 1.0);
+    A.assign(static_cast<std::size_t>(n) * n, 0.0);
+    b.resize(n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = symmetric ? i : 0; j < n; ++j) {
+            A[static_cast<std::size_t>(i) * n + j] = entry(rng);
+            if (symmetric)
+                A[static_cast<std::size_t>(j) * n + i] = A[static_cast<std::size_t>(i) * n + j];
+        }
+        A[static_cast<std::size_t>(i) * n + i] += n;
+        b[i] = entry(rng);
+    }
+}
+
+template <typename SolveInterval, typename SolveExact>
+void checkSolver(const char *name, int n, bool symmetric, SolveInterval solveInterval, SolveExact solveExact)
+{
+    std::vector<double> A, b;
+    diagonallyDominant(n, symmetric, A, b);
+
+    std::vector<ID> Ai(A.size()), bi(n);
+    std::vector<mpreal> Am(A.size()), bm(n);
+    for (std::size_t s = 0; s < A.size(); ++s) {
+        Ai[s] = ID(A[s], A[s]);
+        Am[s] = A[s];
+    }
+    for (int i = 0; i < n; ++i) {
+        bi[i] = ID(b[i], b[i]);
+        bm[i] = b[i];
+    }
+
+    const solver::CroutResult<ID> r = solveInterval(solver::MatrixView<const ID>(Ai.data(), n),
+                                                    solver::Span<const ID>(bi));
+    const solver::CroutResult<mpreal> ref = solveExact(solver::MatrixView<const mpreal>(Am.data(), n),
+                                                       solver::Span<const mpreal>(bm));
+    CHECKF(r.x.size() == std::size_t(n), "%s n=%d: x has %zu elements", name, n, r.x.size());
+    if (r.x.size() != std::size_t(n))
+        return;
+    for (int i = 0; i < n; ++i) {
+        CHECKF(contains(r.x[i], ref.x[i]), "%s n=%d: x[%d] = [%.17g, %.17g] misses %.17g",
+               name, n, i, r.x[i].a, r.x[i].b, ref.x[i].toDouble());
+        // Macierz dobrze uwarunkowana – obudowa ma zostać wąska
+        CHECKF(r.x[i].b - r.x[i].a <= 1e-10 * (1.0 + std::fabs(ref.x[i].toDouble())),
+               "%s n=%d: x[%d] enclosure width %g", name, n, i, r.x[i].b - r.x[i].a);
+    }
+    for (std::size_t s = 0; s < r.L.size(); ++s)
+        CHECKF(contains(r.L[s], ref.L[s]) && contains(r.U[s], ref.U[s]),
+               "%s n=%d: L/U element %zu misses the exact factor", name, n, s);
+}
+
+template <typename Solve>
+void checkZeroPivot(const char *name, const std::vector<ID> &A, Solve solve)
+{
+    const int n = static_cast<int>(std::sqrt(static_cast<double>(A.size())));
+    const std::vector<ID> b(n, ID(1, 1));
+    bool thrown = false;
+    try {
+        solve(solver::MatrixView<const ID>(A.data(), n), solver::Span<const ID>(b));
+    } catch (const solver::ZeroPivot &) {
+        thrown = true;
+    }
+    CHECKF(thrown, "%s: pivot containing zero did not throw ZeroPivot", name);
+}
+
+} // namespace
+
+int main()
+{
+    mpreal::set_default_prec(256);
+#ifdef INTERVAL_SIMD_X86
+    static const char *const names[] = {"scalar", "avx2", "avx512"};
+    std::printf("ISA: %s\n", names[static_cast<int>(IA::simd::detail::isa())]);
+#endif
+
+    const int shapes[][3] = {{1, 1, 1},    {3, 5, 7},     {4, 8, 16},   {5, 17, 33},
+                             {7, 9, 64},   {13, 19, 300}, {64, 64, 64}, {66, 33, 257}};
+    for (const auto &s : shapes)
+        for (bool points : {false, true})
+            checkSubMatMul(s[0], s[1], s[2], points);
+
+    using GeneralI = solver::CroutResult<ID> (*)(solver::MatrixView<const ID>, solver::Span<const ID>);
+    using GeneralM = solver::CroutResult<mpreal> (*)(solver::MatrixView<const mpreal>, solver::Span<const mpreal>);
+    const GeneralI generalI = solver::general::solveCroutGeneral;
+    const GeneralM generalM = solver::general::solveCroutGeneral;
+    const GeneralI symmetricI = solver::symmetric::solveCroutSymmetric;
+    const GeneralM symmetricM = solver::symmetric::solveCroutSymmetric;
+
+    // 100: bez paneli; 130, 200, 300: panele 64 z resztą i dopełnienie Schura
+    for (int n : {100, 130, 200, 300}) {
+        checkSolver("general", n, false, generalI, generalM);
+        checkSolver("symmetric", n, true, symmetricI, symmetricM);
+    }
+
+    // [1 2; 2 4] – drugi pivot dokładnie zero; [[-1, 1] 1; 1 1] – pierwszy zawiera zero
+    const std::vector<ID> singular = {ID(1, 1), ID(2, 2), ID(2, 2), ID(4, 4)};
+    const std::vector<ID> straddling = {ID(-1, 1), ID(1, 1), ID(1, 1), ID(1, 1)};
+    checkZeroPivot("general singular", singular, generalI);
+    checkZeroPivot("symmetric singular", singular, symmetricI);
+    checkZeroPivot("general straddling", straddling, generalI);
+    checkZeroPivot("symmetric straddling", straddling, symmetricI);
+
+    return test::result();
+}
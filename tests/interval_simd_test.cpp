@@ -0,0 +1,272 @@
+// Jądra wektorowe Interval<double> (interval_simd.hpp) wobec MPFR.
+//
+// IAddN/ISubN/IMulN/IDivN muszą dać dokładnie końce zaokrąglone poprawnie
+// na zewnątrz – każda para klas znaków (x≥0, x≤0, x∋0, końce zerowe,
+// punkty) trafia na każdą pozycję w wektorze i w ogonie maski. IDotN musi
+// zawierać dokładną sumę iloczynów przedziałowych.
+//
+// ctest uruchamia ten program też z CROUT_SIMD=scalar i CROUT_SIMD=avx2,
+// więc sprawdzana jest każda implementacja dostępna na maszynie.
+
+#include <algorithm>
+#include <cfenv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <mpfr.h>
+
+#include "interval_simd.hpp"
+#include "tests/check.h"
+
+namespace IA = interval_arithmetic;
+
+namespace {
+
+enum class Sign { Pos, Neg, Mixed, ZeroLo, ZeroHi, Point, Zero };
+constexpr Sign kSigns[] = {Sign::Pos, Sign::Neg, Sign::Mixed, Sign::ZeroLo,
+                           Sign::ZeroHi, Sign::Point, Sign::Zero};
+constexpr int kSignCount = sizeof(kSigns) / sizeof(kSigns[0]);
+// Dzielniki bez zera
+constexpr Sign kDivisorSigns[] = {Sign::Pos, Sign::Neg, Sign::Point};
+
+// Długości: pojedyncze elementy, granice 4 i 8 pasów, długie wsady
+constexpr int kLengths[] = {1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 64, 100, 1001};
+
+class Generator {
+public:
+    explicit Generator(unsigned seed) : rng_(seed) {}
+
+    // Pełna mantysa, wykładnik -20..20
+    double magnitude()
+    {
+        std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+        std::uniform_int_distribution<int> exponent(-20, 20);
+        return std::ldexp(mantissa(rng_), exponent(rng_));
+    }
+
+    void interval(Sign s, double &a, double &b)
+    {
+        const double u = magnitude(), v = magnitude();
+        const double lo = std::min(u, v), hi = std::max(u, v);
+        switch (s) {
+        case Sign::Pos:    a = lo;  b = hi;  break;
+        case Sign::Neg:    a = -hi; b = -lo; break;
+        case Sign::Mixed:  a = -u;  b = v;   break;
+        case Sign::ZeroLo: a = 0;   b = u;   break;
+        case Sign::ZeroHi: a = -u;  b = 0;   break;
+        case Sign::Point:  a = b = (rng_() & 1) ? u : -u; break;
+        case Sign::Zero:   a = b = 0; break;
+        }
+    }
+
+private:
+    std::mt19937_64 rng_;
+};
+
+using MpfrOp = int (*)(mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t);
+
+// op(x, y) zaokrąglone poprawnie do double w kierunku rnd
+double rounded(MpfrOp op, double x, double y, mpfr_rnd_t rnd)
+{
+    mpfr_t a, b, r;
+    mpfr_init2(a, 53);
+    mpfr_init2(b, 53);
+    mpfr_init2(r, 53);
+    mpfr_set_d(a, x, MPFR_RNDN);
+    mpfr_set_d(b, y, MPFR_RNDN);
+    op(r, a, b, rnd);
+    const double d = mpfr_get_d(r, rnd);
+    mpfr_clear(a);
+    mpfr_clear(b);
+    mpfr_clear(r);
+    return d;
+}
+
+// Najciaśniejszy przedział double zawierający {x ∘ y : x ∈ [xa, xb], y ∈ [ya, yb]}
+// dla ∘ monotonicznego względem każdego argumentu na przedziale (·, / bez zera)
+void reference(MpfrOp op, double xa, double xb, double ya, double yb, double &lo, double &hi)
+{
+    const double xs[] = {xa, xb}, ys[] = {ya, yb};
+    lo = INFINITY;
+    hi = -INFINITY;
+    for (double x : xs)
+        for (double y : ys) {
+            lo = std::min(lo, rounded(op, x, y, MPFR_RNDD));
+            hi = std::max(hi, rounded(op, x, y, MPFR_RNDU));
+        }
+}
+
+struct Batch {
+    std::vector<double> xa, xb, ya, yb, ra, rb;
+    std::vector<int> xs, ys;  // indeksy klas znaków (do opisu błędu)
+
+    explicit Batch(int n) : xa(n), xb(n), ya(n), yb(n), ra(n), rb(n), xs(n), ys(n) {}
+};
+
+// Pary klas znaków przesunięte o offset – każda para trafia na różne pasy
+Batch makeBatch(Generator &gen, int n, int offset, const Sign *xSigns, int xCount,
+                const Sign *ySigns, int yCount)
+{
+    Batch b(n);
+    for (int k = 0; k < n; ++k) {
+        const int pair = (k + offset) % (xCount * yCount);
+        b.xs[k] = pair / yCount;
+        b.ys[k] = pair % yCount;
+        gen.interval(xSigns[b.xs[k]], b.xa[k], b.xb[k]);
+        gen.interval(ySigns[b.ys[k]], b.ya[k], b.yb[k]);
+    }
+    return b;
+}
+
+using Kernel = void (*)(const double *, const double *, const double *, const double *,
+                        double *, double *, int);
+
+// Wynik jądra ma być równy końcom z MPFR; ref liczy je dla jednego elementu
+template <typename Ref>
+void checkKernel(const char *name, Kernel kernel, Ref ref, const Batch &b, int n)
+{
+    Batch r = b;
+    kernel(b.xa.data(), b.xb.data(), b.ya.data(), b.yb.data(), r.ra.data(), r.rb.data(), n);
+    CHECKF(std::fegetround() == FE_TONEAREST, "%s n=%d: rounding mode not restored", name, n);
+    for (int k = 0; k < n; ++k) {
+        double lo, hi;
+        ref(b.xa[k], b.xb[k], b.ya[k], b.yb[k], lo, hi);
+        CHECKF(r.ra[k] == lo && r.rb[k] == hi,
+               "%s n=%d k=%d signs %d,%d: [%a, %a] op [%a, %a] = [%a, %a], expected [%a, %a]",
+               name, n, k, b.xs[k], b.ys[k], b.xa[k], b.xb[k], b.ya[k], b.yb[k],
+               r.ra[k], r.rb[k], lo, hi);
+    }
+}
+
+void checkElementwise(Generator &gen)
+{
+    auto add = [](double xa, double xb, double ya, double yb, double &lo, double &hi) {
+        lo = rounded(mpfr_add, xa, ya, MPFR_RNDD);
+        hi = rounded(mpfr_add, xb, yb, MPFR_RNDU);
+    };
+    auto sub = [](double xa, double xb, double ya, double yb, double &lo, double &hi) {
+        lo = rounded(mpfr_sub, xa, yb, MPFR_RNDD);
+        hi = rounded(mpfr_sub, xb, ya, MPFR_RNDU);
+    };
+    auto mul = [](double xa, double xb, double ya, double yb, double &lo, double &hi) {
+        reference(mpfr_mul, xa, xb, ya, yb, lo, hi);
+    };
+    auto div = [](double xa, double xb, double ya, double yb, double &lo, double &hi) {
+        reference(mpfr_div, xa, xb, ya, yb, lo, hi);
+    };
+
+    for (int n : kLengths)
+        for (int offset = 0; offset < 8; ++offset) {
+            const Batch b = makeBatch(gen, n, offset, kSigns, kSignCount, kSigns, kSignCount);
+            checkKernel("IAddN", IA::simd::IAddN, add, b, n);
+            checkKernel("ISubN", IA::simd::ISubN, sub, b, n);
+            checkKernel("IMulN", IA::simd::IMulN, mul, b, n);
+
+            const Batch d = makeBatch(gen, n, offset, kSigns, kSignCount, kDivisorSigns, 3);
+            checkKernel("IDivN", IA::simd::IDivN, div, d, n);
+        }
+}
+
+// Dzielnik zawierający zero gdziekolwiek we wsadzie (także w ogonie maski)
+void checkDivisionByZero(Generator &gen)
+{
+    for (int n : {1, 8, 9, 17})
+        for (int bad = 0; bad < n; bad += 4) {
+            Batch b = makeBatch(gen, n, 0, kSigns, kSignCount, kDivisorSigns, 3);
+            gen.interval(Sign::Mixed, b.ya[bad], b.yb[bad]);
+            bool thrown = false;
+            try {
+                IA::simd::IDivN(b.xa.data(), b.xb.data(), b.ya.data(), b.yb.data(),
+                                b.ra.data(), b.rb.data(), n);
+            } catch (const std::runtime_error &) {
+                thrown = true;
+            }
+            CHECKF(thrown, "IDivN n=%d: divisor %d contains 0", n, bad);
+            CHECK(std::fegetround() == FE_TONEAREST);
+        }
+}
+
+// Σ x[k]·y[k]: końce iloczynów są dokładne w 106 bitach, suma przy wykładnikach
+// -40..42 i n ≤ 1001 – w 512
+void checkDot(Generator &gen)
+{
+    mpfr_t lo, hi, p, q, x, y;
+    for (mpfr_ptr v : {lo, hi, p, q, x, y})
+        mpfr_init2(v, 512);
+
+    for (int n : kLengths)
+        for (int offset = 0; offset < 8; ++offset) {
+            const Batch b = makeBatch(gen, n, offset, kSigns, kSignCount, kSigns, kSignCount);
+            const IA::Interval<double> r = IA::simd::IDotN(b.xa.data(), b.xb.data(),
+                                                            b.ya.data(), b.yb.data(), n);
+            CHECK(std::fegetround() == FE_TONEAREST);
+
+            mpfr_set_zero(lo, 1);
+            mpfr_set_zero(hi, 1);
+            double bound = 0;  // Σ |iloczyn| – skala błędu zaokrągleń
+            for (int k = 0; k < n; ++k) {
+                const double xs[] = {b.xa[k], b.xb[k]}, ys[] = {b.ya[k], b.yb[k]};
+                bool first = true;
+                for (double xv : xs)
+                    for (double yv : ys) {
+                        mpfr_set_d(x, xv, MPFR_RNDN);
+                        mpfr_set_d(y, yv, MPFR_RNDN);
+                        mpfr_mul(q, x, y, MPFR_RNDN);  // dokładnie
+                        if (first || mpfr_less_p(q, p))
+                            mpfr_set(p, q, MPFR_RNDN);
+                        first = false;
+                        bound += std::fabs(xv * yv);
+                    }
+                mpfr_add(lo, lo, p, MPFR_RNDN);
+                first = true;
+                for (double xv : xs)
+                    for (double yv : ys) {
+                        mpfr_set_d(x, xv, MPFR_RNDN);
+                        mpfr_set_d(y, yv, MPFR_RNDN);
+                        mpfr_mul(q, x, y, MPFR_RNDN);
+                        if (first || mpfr_greater_p(q, p))
+                            mpfr_set(p, q, MPFR_RNDN);
+                        first = false;
+                    }
+                mpfr_add(hi, hi, p, MPFR_RNDN);
+            }
+
+            CHECKF(mpfr_cmp_d(lo, r.a) >= 0 && mpfr_cmp_d(hi, r.b) <= 0,
+                   "IDotN n=%d offset=%d: [%a, %a] misses [%a, %a]", n, offset, r.a, r.b,
+                   mpfr_get_d(lo, MPFR_RNDD), mpfr_get_d(hi, MPFR_RNDU));
+            // obudowa nie szersza niż suma błędów zaokrągleń (n + 8 dodawań na pas)
+            const double slack = 2.0 * (n + 8) * std::ldexp(1.0, -53) * bound;
+            CHECKF(mpfr_get_d(lo, MPFR_RNDN) - r.a <= slack && r.b - mpfr_get_d(hi, MPFR_RNDN) <= slack,
+                   "IDotN n=%d offset=%d: enclosure wider than rounding error", n, offset);
+        }
+    for (mpfr_ptr v : {lo, hi, p, q, x, y})
+        mpfr_clear(v);
+}
+
+} // anonymous
+
+int main()
+{
+#ifdef INTERVAL_SIMD_X86
+    using IA::simd::detail::Isa;
+    const Isa isa = IA::simd::detail::isa();
+    std::printf("ISA: %s\n", isa == Isa::Avx512 ? "avx512" : isa == Isa::Avx2 ? "avx2" : "scalar");
+    if (const char *env = std::getenv("CROUT_SIMD")) {
+        if (std::strcmp(env, "scalar") == 0)
+            CHECK(isa == Isa::Scalar);
+        if (std::strcmp(env, "avx2") == 0)
+            CHECK(isa != Isa::Avx512);
+    }
+#endif
+
+    Generator gen(20240601);
+    checkElementwise(gen);
+    checkDivisionByZero(gen);
+    checkDot(gen);
+    return test::result();
+}
@@ -0,0 +1,201 @@
+// Arena GMP/MPFR (utils/mp_arena.h): alokacje w zakresie, odzysk kawałków,
+// bloki przeżywające zakres i zwolnienia z innych wątków.
+//
+// install() musi się wykonać przed pierwszą alokacją MPFR w procesie, więc
+// program nie tworzy żadnych globalnych mpreal.
+
+#include <cstdio>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mpreal.h"
+#include "solver/general/crout_general_mpreal.h"
+#include "tests/check.h"
+#include "utils/mp_arena.h"
+
+using mpfr::mpreal;
+using utils::MpArena;
+using utils::MpArenaScope;
+
+namespace {
+
+constexpr int kPrec = 1024;
+// Dość bloków po ~150 B, żeby zająć kilka kawałków po 1 MiB
+constexpr int kValues = 20000;
+
+std::vector<mpreal> makeValues(int count, int seed)
+{
+    std::vector<mpreal> v;
+    v.reserve(count);
+    for (int i = 0; i < count; ++i)
+        v.emplace_back(mpreal(seed + i, kPrec) / 3);
+    return v;
+}
+
+bool sameValues(const std::vector<mpreal> &v, int seed)
+{
+    for (std::size_t i = 0; i < v.size(); ++i)
+        if (v[i] != mpreal(seed + static_cast<int>(i), kPrec) / 3)
+            return false;
+    return true;
+}
+
+// W zakresie wszystko z areny; po zamknięciu kawałki wracają do odzysku
+void checkScopeReuse()
+{
+    const MpArena::Stats before = MpArena::threadStats();
+    std::size_t reserved = 0;
+    {
+        MpArenaScope scope;
+        std::vector<mpreal> v = makeValues(kValues, 0);
+        CHECK(sameValues(v, 0));
+        const MpArena::Stats s = MpArena::threadStats();
+        CHECKF(s.arenaAllocations - before.arenaAllocations >= std::size_t(kValues),
+               "%zu arena allocations for %d values", s.arenaAllocations - before.arenaAllocations, kValues);
+        CHECK(s.mallocAllocations == before.mallocAllocations);
+        CHECK(scope.peakBytes() > std::size_t(kValues) * 100);
+        reserved = s.reservedBytes;
+    }
+    CHECKF(MpArena::threadStats().reservedBytes == reserved,
+           "reset with no survivors must keep the chunks for reuse");
+    {
+        MpArenaScope scope;
+        std::vector<mpreal> v = makeValues(kValues, 1);
+        CHECK(sameValues(v, 1));
+    }
+    CHECKF(MpArena::threadStats().reservedBytes == reserved,
+           "second scope of the same size must not reserve new chunks (%zu -> %zu)",
+           reserved, MpArena::threadStats().reservedBytes);
+}
+
+// Wartości wyniesione z zakresu zostają ważne także wtedy, gdy następny
+// zakres intensywnie alokuje
+void checkSurvivors()
+{
+    std::vector<mpreal> survivors;
+    std::size_t reserved = 0;
+    {
+        MpArenaScope scope;
+        survivors = makeValues(kValues, 7);
+        reserved = MpArena::threadStats().reservedBytes;
+    }
+    CHECKF(MpArena::threadStats().reservedBytes < reserved,
+           "chunks held by survivors must leave the thread's reserve");
+    {
+        MpArenaScope scope;
+        std::vector<mpreal> other = makeValues(2 * kValues, 100000);
+        CHECK(sameValues(other, 100000));
+        CHECK(sameValues(survivors, 7));
+    }
+    CHECK(sameValues(survivors, 7));
+    // Zmiana precyzji realokuje blok poza zakresem (malloc)
+    survivors[0].set_prec(4 * kPrec);
+    CHECK(survivors[0] == mpreal(7, kPrec) / 3);
+    survivors.clear();
+}
+
+// Bloki zwolnione w innym wątku, zanim zakres się zamknie: zakres nadal
+// resetuje się hurtowo i oddaje kawałki do odzysku
+void checkCrossThreadFree()
+{
+    std::size_t reserved = 0;
+    {
+        MpArenaScope scope;
+        std::vector<mpreal> v = makeValues(kValues, 3);
+        std::thread([values = std::move(v)]() mutable { values.clear(); }).join();
+        reserved = MpArena::threadStats().reservedBytes;
+    }
+    CHECKF(MpArena::threadStats().reservedBytes == reserved,
+           "remote frees before scope end must not strand the chunks");
+
+    // Zwolnienia zdalne już po zamknięciu zakresu: ostatnie zwalnia pamięć
+    std::vector<mpreal> late;
+    {
+        MpArenaScope scope;
+        late = makeValues(kValues, 5);
+    }
+    std::thread([values = std::move(late)]() mutable {
+        CHECK(sameValues(values, 5));
+        values.clear();
+    }).join();
+}
+
+// Zakresy zagnieżdżone: wewnętrzny nie resetuje areny zewnętrznego
+void checkNested()
+{
+    MpArenaScope outer;
+    std::vector<mpreal> a = makeValues(1000, 11);
+    {
+        MpArenaScope inner;
+        std::vector<mpreal> b = makeValues(1000, 13);
+        CHECK(sameValues(b, 13));
+    }
+    std::vector<mpreal> c = makeValues(1000, 17);
+    CHECK(sameValues(a, 11));
+    CHECK(sameValues(c, 17));
+}
+
+void checkDisabled()
+{
+    MpArena::setEnabled(false);
+    const MpArena::Stats before = MpArena::threadStats();
+    {
+        MpArenaScope scope;
+        std::vector<mpreal> v = makeValues(100, 19);
+        CHECK(sameValues(v, 19));
+    }
+    const MpArena::Stats after = MpArena::threadStats();
+    CHECK(after.arenaAllocations == before.arenaAllocations);
+    CHECK(after.mallocAllocations - before.mallocAllocations >= 100);
+    MpArena::setEnabled(true);
+}
+
+// Rozwiązanie z areną i bez niej musi być identyczne; wynik przeżywa zakres
+void checkSolve()
+{
+    const int n = 40;
+    std::vector<mpreal> A(static_cast<std::size_t>(n) * n), b(n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j)
+            A[static_cast<std::size_t>(i) * n + j] = mpreal(1, kPrec) / (i + j + 1);
+        A[static_cast<std::size_t>(i) * n + i] += n;
+        b[i] = i + 1;
+    }
+    const solver::MatrixView<const mpreal> view(A.data(), n);
+
+    solver::CroutResult<mpreal> arena;
+    {
+        MpArenaScope scope;
+        arena = solver::general::solveCroutGeneral(view, solver::Span<const mpreal>(b));
+    }
+    MpArena::setEnabled(false);
+    const solver::CroutResult<mpreal> plain = solver::general::solveCroutGeneral(view, solver::Span<const mpreal>(b));
+    MpArena::setEnabled(true);
+
+    CHECK(arena.x.size() == plain.x.size());
+    for (std::size_t i = 0; i < arena.x.size() && i < plain.x.size(); ++i)
+        CHECKF(arena.x[i] == plain.x[i], "x[%zu] differs with the arena", i);
+}
+
+} // namespace
+
+int main()
+{
+    MpArena::install();
+    mpreal::set_default_prec(kPrec);
+    CHECK(MpArena::installed());
+    if (!MpArena::enabled()) {
+        std::puts("CROUT_MP_ARENA=0 - arena checks skipped");
+        return 0;
+    }
+
+    checkScopeReuse();
+    checkSurvivors();
+    checkCrossThreadFree();
+    checkNested();
+    checkDisabled();
+    checkSolve();
+
+    return test::result();
+}
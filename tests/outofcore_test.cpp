@@ -0,0 +1,243 @@
+// Rozkład poza pamięcią (solver/outofcore) wobec solverów w pamięci.
+//
+// n = 150 przy kafelku 32 daje pięć wierszy kafelków z niepełnym ostatnim;
+// do tego kafelek wyznaczany z limitu pamięci. double i mpreal muszą się
+// zgadzać z wynikiem w pamięci z dokładnością do błędów zaokrągleń (inna
+// kolejność sumowania w kafelkach), Interval<double> musi zawierać dokładne
+// rozwiązanie. Wejście z pliku .crm (Dense, PackedSymmetric) ma dać to samo
+// co z widoku, a zerowy pivot – ZeroPivot i usunięty plik roboczy.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "interval.hpp"
+#include "mpreal.h"
+#include "solver/general/crout_general_double.h"
+#include "solver/general/crout_general_mpreal.h"
+#include "solver/outofcore/crout_outofcore.h"
+#include "solver/symmetric/crout_symmetric_double.h"
+#include "solver/symmetric/crout_symmetric_mpreal.h"
+#include "tests/check.h"
+#include "utils/matrix_file.h"
+
+namespace IA = interval_arithmetic;
+using ID = IA::Interval<double>;
+using mpfr::mpreal;
+namespace ooc = solver::outofcore;
+
+namespace {
+
+constexpr int kN = 150;
+constexpr int kPrec = 256;
+
+std::string tempPath(const char *name)
+{
+    return "crout_ooc_test_" + std::to_string(getpid()) + "_" + name;
+}
+
+bool exists(const std::string &path)
+{
+    if (FILE *f = std::fopen(path.c_str(), "rb")) {
+        std::fclose(f);
+        return true;
+    }
+    return false;
+}
+
+// Dominująca przekątna (symetryczna, gdy symmetric)
+struct System {
+    std::vector<double> A, b;
+};
+
+System makeSystem(int n, bool symmetric, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> entry(-1.0, 1.0);
+    System s;
+    s.A.assign(static_cast<std::size_t>(n) * n, 0.0);
+    s.b.resize(n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = symmetric ? i : 0; j < n; ++j) {
+            s.A[static_cast<std::size_t>(i) * n + j] = entry(rng);
+            if (symmetric)
+                s.A[static_cast<std::size_t>(j) * n + i] = s.A[static_cast<std::size_t>(i) * n + j];
+        }
+        s.A[static_cast<std::size_t>(i) * n + i] += n;
+        s.b[i] = entry(rng);
+    }
+    return s;
+}
+
+template <typename T>
+std::vector<T> convert(const std::vector<double> &v)
+{
+    std::vector<T> out(v.size());
+    for (std::size_t k = 0; k < v.size(); ++k)
+        out[k] = T(v[k]);
+    return out;
+}
+
+template <>
+std::vector<ID> convert<ID>(const std::vector<double> &v)
+{
+    std::vector<ID> out(v.size());
+    for (std::size_t k = 0; k < v.size(); ++k)
+        out[k] = ID(v[k], v[k]);
+    return out;
+}
+
+// Wariant kafelków: stały bok albo wyznaczony z limitu pamięci
+struct Tiling {
+    const char *name;
+    ooc::OutOfCoreOptions options;
+};
+
+std::vector<Tiling> tilings()
+{
+    ooc::OutOfCoreOptions fixed;
+    fixed.tile = 32;
+    fixed.tilePath = tempPath("tiles");
+    ooc::OutOfCoreOptions limited;
+    limited.memoryLimit = 64 * 1024;
+    limited.tilePath = tempPath("tiles");
+    return {{"tile=32", fixed}, {"memoryLimit=64k", limited}};
+}
+
+template <typename T>
+ooc::OutOfCoreResult<T> solveOutOfCore(bool symmetric, const std::vector<T> &A, const std::vector<T> &b,
+                                       const ooc::OutOfCoreOptions &options)
+{
+    const solver::MatrixView<const T> view(A.data(), static_cast<int>(b.size()));
+    return symmetric ? ooc::solveCroutSymmetric(view, solver::Span<const T>(b), options)
+                     : ooc::solveCroutGeneral(view, solver::Span<const T>(b), options);
+}
+
+template <typename T>
+solver::CroutResult<T> solveInCore(bool symmetric, const std::vector<T> &A, const std::vector<T> &b)
+{
+    const solver::MatrixView<const T> view(A.data(), static_cast<int>(b.size()));
+    return symmetric ? solver::symmetric::solveCroutSymmetric(view, solver::Span<const T>(b))
+                     : solver::general::solveCroutGeneral(view, solver::Span<const T>(b));
+}
+
+void checkDouble(const char *kind, bool symmetric, const System &s)
+{
+    const solver::CroutResult<double> ref = solveInCore(symmetric, s.A, s.b);
+    for (const Tiling &t : tilings()) {
+        const ooc::OutOfCoreResult<double> r = solveOutOfCore(symmetric, s.A, s.b, t.options);
+        CHECKF(r.x.size() == std::size_t(kN) && r.y.size() == std::size_t(kN), "%s %s: result size", kind, t.name);
+        for (std::size_t i = 0; i < r.x.size(); ++i) {
+            CHECKF(std::fabs(r.x[i] - ref.x[i]) <= 1e-13 * (1.0 + std::fabs(ref.x[i])),
+                   "%s double %s: x[%zu] = %.17g, in-core %.17g", kind, t.name, i, r.x[i], ref.x[i]);
+            CHECKF(std::fabs(r.y[i] - ref.y[i]) <= 1e-13 * (1.0 + std::fabs(ref.y[i])),
+                   "%s double %s: y[%zu] = %.17g, in-core %.17g", kind, t.name, i, r.y[i], ref.y[i]);
+        }
+        CHECKF(!exists(t.options.tilePath), "%s %s: tile file left behind", kind, t.name);
+    }
+}
+
+void checkMpreal(const char *kind, bool symmetric, const System &s, std::vector<mpreal> &exact)
+{
+    const std::vector<mpreal> A = convert<mpreal>(s.A), b = convert<mpreal>(s.b);
+    const solver::CroutResult<mpreal> ref = solveInCore(symmetric, A, b);
+    exact = ref.x;
+    const mpreal tolerance = pow(mpreal(2), -kPrec + 16);
+    for (const Tiling &t : tilings()) {
+        const ooc::OutOfCoreResult<mpreal> r = solveOutOfCore(symmetric, A, b, t.options);
+        CHECKF(r.x.size() == std::size_t(kN), "%s mpreal %s: result size", kind, t.name);
+        for (std::size_t i = 0; i < r.x.size(); ++i)
+            CHECKF(r.x[i].get_prec() == kPrec && abs(r.x[i] - ref.x[i]) <= tolerance * (1 + abs(ref.x[i])),
+                   "%s mpreal %s: x[%zu] differs from in-core", kind, t.name, i);
+    }
+}
+
+void checkInterval(const char *kind, bool symmetric, const System &s, const std::vector<mpreal> &exact)
+{
+    const std::vector<ID> A = convert<ID>(s.A), b = convert<ID>(s.b);
+    for (const Tiling &t : tilings()) {
+        const ooc::OutOfCoreResult<ID> r = solveOutOfCore(symmetric, A, b, t.options);
+        CHECKF(r.x.size() == std::size_t(kN), "%s interval %s: result size", kind, t.name);
+        for (std::size_t i = 0; i < r.x.size() && i < exact.size(); ++i) {
+            CHECKF(r.x[i].a <= exact[i] && exact[i] <= r.x[i].b,
+                   "%s interval %s: x[%zu] = [%.17g, %.17g] misses %.17g", kind, t.name, i, r.x[i].a,
+                   r.x[i].b, exact[i].toDouble());
+            CHECKF(r.x[i].b - r.x[i].a <= 1e-10 * (1.0 + std::fabs(exact[i].toDouble())),
+                   "%s interval %s: x[%zu] enclosure width %g", kind, t.name, i, r.x[i].b - r.x[i].a);
+        }
+    }
+}
+
+// Macierz z pliku .crm: general z Dense, symmetric z PackedSymmetric
+void checkMatrixFile(const char *kind, bool symmetric, const System &s)
+{
+    const std::string path = tempPath(symmetric ? "packed.crm" : "dense.crm");
+    {
+        const utils::StorageLayout layout =
+            symmetric ? utils::StorageLayout::PackedSymmetric : utils::StorageLayout::Dense;
+        utils::MatrixFile f = utils::MatrixFile::create(
+            path, utils::makeHeader(utils::ScalarType::Double, layout, kN, kN));
+        std::uint64_t k = 0;
+        for (int i = 0; i < kN; ++i)
+            for (int j = 0; j < (symmetric ? i + 1 : kN); ++j)
+                f.set<double>(k++, s.A[static_cast<std::size_t>(i) * kN + j]);
+        f.flush();
+    }
+
+    const utils::MatrixFile f = utils::MatrixFile::open(path);
+    for (const Tiling &t : tilings()) {
+        const ooc::OutOfCoreResult<double> fromView = solveOutOfCore(symmetric, s.A, s.b, t.options);
+        const ooc::OutOfCoreResult<double> fromFile =
+            symmetric ? ooc::solveCroutSymmetric(f, solver::Span<const double>(s.b), t.options)
+                      : ooc::solveCroutGeneral(f, solver::Span<const double>(s.b), t.options);
+        CHECKF(fromFile.x == fromView.x, "%s %s: .crm input differs from the view", kind, t.name);
+    }
+    std::remove(path.c_str());
+}
+
+// Wiersze (i kolumny) 0 i 1 równe: drugi pivot dokładnie zero
+void checkZeroPivot(const char *kind, bool symmetric)
+{
+    System s = makeSystem(kN, symmetric, 99);
+    for (int j = 0; j < kN; ++j)
+        s.A[static_cast<std::size_t>(kN) + j] = s.A[j];
+    if (symmetric)
+        for (int i = 0; i < kN; ++i)
+            s.A[static_cast<std::size_t>(i) * kN + 1] = s.A[static_cast<std::size_t>(i) * kN];
+
+    for (const Tiling &t : tilings()) {
+        bool thrown = false;
+        try {
+            solveOutOfCore(symmetric, s.A, s.b, t.options);
+        } catch (const solver::ZeroPivot &) {
+            thrown = true;
+        }
+        CHECKF(thrown, "%s %s: zero pivot did not throw ZeroPivot", kind, t.name);
+        CHECKF(!exists(t.options.tilePath), "%s %s: tile file left behind after ZeroPivot", kind, t.name);
+    }
+}
+
+} // namespace
+
+int main()
+{
+    mpreal::set_default_prec(kPrec);
+
+    for (bool symmetric : {false, true}) {
+        const char *kind = symmetric ? "symmetric" : "general";
+        const System s = makeSystem(kN, symmetric, symmetric ? 2 : 1);
+        std::vector<mpreal> exact;
+        checkDouble(kind, symmetric, s);
+        checkMpreal(kind, symmetric, s, exact);
+        checkInterval(kind, symmetric, s, exact);
+        checkMatrixFile(kind, symmetric, s);
+        checkZeroPivot(kind, symmetric);
+    }
+
+    return test::result();
+}
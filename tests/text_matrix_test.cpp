@@ -0,0 +1,328 @@
+// Równoległy czytnik Matrix Market / CSV (utils/text_matrix.h).
+//
+// Pliki są dość duże (kilka MiB), żeby podzielić się na kilka kawałków –
+// wynik dla 1 wątku i dla wielu musi być identyczny i równy zapisanym
+// liczbom co do bitu. Do tego formaty array/coordinate, symmetric, pattern,
+// trójdiagonalna, typy MPFR i przedziałowe oraz komunikaty błędów.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "interval.hpp"
+#include "mpreal.h"
+#include "tests/check.h"
+#include "utils/text_matrix.h"
+
+namespace IA = interval_arithmetic;
+using ID = IA::Interval<double>;
+using mpfr::mpreal;
+using utils::TextFormat;
+using utils::TextMatrixReader;
+using utils::TextReadOptions;
+
+namespace {
+
+// n·n liczb po ~24 znaki – kilka kawałków po 1 MiB
+constexpr int kDenseN = 500;
+constexpr int kThreadCounts[] = {1, 3, 8};
+
+std::mt19937_64 rng(7);
+
+std::string tempPath(const char *name)
+{
+    return "crout_text_test_" + std::to_string(getpid()) + "_" + name;
+}
+
+// Plik tymczasowy usuwany w destruktorze
+class TempFile {
+public:
+    TempFile(const char *name, const std::string &text) : path_(tempPath(name))
+    {
+        FILE *f = std::fopen(path_.c_str(), "wb");
+        if (!f)
+            throw std::runtime_error("cannot create " + path_);
+        std::fwrite(text.data(), 1, text.size(), f);
+        std::fclose(f);
+    }
+    ~TempFile() { std::remove(path_.c_str()); }
+
+    const std::string &path() const { return path_; }
+
+private:
+    std::string path_;
+};
+
+std::string number(double v)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof buf, "%.17g", v);
+    return buf;
+}
+
+std::vector<double> randomDense(int rows, int cols)
+{
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+    std::vector<double> A(static_cast<std::size_t>(rows) * cols);
+    for (double &v : A)
+        v = std::ldexp(mantissa(rng), exponent(rng));
+    return A;
+}
+
+template <typename T>
+std::vector<T> readDense(const std::string &path, int threads)
+{
+    return TextMatrixReader::open(path, TextReadOptions{threads, 0}).readDense<T>();
+}
+
+void checkSame(const char *what, const std::vector<double> &got, const std::vector<double> &want)
+{
+    CHECKF(got.size() == want.size(), "%s: %zu elements, expected %zu", what, got.size(), want.size());
+    std::size_t bad = 0;
+    for (std::size_t s = 0; s < got.size() && s < want.size(); ++s)
+        if (std::memcmp(&got[s], &want[s], sizeof(double)) != 0 && ++bad == 1)
+            CHECKF(false, "%s: element %zu = %.17g, expected %.17g", what, s, got[s], want[s]);
+}
+
+void checkCsv()
+{
+    const std::vector<double> A = randomDense(kDenseN, kDenseN);
+    // Separatory: przecinek, tabulator, średnik, białe znaki; nagłówek,
+    // komentarze, CRLF i spacje wokół pól
+    const struct {
+        const char *name;
+        const char *sep;
+        bool crlf;
+    } variants[] = {{"comma", ", ", false}, {"tab", "\t", true}, {"semicolon", ";", false}, {"space", "   ", true}};
+    for (const auto &v : variants) {
+        std::string text = "# comment\nc1" + std::string(v.sep) + "c2\n";
+        for (int i = 0; i < kDenseN; ++i) {
+            for (int j = 0; j < kDenseN; ++j) {
+                if (j)
+                    text += v.sep;
+                text += number(A[static_cast<std::size_t>(i) * kDenseN + j]);
+            }
+            text += v.crlf ? "\r\n" : "\n";
+            if (i == kDenseN / 2)
+                text += "# middle comment\n\n";
+        }
+        const TempFile file(v.name, text);
+
+        const TextMatrixReader r = TextMatrixReader::open(file.path(), TextReadOptions{4, 0});
+        CHECK(r.format() == TextFormat::Csv);
+        CHECKF(r.rows() == kDenseN && r.cols() == kDenseN, "%s: %dx%d", v.name, r.rows(), r.cols());
+        for (int threads : kThreadCounts) {
+            const std::string what = std::string("csv ") + v.name + " threads=" + std::to_string(threads);
+            checkSame(what.c_str(), readDense<double>(file.path(), threads), A);
+        }
+    }
+}
+
+void checkMatrixMarketArray()
+{
+    const int rows = kDenseN, cols = kDenseN - 7;
+    const std::vector<double> A = randomDense(rows, cols);
+    // array: kolumnami, kilka liczb w linii
+    std::string text = "%%MatrixMarket matrix array real general\n% comment\n" +
+                       std::to_string(rows) + " " + std::to_string(cols) + "\n";
+    int inLine = 0;
+    for (int j = 0; j < cols; ++j)
+        for (int i = 0; i < rows; ++i) {
+            text += number(A[static_cast<std::size_t>(i) * cols + j]);
+            text += ++inLine % 3 ? " " : "\n";
+        }
+    const TempFile file("array.mtx", text);
+    for (int threads : kThreadCounts)
+        checkSame("array general", readDense<double>(file.path(), threads), A);
+
+    // symmetric: dolny trójkąt kolumnami
+    const int n = kDenseN;
+    std::vector<double> S = randomDense(n, n);
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < i; ++j)
+            S[static_cast<std::size_t>(j) * n + i] = S[static_cast<std::size_t>(i) * n + j];
+    std::string sym = "%%MatrixMarket matrix array real symmetric\n" + std::to_string(n) + " " + std::to_string(n) + "\n";
+    for (int j = 0; j < n; ++j)
+        for (int i = j; i < n; ++i)
+            sym += number(S[static_cast<std::size_t>(i) * n + j]) + "\n";
+    const TempFile symFile("array_sym.mtx", sym);
+    const TextMatrixReader r = TextMatrixReader::open(symFile.path());
+    CHECK(r.symmetric());
+    CHECK(r.entries() == std::uint64_t(n) * (n + 1) / 2);
+    for (int threads : kThreadCounts)
+        checkSame("array symmetric", readDense<double>(symFile.path(), threads), S);
+}
+
+void checkMatrixMarketCoordinate()
+{
+    const int n = 1200;
+    // Około 1/8 niezerowych, wpisy w losowej kolejności
+    std::vector<double> A(static_cast<std::size_t>(n) * n, 0.0);
+    std::vector<std::pair<int, int>> where;
+    std::bernoulli_distribution nonzero(0.125);
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j <= i; ++j)
+            if (i == j || nonzero(rng))
+                where.emplace_back(i, j);
+    std::shuffle(where.begin(), where.end(), rng);
+    const std::vector<double> values = randomDense(1, static_cast<int>(where.size()));
+
+    // general z dolnym trójkątem, symmetric z tym samym i uzupełnionym górnym
+    std::string body;
+    for (std::size_t k = 0; k < where.size(); ++k)
+        body += std::to_string(where[k].first + 1) + " " + std::to_string(where[k].second + 1) + " " +
+                number(values[k]) + "\n";
+    const std::string dims = std::to_string(n) + " " + std::to_string(n) + " " + std::to_string(where.size()) + "\n";
+    const TempFile general("coord.mtx", "%%MatrixMarket matrix coordinate real general\n" + dims + body);
+    const TempFile symmetric("coord_sym.mtx", "%%MatrixMarket matrix coordinate real symmetric\n" + dims + body);
+
+    std::vector<double> S(A.size(), 0.0);
+    for (std::size_t k = 0; k < where.size(); ++k) {
+        const auto [i, j] = where[k];
+        A[static_cast<std::size_t>(i) * n + j] = values[k];
+        S[static_cast<std::size_t>(i) * n + j] = values[k];
+        S[static_cast<std::size_t>(j) * n + i] = values[k];
+    }
+    CHECK(TextMatrixReader::open(general.path()).format() == TextFormat::MatrixMarketCoordinate);
+    for (int threads : kThreadCounts) {
+        checkSame("coordinate general", readDense<double>(general.path(), threads), A);
+        checkSame("coordinate symmetric", readDense<double>(symmetric.path(), threads), S);
+    }
+
+    // pattern: same jedynki
+    std::string pattern = "%%MatrixMarket matrix coordinate pattern general\n" + dims;
+    std::vector<double> P(A.size(), 0.0);
+    for (const auto &[i, j] : where) {
+        pattern += std::to_string(i + 1) + " " + std::to_string(j + 1) + "\n";
+        P[static_cast<std::size_t>(i) * n + j] = 1.0;
+    }
+    const TempFile patternFile("pattern.mtx", pattern);
+    for (int threads : kThreadCounts)
+        checkSame("coordinate pattern", readDense<double>(patternFile.path(), threads), P);
+}
+
+void checkTridiagonal()
+{
+    const int n = 150000;
+    const std::vector<double> v = randomDense(3, n);
+    std::vector<double> a(v.begin(), v.begin() + (n - 1)), d(v.begin() + n, v.begin() + 2 * n),
+        c(v.begin() + 2 * n, v.begin() + (3 * n - 1));
+    std::string text = "%%MatrixMarket matrix coordinate real general\n" + std::to_string(n) + " " +
+                       std::to_string(n) + " " + std::to_string(3 * n - 2) + "\n";
+    for (int i = 0; i < n; ++i) {
+        if (i > 0)
+            text += std::to_string(i + 1) + " " + std::to_string(i) + " " + number(a[i - 1]) + "\n";
+        text += std::to_string(i + 1) + " " + std::to_string(i + 1) + " " + number(d[i]) + "\n";
+        if (i + 1 < n)
+            text += std::to_string(i + 1) + " " + std::to_string(i + 2) + " " + number(c[i]) + "\n";
+    }
+    const TempFile file("tridiagonal.mtx", text);
+    for (int threads : kThreadCounts) {
+        std::vector<double> ra(n - 1), rd(n), rc(n - 1);
+        TextMatrixReader::open(file.path(), TextReadOptions{threads, 0})
+            .readTridiagonal<double>(solver::Span<double>(ra), solver::Span<double>(rd), solver::Span<double>(rc));
+        checkSame("tridiagonal a", ra, a);
+        checkSame("tridiagonal d", rd, d);
+        checkSame("tridiagonal c", rc, c);
+    }
+
+    // Niezerowy element poza pasmem
+    const TempFile wide("wide.mtx", "%%MatrixMarket matrix coordinate real general\n3 3 2\n1 1 1\n3 1 2\n");
+    std::vector<double> ra(2), rd(3), rc(2);
+    bool thrown = false;
+    try {
+        TextMatrixReader::open(wide.path())
+            .readTridiagonal<double>(solver::Span<double>(ra), solver::Span<double>(rd), solver::Span<double>(rc));
+    } catch (const std::runtime_error &e) {
+        thrown = std::strstr(e.what(), "outside the tridiagonal band") != nullptr;
+    }
+    CHECKF(thrown, "nonzero outside the band must be rejected");
+}
+
+// Typy MPFR w wielu wątkach: precyzja wołającego, wartość jak mpfr_strtofr
+void checkMpreal()
+{
+    const int rows = 3000, cols = 100;
+    std::string text;
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j)
+            text += (j ? "," : "") + std::to_string(i) + "." + std::to_string(j) + "1e-3";
+        text += "\n";
+    }
+    // > 1 MiB, żeby pracowało kilka wątków
+    const TempFile file("mpreal.csv", text);
+
+    mpreal::set_default_prec(200);
+    const std::vector<mpreal> A = readDense<mpreal>(file.path(), 4);
+    CHECK(A.size() == std::size_t(rows) * cols);
+    for (int i = 0; i < rows; i += 97)
+        for (int j = 0; j < cols; j += 13) {
+            const mpreal &v = A[static_cast<std::size_t>(i) * cols + j];
+            const mpreal want(std::to_string(i) + "." + std::to_string(j) + "1e-3", 200);
+            CHECKF(v.get_prec() == 200 && v == want, "mpreal (%d,%d) wrong value or precision %ld",
+                   i, j, static_cast<long>(v.get_prec()));
+        }
+    mpreal::set_default_prec(53);
+}
+
+// "lo;hi" dosłownie (zaokrąglone na zewnątrz), jedna liczba – najwęższy
+// przedział; array kolumnami, więc 0.1 to element (2, 1)
+void checkInterval()
+{
+    const TempFile file("interval.mtx", "%%MatrixMarket matrix array real general\n2 2\n1;2\n0.1\n-3\n-0.5;0.25\n");
+    const std::vector<ID> A = readDense<ID>(file.path(), 1);
+    CHECK(A.size() == 4);
+    if (A.size() != 4)
+        return;
+    CHECK(A[0].a == 1 && A[0].b == 2);
+    CHECK(A[1].a == -3 && A[1].b == -3);
+    CHECK(A[3].a == -0.5 && A[3].b == 0.25);
+    const mpreal tenth("0.1", 256);
+    CHECKF(A[2].a < tenth && tenth < A[2].b && std::nextafter(A[2].a, 1.0) == A[2].b,
+           "0.1 -> [%.17g, %.17g] is not the narrowest enclosure", A[2].a, A[2].b);
+}
+
+void expectError(const char *name, const std::string &text, const char *message)
+{
+    const TempFile file(name, text);
+    std::string error;
+    try {
+        readDense<double>(file.path(), 2);
+    } catch (const std::runtime_error &e) {
+        error = e.what();
+    }
+    CHECKF(error.find(file.path()) == 0 && error.find(message) != std::string::npos,
+           "%s: got '%s', expected '%s: ...%s...'", name, error.c_str(), file.path().c_str(), message);
+}
+
+void checkErrors()
+{
+    expectError("count.mtx", "%%MatrixMarket matrix array real general\n2 2\n1 2 3\n", "expected 4 entries, found 3");
+    expectError("outside.mtx", "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n", "outside the matrix");
+    expectError("skew.mtx", "%%MatrixMarket matrix array real skew-symmetric\n2 2\n1 2 3 4\n", "skew-symmetric");
+    expectError("number.csv", "1,2\n3,x4\n", "invalid number 'x4'");
+    expectError("fields.csv", "1,2\n3\n", "row 2 does not have 2 fields");
+}
+
+} // namespace
+
+int main()
+{
+    checkCsv();
+    checkMatrixMarketArray();
+    checkMatrixMarketCoordinate();
+    checkTridiagonal();
+    checkMpreal();
+    checkInterval();
+    checkErrors();
+
+    return test::result();
+}
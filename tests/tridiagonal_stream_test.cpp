@@ -0,0 +1,168 @@
+// Strumieniowa trójdiagonalna (solveTridiagonalStream) wobec solvera w pamięci.
+//
+// Przebieg w przód i wstecz liczy dokładnie te same działania w tej samej
+// kolejności, tylko blokami przez plik roboczy – x zapisane w pliku musi być
+// identyczne co do bitu z x solveCroutTridiagonal, dla każdej długości bloku
+// (także niedzielącej n i równej n). Zerowy pivot w środkowym bloku:
+// singular i x z NaN, jak w pamięci.
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "interval.hpp"
+#include "mpreal.h"
+#include "solver/outofcore/crout_outofcore.h"
+#include "solver/tridiagonal/crout_tridiagonal_double.h"
+#include "solver/tridiagonal/crout_tridiagonal_interval.h"
+#include "solver/tridiagonal/crout_tridiagonal_mpreal.h"
+#include "tests/check.h"
+#include "utils/matrix_file.h"
+
+namespace IA = interval_arithmetic;
+using ID = IA::Interval<double>;
+using mpfr::mpreal;
+namespace ooc = solver::outofcore;
+
+namespace {
+
+constexpr int kN = 1000;
+constexpr int kBlocks[] = {64, 100, kN};
+// Wiersz z zerowym pivotem w wariancie osobliwym (blok 64: środek 11. bloku)
+constexpr int kSingularRow = 700;
+
+std::string tempPath(const char *name)
+{
+    return "crout_stream_test_" + std::to_string(getpid()) + "_" + name;
+}
+
+struct Bands {
+    std::vector<double> a, d, c, b;
+};
+
+// Dominująca przekątna; singular: a[k-1] = d[k] = 0, więc pivot k to dokładnie 0
+Bands makeBands(bool singular)
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> off(-1.0, 1.0), diag(3.0, 5.0);
+    Bands s;
+    for (int i = 0; i < kN; ++i) {
+        s.d.push_back(diag(rng));
+        s.b.push_back(off(rng));
+        if (i + 1 < kN) {
+            s.a.push_back(off(rng));
+            s.c.push_back(off(rng));
+        }
+    }
+    if (singular) {
+        s.a[kSingularRow - 1] = 0;
+        s.d[kSingularRow] = 0;
+    }
+    return s;
+}
+
+template <typename T>
+T point(double v)
+{
+    return T(v);
+}
+
+template <>
+ID point<ID>(double v)
+{
+    return ID(v, v);
+}
+
+template <typename T>
+std::vector<T> convert(const std::vector<double> &v)
+{
+    std::vector<T> out;
+    for (double x : v)
+        out.push_back(point<T>(x));
+    return out;
+}
+
+bool same(double x, double y) { return std::memcmp(&x, &y, sizeof x) == 0; }
+bool same(const ID &x, const ID &y) { return same(x.a, y.a) && same(x.b, y.b); }
+bool same(const mpreal &x, const mpreal &y)
+{
+    if (x.get_prec() != y.get_prec())
+        return false;
+    return (isnan(x) && isnan(y)) || (x == y && signbit(x) == signbit(y));
+}
+
+bool isNan(double x) { return std::isnan(x); }
+bool isNan(const ID &x) { return std::isnan(x.a) && std::isnan(x.b); }
+bool isNan(const mpreal &x) { return isnan(x); }
+
+template <typename T>
+void checkType(const char *type, bool singular)
+{
+    const Bands s = makeBands(singular);
+    const std::vector<T> a = convert<T>(s.a), d = convert<T>(s.d), c = convert<T>(s.c), b = convert<T>(s.b);
+    const solver::TridiagonalResult<T> ref = solver::tridiagonal::solveCroutTridiagonal(
+        solver::Span<const T>(a), solver::Span<const T>(d), solver::Span<const T>(c), solver::Span<const T>(b));
+
+    const std::string aPath = tempPath("A.crm"), bPath = tempPath("b.crm"), xPath = tempPath("x.crm");
+    {
+        const utils::ScalarType scalar = utils::ScalarTypeOf<T>::value;
+        utils::MatrixFile A = utils::MatrixFile::create(
+            aPath, utils::makeHeader(scalar, utils::StorageLayout::Tridiagonal, kN, kN));
+        utils::MatrixFile B = utils::MatrixFile::create(
+            bPath, utils::makeHeader(scalar, utils::StorageLayout::Dense, kN, 1));
+        // a (n-1), d (n), c (n-1) jedno po drugim
+        std::uint64_t k = 0;
+        for (const std::vector<T> *band : {&a, &d, &c})
+            for (const T &v : *band)
+                A.set<T>(k++, v);
+        for (int i = 0; i < kN; ++i)
+            B.set<T>(i, b[i]);
+        A.flush();
+        B.flush();
+    }
+    const utils::MatrixFile A = utils::MatrixFile::open(aPath), B = utils::MatrixFile::open(bPath);
+
+    for (int block : kBlocks) {
+        ooc::OutOfCoreOptions options;
+        options.tile = block;
+        options.tilePath = tempPath("blocks");
+        const ooc::StreamResult r = ooc::solveTridiagonalStream<T>(A, B, xPath, options);
+        CHECKF(r.n == std::uint64_t(kN), "%s block=%d: n = %llu", type, block,
+               static_cast<unsigned long long>(r.n));
+        CHECKF(r.singular == singular, "%s block=%d: singular = %d", type, block, int(r.singular));
+
+        const std::vector<T> x = utils::MatrixFile::open(xPath).toDense<T>();
+        CHECKF(x.size() == std::size_t(kN), "%s block=%d: x has %zu elements", type, block, x.size());
+        int differing = 0;
+        for (std::size_t i = 0; i < x.size() && i < ref.x.size(); ++i) {
+            if (singular) {
+                CHECKF(isNan(x[i]) && isNan(ref.x[i]), "%s block=%d: x[%zu] not NaN", type, block, i);
+            } else if ((isNan(x[i]) || !same(x[i], ref.x[i])) && ++differing == 1) {
+                CHECKF(false, "%s block=%d: x[%zu] is NaN or differs from the in-core solve", type, block, i);
+            }
+        }
+        std::remove(xPath.c_str());
+    }
+    std::remove(aPath.c_str());
+    std::remove(bPath.c_str());
+}
+
+} // namespace
+
+int main()
+{
+    mpreal::set_default_prec(256);
+
+    for (bool singular : {false, true}) {
+        checkType<double>("double", singular);
+        checkType<ID>("interval", singular);
+        checkType<mpreal>("mpreal", singular);
+    }
+
+    return test::result();
+}
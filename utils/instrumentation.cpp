@@ -0,0 +1,77 @@
+#include "instrumentation.h"
+
+#include "mp_arena.h"
+
+namespace utils {
+
+SolveStats &SolveStats::operator+=(const SolveStats &o)
+{
+    collected = collected || o.collected;
+    factorizationNs += o.factorizationNs;
+    forwardNs += o.forwardNs;
+    scalingNs += o.scalingNs;
+    backwardNs += o.backwardNs;
+    flops += o.flops;
+    mpfrOps += o.mpfrOps;
+    roundingSwitches += o.roundingSwitches;
+    allocations += o.allocations;
+    pivotChecks += o.pivotChecks;
+    return *this;
+}
+
+std::string toJson(const SolveStats &s)
+{
+    auto field = [](const char *name, std::uint64_t v, bool last = false) {
+        return std::string("\"") + name + "\":" + std::to_string(v) + (last ? "" : ",");
+    };
+    return std::string("{\"collected\":") + (s.collected ? "true" : "false")
+           + ",\"phases_ns\":{" + field("factorization", s.factorizationNs) + field("forward", s.forwardNs)
+           + field("scaling", s.scalingNs) + field("backward", s.backwardNs) + field("total", s.totalNs(), true)
+           + "},\"counters\":{" + field("flops", s.flops) + field("mpfr_ops", s.mpfrOps)
+           + field("rounding_switches", s.roundingSwitches) + field("allocations", s.allocations)
+           + field("pivot_checks", s.pivotChecks, true) + "}}";
+}
+
+#ifdef CROUT_INSTRUMENTATION
+namespace instrument {
+
+namespace {
+std::uint64_t mpAllocationCount()
+{
+    const MpArena::Stats s = MpArena::threadStats();
+    return s.arenaAllocations + s.mallocAllocations;
+}
+} // anonymous
+
+Scope::Scope() : outer_(detail::active), mpAllocations_(mpAllocationCount())
+{
+    stats_.collected = true;
+    detail::active = &stats_;
+}
+
+Scope::~Scope()
+{
+    stop();
+}
+
+SolveStats Scope::stop()
+{
+    if (running_) {
+        running_ = false;
+        const std::uint64_t mp = mpAllocationCount() - mpAllocations_;
+        stats_.allocations += mp;
+        detail::active = outer_;
+        if (outer_) {
+            // alokacje GMP zewnętrzny zakres policzy sam ze swojej różnicy
+            SolveStats inner = stats_;
+            inner.allocations -= mp;
+            *outer_ += inner;
+        }
+    }
+    return stats_;
+}
+
+} // namespace instrument
+#endif
+
+} // namespace utils
@@ -0,0 +1,150 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Instrumentacja solverów włączana w czasie kompilacji (CMake:
+// -DCROUT_INSTRUMENTATION=ON → definicja CROUT_INSTRUMENTATION). Bez niej
+// Scope, PhaseClock i add() to puste funkcje inline, a silniki używają
+// zwykłych cech Ops – kod wynikowy jest taki jak bez instrumentacji.
+
+namespace utils {
+
+/**
+ * Pomiary jednego rozwiązania, zwracane w wyniku solvera (stats).
+ *
+ * Fazy (ns, zegar monotoniczny): factorization – wczytanie A do magazynu
+ * i rozkład, forward – L·y = b, scaling – D·z = y (tylko LDLᵀ), backward –
+ * U·x = y. Liczniki:
+ *   flops            – działania w typie T zlecone warstwie Ops
+ *                      (iloczyn skalarny długości n = 2n),
+ *   mpfrOps          – wywołania mpfr_* w warstwie Ops; dla Interval<mpreal>
+ *                      działania na końcach (IMul = 8),
+ *   roundingSwitches – zmiany trybu zaokrąglania (SetRounding, fesetround
+ *                      w jądrach Interval<double>),
+ *   allocations      – macierze i wektory robocze Ops oraz alokacje GMP/MPFR
+ *                      (te tylko przy zainstalowanej utils::MpArena),
+ *   pivotChecks      – sprawdzenia zerowego pivota.
+ * Wszystko liczone w wątku wywołującym solver.
+ */
+struct SolveStats {
+    bool collected = false;  // false: biblioteka zbudowana bez instrumentacji
+
+    std::uint64_t factorizationNs = 0;
+    std::uint64_t forwardNs       = 0;
+    std::uint64_t scalingNs       = 0;
+    std::uint64_t backwardNs      = 0;
+
+    std::uint64_t flops            = 0;
+    std::uint64_t mpfrOps          = 0;
+    std::uint64_t roundingSwitches = 0;
+    std::uint64_t allocations      = 0;
+    std::uint64_t pivotChecks      = 0;
+
+    std::uint64_t totalNs() const { return factorizationNs + forwardNs + scalingNs + backwardNs; }
+
+    SolveStats &operator+=(const SolveStats &o);
+};
+
+// Obiekt JSON w jednej linii: {"collected":true,"phases_ns":{...},"counters":{...}}
+std::string toJson(const SolveStats &s);
+
+namespace instrument {
+
+using Counter = std::uint64_t SolveStats::*;
+
+#ifdef CROUT_INSTRUMENTATION
+
+constexpr bool kEnabled = true;
+
+namespace detail {
+// Pomiary bieżącego rozwiązania w tym wątku (nullptr poza Scope)
+inline thread_local SolveStats *active = nullptr;
+} // namespace detail
+
+inline void add(Counter c, std::uint64_t n = 1)
+{
+    if (SolveStats *s = detail::active)
+        s->*c += n;
+}
+
+/**
+ * Zakres jednego rozwiązania: od utworzenia do stop() liczniki i fazy
+ * z tego wątku trafiają do jego SolveStats. Zagnieżdżony zakres po stop()
+ * dolicza swoje pomiary do zewnętrznego.
+ */
+class Scope {
+public:
+    Scope();
+    ~Scope();
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+    // Kończy zbieranie (idempotentne) i zwraca pomiary
+    SolveStats stop();
+
+private:
+    SolveStats stats_;
+    SolveStats *outer_ = nullptr;
+    std::uint64_t mpAllocations_ = 0;
+    bool running_ = true;
+};
+
+// Fazy po kolei: czas bieżącej fazy dopisywany jest do jej pola przy next(),
+// stop() albo w destruktorze (np. gdy silnik rzuci wyjątek)
+class PhaseClock {
+public:
+    explicit PhaseClock(Counter phase) : phase_(phase), start_(std::chrono::steady_clock::now()) {}
+    ~PhaseClock() { stop(); }
+    PhaseClock(const PhaseClock &) = delete;
+    PhaseClock &operator=(const PhaseClock &) = delete;
+
+    void next(Counter phase)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        record(now);
+        phase_ = phase;
+        start_ = now;
+    }
+
+    void stop()
+    {
+        if (phase_) {
+            record(std::chrono::steady_clock::now());
+            phase_ = nullptr;
+        }
+    }
+
+private:
+    void record(std::chrono::steady_clock::time_point now) const
+    {
+        if (phase_)
+            add(phase_, std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(now - start_).count()));
+    }
+
+    Counter phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#else
+
+constexpr bool kEnabled = false;
+
+inline void add(Counter, std::uint64_t = 1) {}
+
+class Scope {
+public:
+    SolveStats stop() { return {}; }
+};
+
+class PhaseClock {
+public:
+    explicit PhaseClock(Counter) {}
+    void next(Counter) {}
+    void stop() {}
+};
+
+#endif
+
+} // namespace instrument
+} // namespace utils
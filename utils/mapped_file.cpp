@@ -0,0 +1,182 @@
+#include "mapped_file.h"
+
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <cerrno>
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace utils {
+
+namespace {
+
+[[noreturn]] void fail(const std::string &path, const std::string &msg)
+{
+    throw std::runtime_error(path + ": " + msg);
+}
+
+std::string systemError()
+{
+#ifdef _WIN32
+    return "system error " + std::to_string(GetLastError());
+#else
+    return std::strerror(errno);
+#endif
+}
+
+} // anonymous
+
+MappedFile MappedFile::openRead(const std::string &path)
+{
+    MappedFile f;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        fail(path, systemError());
+    f.file_ = file;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+        fail(path, systemError());
+    if (size.QuadPart == 0)
+        return f;  // pustego pliku nie da się zmapować
+    f.mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!f.mapping_)
+        fail(path, systemError());
+    f.base_ = MapViewOfFile(f.mapping_, FILE_MAP_READ, 0, 0, 0);
+    if (!f.base_)
+        fail(path, systemError());
+    f.size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        fail(path, systemError());
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        const std::string err = systemError();
+        ::close(fd);
+        fail(path, err);
+    }
+    if (st.st_size == 0) {
+        ::close(fd);
+        return f;
+    }
+    void *p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // mapowanie trzyma plik
+    if (p == MAP_FAILED)
+        fail(path, systemError());
+    f.base_ = p;
+    f.size_ = static_cast<std::size_t>(st.st_size);
+    // pliki macierzy czytane są raz, od początku do końca
+    ::posix_madvise(p, f.size_, POSIX_MADV_SEQUENTIAL);
+#endif
+    return f;
+}
+
+MappedFile MappedFile::create(const std::string &path, std::uint64_t size)
+{
+    MappedFile f;
+    f.writable_ = true;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                              CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        fail(path, systemError());
+    f.file_ = file;
+    if (size == 0)
+        return f;
+    f.mapping_ = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+                                    DWORD(size >> 32), DWORD(size & 0xffffffffu), nullptr);
+    if (!f.mapping_)
+        fail(path, systemError());
+    f.base_ = MapViewOfFile(f.mapping_, FILE_MAP_WRITE, 0, 0, 0);
+    if (!f.base_)
+        fail(path, systemError());
+#else
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+        fail(path, systemError());
+    if (size == 0) {
+        ::close(fd);
+        return f;
+    }
+    // plik rzadki: niezapisane bajty to zera
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        const std::string err = systemError();
+        ::close(fd);
+        fail(path, err);
+    }
+    void *p = ::mmap(nullptr, static_cast<std::size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+        fail(path, systemError());
+    f.base_ = p;
+#endif
+    f.size_ = static_cast<std::size_t>(size);
+    return f;
+}
+
+MappedFile::~MappedFile()
+{
+    // Zmiany zostają w pliku także bez flush() – zapisze je system
+#ifdef _WIN32
+    if (base_)
+        UnmapViewOfFile(base_);
+    if (mapping_)
+        CloseHandle(mapping_);
+    if (file_)
+        CloseHandle(file_);
+#else
+    if (base_)
+        ::munmap(base_, size_);
+#endif
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : base_(other.base_), size_(other.size_), writable_(other.writable_)
+#ifdef _WIN32
+    , file_(other.file_), mapping_(other.mapping_)
+#endif
+{
+    other.base_ = nullptr;
+    other.size_ = 0;
+#ifdef _WIN32
+    other.file_ = other.mapping_ = nullptr;
+#endif
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other) {
+        this->~MappedFile();
+        new (this) MappedFile(std::move(other));
+    }
+    return *this;
+}
+
+void MappedFile::flush()
+{
+    if (!base_ || !writable_)
+        return;
+#ifdef _WIN32
+    if (!FlushViewOfFile(base_, 0) || !FlushFileBuffers(file_))
+        throw std::runtime_error("flush failed: " + systemError());
+#else
+    if (::msync(base_, size_, MS_SYNC) != 0)
+        throw std::runtime_error("msync failed: " + systemError());
+#endif
+}
+
+} // namespace utils
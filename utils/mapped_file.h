@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace utils {
+
+/**
+ * Plik zmapowany do pamięci (mmap / MapViewOfFile) – właściciel mapowania.
+ * openRead() mapuje istniejący plik tylko do odczytu, create() tworzy plik
+ * o zadanym rozmiarze i mapuje go do zapisu. Pusty plik daje data() == nullptr
+ * i size() == 0.
+ *
+ * Błędy systemowe zgłaszane są jako std::runtime_error("ścieżka: opis").
+ */
+class MappedFile {
+public:
+    static MappedFile openRead(const std::string &path);
+    static MappedFile create(const std::string &path, std::uint64_t size);
+
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const unsigned char *data() const { return static_cast<const unsigned char *>(base_); }
+    unsigned char *data() { return static_cast<unsigned char *>(base_); }
+    std::size_t size() const { return size_; }
+    bool writable() const { return writable_; }
+
+    // Wymusza zapis zmian na dysk (msync / FlushViewOfFile)
+    void flush();
+
+private:
+    void *base_ = nullptr;
+    std::size_t size_ = 0;
+    bool writable_ = false;
+#ifdef _WIN32
+    void *file_ = nullptr;
+    void *mapping_ = nullptr;
+#endif
+};
+
+} // namespace utils
@@ -0,0 +1,290 @@
+#include "matrix_file.h"
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace utils {
+
+namespace {
+
+constexpr char          kMagic[8]     = {'C', 'R', 'O', 'U', 'T', 'M', 'A', 'T'};
+constexpr std::uint32_t kByteOrder    = 0x01020304;
+constexpr std::uint16_t kVersion      = 1;
+constexpr std::uint64_t kPayloadAlign = 64;
+
+// Rekord liczby MPFR w pliku: ten nagłówek, za nim limby mantysy
+struct MpRecordHead {
+    std::int64_t exp;   // mpfr_custom_get_exp; 0 dla zera, NaN, Inf
+    std::int32_t kind;  // mpfr_custom_get_kind – znak rodzaju to znak liczby
+    std::int32_t pad;
+};
+static_assert(sizeof(MpRecordHead) == 16, "rekord MPFR: 16 B nagłówka");
+
+// Rozmiar limbów jednego elementu, zaokrąglony do wielokrotności mp_limb_t
+std::size_t limbBytes(mpfr_prec_t prec)
+{
+    const std::size_t s = mpfr_custom_get_size(prec);
+    return (s + sizeof(mp_limb_t) - 1) / sizeof(mp_limb_t) * sizeof(mp_limb_t);
+}
+
+std::size_t mpRecordBytes(mpfr_prec_t prec)
+{
+    return sizeof(MpRecordHead) + limbBytes(prec);
+}
+
+} // anonymous
+
+std::uint64_t elementSize(ScalarType t, mpfr_prec_t prec)
+{
+    switch (t) {
+    case ScalarType::Double:         return sizeof(double);
+    case ScalarType::DoubleDouble:   return sizeof(multidouble::DoubleDouble);
+    case ScalarType::QuadDouble:     return sizeof(multidouble::QuadDouble);
+    case ScalarType::Float128:       return 16;
+    case ScalarType::IntervalDouble: return sizeof(interval_arithmetic::Interval<double>);
+    case ScalarType::Mpreal:         return mpRecordBytes(prec);
+    case ScalarType::IntervalMpreal: return 2 * mpRecordBytes(prec);
+    }
+    return 0;
+}
+
+void encodeMpfr(unsigned char *rec, mpfr_srcptr v, mpfr_prec_t prec, mpfr_rnd_t rnd)
+{
+    void *significand = rec + sizeof(MpRecordHead);
+    __mpfr_struct x;
+    mpfr_custom_init(significand, prec);
+    mpfr_custom_init_set(&x, MPFR_ZERO_KIND, 0, prec, significand);
+    mpfr_set(&x, v, rnd);
+
+    MpRecordHead head{};
+    head.kind = mpfr_custom_get_kind(&x);
+    head.exp  = mpfr_regular_p(&x) ? mpfr_custom_get_exp(&x) : 0;
+    std::memcpy(rec, &head, sizeof head);
+}
+
+mpfr_srcptr decodeMpfr(const unsigned char *rec, mpfr_prec_t prec, __mpfr_struct &view)
+{
+    MpRecordHead head;
+    std::memcpy(&head, rec, sizeof head);
+    if (head.kind < -MPFR_REGULAR_KIND || head.kind > MPFR_REGULAR_KIND)
+        throw std::runtime_error("Corrupt MPFR record");
+    // limby zostają w rec; view służy tylko do odczytu
+    mpfr_custom_init_set(&view, head.kind, static_cast<mpfr_exp_t>(head.exp), prec,
+                         const_cast<unsigned char *>(rec) + sizeof(MpRecordHead));
+    return &view;
+}
+
+namespace {
+
+bool isMpfrType(ScalarType t)
+{
+    return t == ScalarType::Mpreal || t == ScalarType::IntervalMpreal;
+}
+
+// false = wymiary niezgodne z układem
+bool elementCountOf(StorageLayout l, std::uint64_t rows, std::uint64_t cols,
+                    std::uint64_t lower, std::uint64_t upper, std::uint64_t &count)
+{
+    if (rows > INT_MAX || cols > INT_MAX)
+        return false;  // solvery i widoki liczą wymiary w int
+    switch (l) {
+    case StorageLayout::Dense:
+        count = rows * cols;
+        return true;
+    case StorageLayout::PackedSymmetric:
+        count = rows * (rows + 1) / 2;
+        return rows == cols;
+    case StorageLayout::Banded:
+        count = rows * (lower + upper + 1);
+        return rows == cols && (rows == 0 || (lower < rows && upper < rows));
+    case StorageLayout::Tridiagonal:
+        count = rows ? 3 * rows - 2 : 0;
+        return rows == cols && rows > 0;
+    }
+    return false;
+}
+
+std::uint64_t alignUp(std::uint64_t v, std::uint64_t a)
+{
+    return (v + a - 1) / a * a;
+}
+
+[[noreturn]] void fail(const std::string &path, const std::string &msg)
+{
+    throw std::runtime_error(path + ": " + msg);
+}
+
+// Sprawdza nagłówek wczytanego pliku o rozmiarze size
+void validate(const std::string &path, const MatrixFileHeader &h, std::uint64_t size)
+{
+    if (std::memcmp(h.magic, kMagic, sizeof kMagic) != 0)
+        fail(path, "not a matrix file (bad magic)");
+    if (h.byteOrder != kByteOrder)
+        fail(path, "byte order differs from this machine");
+    if (h.version != kVersion)
+        fail(path, "unsupported format version " + std::to_string(h.version));
+    if (h.scalar < std::uint16_t(ScalarType::Double) || h.scalar > std::uint16_t(ScalarType::IntervalMpreal))
+        fail(path, "unknown scalar type " + std::to_string(h.scalar));
+    if (h.layout < std::uint16_t(StorageLayout::Dense) || h.layout > std::uint16_t(StorageLayout::Tridiagonal))
+        fail(path, "unknown storage layout " + std::to_string(h.layout));
+
+    const ScalarType t = static_cast<ScalarType>(h.scalar);
+    if (isMpfrType(t)) {
+        if (h.limbBits != sizeof(mp_limb_t) * CHAR_BIT)
+            fail(path, "limb width " + std::to_string(h.limbBits) + " differs from this machine");
+        if (h.precision < MPFR_PREC_MIN || h.precision > MPFR_PREC_MAX)
+            fail(path, "invalid precision " + std::to_string(h.precision));
+    }
+#ifndef CROUT_HAVE_FLOAT128
+    if (t == ScalarType::Float128)
+        fail(path, "__float128 is not supported by this build");
+#endif
+    if (h.elementSize != elementSize(t, static_cast<mpfr_prec_t>(h.precision)))
+        fail(path, "element size does not match scalar type");
+
+    std::uint64_t count = 0;
+    if (!elementCountOf(static_cast<StorageLayout>(h.layout), h.rows, h.cols, h.lower, h.upper, count)
+        || h.elementCount != count)
+        fail(path, "dimensions do not match storage layout");
+    if (h.payloadOffset < sizeof(MatrixFileHeader) || h.payloadOffset % kPayloadAlign)
+        fail(path, "misaligned payload");
+    if (h.payloadOffset > size
+        || (h.elementSize && h.elementCount > (size - h.payloadOffset) / h.elementSize))
+        fail(path, "file is truncated");
+}
+
+} // anonymous
+
+MatrixFileHeader makeHeader(ScalarType scalar, StorageLayout layout,
+                            std::uint64_t rows, std::uint64_t cols,
+                            std::uint64_t lower, std::uint64_t upper,
+                            mpfr_prec_t precision)
+{
+    MatrixFileHeader h;
+    std::memset(&h, 0, sizeof h);
+    std::memcpy(h.magic, kMagic, sizeof kMagic);
+    h.byteOrder = kByteOrder;
+    h.version   = kVersion;
+    h.scalar    = static_cast<std::uint16_t>(scalar);
+    h.layout    = static_cast<std::uint16_t>(layout);
+    h.rows      = rows;
+    h.cols      = cols;
+    if (layout == StorageLayout::Banded) {
+        h.lower = lower;
+        h.upper = upper;
+    } else if (layout == StorageLayout::Tridiagonal) {
+        h.lower = h.upper = 1;
+    }
+    if (isMpfrType(scalar)) {
+        h.limbBits  = sizeof(mp_limb_t) * CHAR_BIT;
+        h.precision = static_cast<std::uint32_t>(precision ? precision : mpfr::mpreal::get_default_prec());
+    }
+    h.elementSize = elementSize(scalar, static_cast<mpfr_prec_t>(h.precision));
+    if (!elementCountOf(layout, h.rows, h.cols, h.lower, h.upper, h.elementCount))
+        throw std::invalid_argument("Dimensions do not match storage layout.");
+    h.payloadOffset = alignUp(sizeof(MatrixFileHeader), kPayloadAlign);
+    return h;
+}
+
+// ───────────────────────────── mapowanie ────────────────────────────────────
+
+MatrixFile MatrixFile::open(const std::string &path)
+{
+    MatrixFile f;
+    f.map_ = MappedFile::openRead(path);
+    if (f.map_.size() < sizeof(MatrixFileHeader))
+        fail(path, "not a matrix file (too short)");
+    validate(path, f.header(), f.map_.size());
+    return f;
+}
+
+MatrixFile MatrixFile::create(const std::string &path, const MatrixFileHeader &header)
+{
+    const std::uint64_t size = header.payloadOffset + header.elementSize * header.elementCount;
+    validate(path, header, size);
+
+    // plik rzadki: niezapisane elementy to zera (rekordy MPFR: NaN)
+    MatrixFile f;
+    f.map_ = MappedFile::create(path, size);
+    std::memcpy(f.map_.data(), &header, sizeof header);
+    return f;
+}
+
+// ───────────────────────────── elementy ─────────────────────────────────────
+
+void MatrixFile::checkType(ScalarType t) const
+{
+    if (scalar() != t)
+        throw std::runtime_error("Matrix file holds scalar type " + std::to_string(header().scalar)
+                                 + ", requested " + std::to_string(std::uint16_t(t)));
+}
+
+void MatrixFile::checkLayout(StorageLayout l) const
+{
+    if (layout() != l)
+        throw std::runtime_error("Matrix file has storage layout " + std::to_string(header().layout)
+                                 + ", requested " + std::to_string(std::uint16_t(l)));
+}
+
+void MatrixFile::checkWritable() const
+{
+    if (!map_.writable())
+        throw std::runtime_error("Matrix file is mapped read-only.");
+}
+
+unsigned char *MatrixFile::record(std::uint64_t k) const
+{
+    return const_cast<unsigned char *>(map_.data()) + header().payloadOffset + k * header().elementSize;
+}
+
+mpfr_srcptr MatrixFile::mpfrView(std::uint64_t k, __mpfr_struct &view, int end) const
+{
+    if (!isMpfrType(scalar()))
+        throw std::runtime_error("Matrix file does not hold MPFR numbers.");
+    const mpfr_prec_t prec = precision();
+    try {
+        return decodeMpfr(record(k) + end * mpRecordBytes(prec), prec, view);
+    } catch (const std::runtime_error &) {
+        throw std::runtime_error("Corrupt MPFR record " + std::to_string(k));
+    }
+}
+
+void MatrixFile::setMpfr(std::uint64_t k, mpfr_srcptr v, mpfr_rnd_t rnd, int end)
+{
+    if (!isMpfrType(scalar()))
+        throw std::runtime_error("Matrix file does not hold MPFR numbers.");
+    checkWritable();
+    const mpfr_prec_t prec = precision();
+    encodeMpfr(record(k) + end * mpRecordBytes(prec), v, prec, rnd);
+}
+
+std::int64_t MatrixFile::indexOf(std::uint64_t i, std::uint64_t j) const
+{
+    const MatrixFileHeader &h = header();
+    switch (layout()) {
+    case StorageLayout::Dense:
+        return std::int64_t(i * h.cols + j);
+    case StorageLayout::PackedSymmetric:
+        return i >= j ? std::int64_t(i * (i + 1) / 2 + j) : std::int64_t(j * (j + 1) / 2 + i);
+    case StorageLayout::Banded:
+        if (j + h.lower < i || j > i + h.upper)
+            return -1;
+        return std::int64_t(i * (h.lower + h.upper + 1) + (j + h.lower - i));
+    case StorageLayout::Tridiagonal: {
+        const std::uint64_t n = h.rows;
+        if (i == j)
+            return std::int64_t(n - 1 + i);
+        if (j + 1 == i)
+            return std::int64_t(j);
+        if (j == i + 1)
+            return std::int64_t(2 * n - 1 + i);
+        return -1;
+    }
+    }
+    return -1;
+}
+
+} // namespace utils
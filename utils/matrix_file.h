@@ -0,0 +1,390 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <mpfr.h>
+#include "mpreal.h"
+#include "interval.hpp"
+#include "multi_double.hpp"
+#include "float128.hpp"
+#include "solver/crout_types.h"
+#include "utils/mapped_file.h"
+
+namespace utils {
+
+/**
+ * Binarny format macierzy i wektorów (.crm) dla dużych układów.
+ *
+ * Plik = nagłówek MatrixFileHeader (128 B) + dane od offsetu wyrównanego do
+ * 64 B. Elementy typów o stałym rozmiarze (double, dd, qd, __float128,
+ * Interval<double>) leżą w pliku dokładnie tak jak w pamięci, więc po mmap
+ * dostępne są jako MatrixView / Span bez kopiowania. mpreal i
+ * Interval<mpreal> zapisywane są jako rekordy o stałej precyzji z nagłówka:
+ * wykładnik i rodzaj (mpfr_custom_get_kind) + limby w układzie
+ * mpfr_custom_init_set – odczyt pojedynczego elementu też niczego nie kopiuje.
+ *
+ * Układy danych (elementy wierszami):
+ *   Dense            rows × cols; wektor to cols == 1
+ *   PackedSymmetric  dolny trójkąt: wiersz i ma elementy 0..i, razem n(n+1)/2
+ *   Banded           rows × (lower + upper + 1); wiersz i zaczyna się od
+ *                    kolumny i − lower, pozycje poza macierzą to zera
+ *   Tridiagonal      a (n−1), d (n), c (n−1) jedno po drugim
+ *
+ * Liczby i limby zapisywane są w porządku bajtów hosta; plik z innego porządku
+ * (byteOrder) albo innej szerokości limbów jest odrzucany przy otwarciu.
+ */
+enum class ScalarType : std::uint16_t {
+    Double         = 1,
+    DoubleDouble   = 2,
+    QuadDouble     = 3,
+    Float128       = 4,
+    Mpreal         = 5,
+    IntervalDouble = 6,
+    IntervalMpreal = 7,
+};
+
+enum class StorageLayout : std::uint16_t {
+    Dense           = 1,
+    PackedSymmetric = 2,
+    Banded          = 3,
+    Tridiagonal     = 4,
+};
+
+struct MatrixFileHeader {
+    char          magic[8];       // "CROUTMAT"
+    std::uint32_t byteOrder;      // 0x01020304 w porządku piszącego
+    std::uint16_t version;
+    std::uint16_t scalar;         // ScalarType
+    std::uint16_t layout;         // StorageLayout
+    std::uint16_t limbBits;       // szerokość mp_limb_t (typy MPFR), inaczej 0
+    std::uint32_t precision;      // bity mantysy (typy MPFR), inaczej 0
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t lower;          // szerokość pasma pod przekątną (Banded)
+    std::uint64_t upper;          // i nad nią
+    std::uint64_t elementSize;    // bajty jednego zapisanego elementu
+    std::uint64_t elementCount;
+    std::uint64_t payloadOffset;  // od początku pliku, wielokrotność 64
+    std::uint8_t  reserved[48];
+};
+static_assert(sizeof(MatrixFileHeader) == 128, "nagłówek .crm ma stały rozmiar");
+
+// Typ C++ ↔ ScalarType
+template <typename T> struct ScalarTypeOf;
+template <> struct ScalarTypeOf<double>                     { static constexpr ScalarType value = ScalarType::Double; };
+template <> struct ScalarTypeOf<multidouble::DoubleDouble>  { static constexpr ScalarType value = ScalarType::DoubleDouble; };
+template <> struct ScalarTypeOf<multidouble::QuadDouble>    { static constexpr ScalarType value = ScalarType::QuadDouble; };
+#ifdef CROUT_HAVE_FLOAT128
+template <> struct ScalarTypeOf<__float128>                 { static constexpr ScalarType value = ScalarType::Float128; };
+#endif
+template <> struct ScalarTypeOf<mpfr::mpreal>               { static constexpr ScalarType value = ScalarType::Mpreal; };
+template <> struct ScalarTypeOf<interval_arithmetic::Interval<double>> {
+    static constexpr ScalarType value = ScalarType::IntervalDouble;
+};
+template <> struct ScalarTypeOf<interval_arithmetic::Interval<mpfr::mpreal>> {
+    static constexpr ScalarType value = ScalarType::IntervalMpreal;
+};
+
+// Typy MPFR nie mają postaci w pliku identycznej z pamięcią
+template <typename T>
+constexpr bool isMappable()
+{
+    return ScalarTypeOf<T>::value != ScalarType::Mpreal
+        && ScalarTypeOf<T>::value != ScalarType::IntervalMpreal;
+}
+
+/**
+ * Nagłówek dla nowego pliku; elementSize, elementCount i payloadOffset
+ * wyliczane z typu, układu i wymiarów. precision dotyczy tylko typów MPFR
+ * (0 → bieżąca domyślna precyzja mpreal).
+ */
+MatrixFileHeader makeHeader(ScalarType scalar, StorageLayout layout,
+                            std::uint64_t rows, std::uint64_t cols,
+                            std::uint64_t lower = 0, std::uint64_t upper = 0,
+                            mpfr_prec_t precision = 0);
+
+// Bajty jednego elementu w pliku (typy MPFR: rekord o precyzji precision)
+std::uint64_t elementSize(ScalarType scalar, mpfr_prec_t precision);
+
+/**
+ * Rekord MPFR w buforze rec (elementSize(ScalarType::Mpreal, prec) bajtów):
+ * encodeMpfr zapisuje v zaokrąglone do prec w kierunku rnd, decodeMpfr daje
+ * widok na rekord bez kopiowania limbów (tylko do odczytu, ważny póki rec).
+ * Ten sam układ mają elementy plików .crm i kafelki rozkładu poza pamięcią.
+ */
+void encodeMpfr(unsigned char *rec, mpfr_srcptr v, mpfr_prec_t prec, mpfr_rnd_t rnd);
+mpfr_srcptr decodeMpfr(const unsigned char *rec, mpfr_prec_t prec, __mpfr_struct &view);
+
+// Element T w rekordzie rec, w układzie pliku .crm; końce przedziałów MPFR
+// zaokrąglane na zewnątrz
+template <typename T> void storeElement(unsigned char *rec, const T &v, mpfr_prec_t prec);
+template <typename T> T loadElement(const unsigned char *rec, mpfr_prec_t prec);
+
+// Trójdiagonalna z pliku: widoki na a, d, c
+template <typename T>
+struct TridiagonalView {
+    solver::Span<T> a, d, c;
+};
+
+/**
+ * Plik .crm zmapowany do pamięci (mmap / MapViewOfFile). open() mapuje tylko
+ * do odczytu, create() tworzy plik o rozmiarze z nagłówka i mapuje do zapisu.
+ * Obiekt jest właścicielem mapowania (MappedFile) – widoki są ważne, dopóki
+ * on żyje.
+ *
+ * Błędy (brak pliku, zły nagłówek, niezgodny typ lub układ) zgłaszane są
+ * jako std::runtime_error.
+ */
+class MatrixFile {
+public:
+    static MatrixFile open(const std::string &path);
+    static MatrixFile create(const std::string &path, const MatrixFileHeader &header);
+
+    const MatrixFileHeader &header() const { return *reinterpret_cast<const MatrixFileHeader *>(map_.data()); }
+    ScalarType scalar() const { return static_cast<ScalarType>(header().scalar); }
+    StorageLayout layout() const { return static_cast<StorageLayout>(header().layout); }
+    std::uint64_t rows() const { return header().rows; }
+    std::uint64_t cols() const { return header().cols; }
+    mpfr_prec_t precision() const { return static_cast<mpfr_prec_t>(header().precision); }
+    bool writable() const { return map_.writable(); }
+
+    const unsigned char *payload() const { return map_.data() + header().payloadOffset; }
+    unsigned char *payload() { return map_.data() + header().payloadOffset; }
+
+    // Wymusza zapis zmian na dysk (msync / FlushViewOfFile). Bez tego zmiany
+    // i tak trafią do pliku po odmapowaniu, tylko bez gwarancji terminu.
+    void flush() { map_.flush(); }
+
+    // ── Widoki bez kopiowania (typy o stałym rozmiarze) ────────────────────
+    template <typename T> solver::MatrixView<const T> dense() const;
+    template <typename T> solver::MatrixView<T> dense();
+    // Dense z cols == 1
+    template <typename T> solver::Span<const T> vector() const;
+    template <typename T> solver::Span<T> vector();
+    // Banded: wiersze po lower + upper + 1 elementów
+    template <typename T> solver::MatrixView<const T> band() const;
+    // PackedSymmetric: n(n+1)/2 elementów dolnego trójkąta
+    template <typename T> solver::Span<const T> packed() const;
+    template <typename T> TridiagonalView<const T> tridiagonal() const;
+    template <typename T> TridiagonalView<T> tridiagonal();
+
+    // ── Dostęp do elementów dowolnego typu, k to indeks w danych ──────────
+    // Element k (typy MPFR: dekodowany do mpreal o precyzji pliku)
+    template <typename T> T get(std::uint64_t k) const;
+    template <typename T> void set(std::uint64_t k, const T &v);
+
+    // Widok MPFR na rekord k bez kopiowania limbów; tylko do odczytu.
+    // Dla Interval<mpreal> end = 0 (lewy) albo 1 (prawy koniec).
+    mpfr_srcptr mpfrView(std::uint64_t k, __mpfr_struct &view, int end = 0) const;
+    // Rekord k := v zaokrąglone do precyzji pliku w kierunku rnd
+    void setMpfr(std::uint64_t k, mpfr_srcptr v, mpfr_rnd_t rnd, int end = 0);
+
+    // Indeks w danych elementu (i, j) albo -1, gdy leży poza zapisanym
+    // obszarem (pasmo, trójdiagonala) – tam macierz ma zero
+    std::int64_t indexOf(std::uint64_t i, std::uint64_t j) const;
+
+    /**
+     * Kopia całej macierzy jako gęstej, wierszami – dla układów innych niż
+     * Dense albo typów MPFR, których solvery nie przyjmą bezpośrednio.
+     */
+    template <typename T> std::vector<T> toDense() const;
+
+private:
+    template <typename T> void expect(StorageLayout layout) const;
+    void checkType(ScalarType t) const;
+    void checkLayout(StorageLayout l) const;
+    void checkWritable() const;
+    unsigned char *record(std::uint64_t k) const;
+
+    MappedFile map_;
+};
+
+/**
+ * Zapis wektora (np. rozwiązania x) jako Dense n×1. Typy MPFR zapisywane są
+ * z precyzją precision (0 → bieżąca domyślna); końce przedziałów zaokrąglane
+ * na zewnątrz.
+ */
+template <typename T>
+void writeVector(const std::string &path, solver::Span<const T> v, mpfr_prec_t precision = 0);
+
+// Zapis macierzy gęstej
+template <typename T>
+void writeDense(const std::string &path, solver::MatrixView<const T> A, mpfr_prec_t precision = 0);
+
+// ─────────────────────────────── szablony ───────────────────────────────────
+
+template <typename T>
+void storeElement(unsigned char *rec, const T &v, mpfr_prec_t prec)
+{
+    if constexpr (std::is_same<T, mpfr::mpreal>::value) {
+        encodeMpfr(rec, v.mpfr_srcptr(), prec, MPFR_RNDN);
+    } else if constexpr (std::is_same<T, interval_arithmetic::Interval<mpfr::mpreal>>::value) {
+        const std::size_t half = elementSize(ScalarType::Mpreal, prec);
+        encodeMpfr(rec, v.a.mpfr_srcptr(), prec, MPFR_RNDD);
+        encodeMpfr(rec + half, v.b.mpfr_srcptr(), prec, MPFR_RNDU);
+    } else {
+        std::memcpy(rec, &v, sizeof(T));
+    }
+}
+
+template <typename T>
+T loadElement(const unsigned char *rec, mpfr_prec_t prec)
+{
+    if constexpr (std::is_same<T, mpfr::mpreal>::value) {
+        __mpfr_struct view;
+        return mpfr::mpreal(decodeMpfr(rec, prec, view));
+    } else if constexpr (std::is_same<T, interval_arithmetic::Interval<mpfr::mpreal>>::value) {
+        const std::size_t half = elementSize(ScalarType::Mpreal, prec);
+        __mpfr_struct lo, hi;
+        return T(mpfr::mpreal(decodeMpfr(rec, prec, lo)), mpfr::mpreal(decodeMpfr(rec + half, prec, hi)));
+    } else {
+        T v;
+        std::memcpy(&v, rec, sizeof(T));
+        return v;
+    }
+}
+
+template <typename T>
+void MatrixFile::expect(StorageLayout layout) const
+{
+    static_assert(isMappable<T>(), "typy MPFR: get/set/toDense zamiast widoków");
+    checkType(ScalarTypeOf<T>::value);
+    checkLayout(layout);
+}
+
+template <typename T>
+solver::MatrixView<const T> MatrixFile::dense() const
+{
+    expect<T>(StorageLayout::Dense);
+    return {reinterpret_cast<const T *>(payload()), int(rows()), int(cols())};
+}
+
+template <typename T>
+solver::MatrixView<T> MatrixFile::dense()
+{
+    expect<T>(StorageLayout::Dense);
+    checkWritable();
+    return {reinterpret_cast<T *>(payload()), int(rows()), int(cols())};
+}
+
+template <typename T>
+solver::Span<const T> MatrixFile::vector() const
+{
+    expect<T>(StorageLayout::Dense);
+    return {reinterpret_cast<const T *>(payload()), std::size_t(header().elementCount)};
+}
+
+template <typename T>
+solver::Span<T> MatrixFile::vector()
+{
+    expect<T>(StorageLayout::Dense);
+    checkWritable();
+    return {reinterpret_cast<T *>(payload()), std::size_t(header().elementCount)};
+}
+
+template <typename T>
+solver::MatrixView<const T> MatrixFile::band() const
+{
+    expect<T>(StorageLayout::Banded);
+    const int w = int(header().lower + header().upper + 1);
+    return {reinterpret_cast<const T *>(payload()), int(rows()), w};
+}
+
+template <typename T>
+solver::Span<const T> MatrixFile::packed() const
+{
+    expect<T>(StorageLayout::PackedSymmetric);
+    return {reinterpret_cast<const T *>(payload()), std::size_t(header().elementCount)};
+}
+
+template <typename T>
+TridiagonalView<const T> MatrixFile::tridiagonal() const
+{
+    expect<T>(StorageLayout::Tridiagonal);
+    const std::size_t n = rows();
+    const T *p = reinterpret_cast<const T *>(payload());
+    return {{p, n - 1}, {p + (n - 1), n}, {p + (2 * n - 1), n - 1}};
+}
+
+template <typename T>
+TridiagonalView<T> MatrixFile::tridiagonal()
+{
+    expect<T>(StorageLayout::Tridiagonal);
+    checkWritable();
+    const std::size_t n = rows();
+    T *p = reinterpret_cast<T *>(payload());
+    return {{p, n - 1}, {p + (n - 1), n}, {p + (2 * n - 1), n - 1}};
+}
+
+template <typename T>
+T MatrixFile::get(std::uint64_t k) const
+{
+    checkType(ScalarTypeOf<T>::value);
+    if constexpr (std::is_same<T, mpfr::mpreal>::value) {
+        __mpfr_struct view;
+        return mpfr::mpreal(mpfrView(k, view));
+    } else if constexpr (std::is_same<T, interval_arithmetic::Interval<mpfr::mpreal>>::value) {
+        __mpfr_struct lo, hi;
+        return T(mpfr::mpreal(mpfrView(k, lo, 0)), mpfr::mpreal(mpfrView(k, hi, 1)));
+    } else {
+        return reinterpret_cast<const T *>(payload())[k];
+    }
+}
+
+template <typename T>
+void MatrixFile::set(std::uint64_t k, const T &v)
+{
+    checkType(ScalarTypeOf<T>::value);
+    checkWritable();
+    if constexpr (std::is_same<T, mpfr::mpreal>::value) {
+        setMpfr(k, v.mpfr_srcptr(), MPFR_RNDN);
+    } else if constexpr (std::is_same<T, interval_arithmetic::Interval<mpfr::mpreal>>::value) {
+        setMpfr(k, v.a.mpfr_srcptr(), MPFR_RNDD, 0);
+        setMpfr(k, v.b.mpfr_srcptr(), MPFR_RNDU, 1);
+    } else {
+        reinterpret_cast<T *>(payload())[k] = v;
+    }
+}
+
+template <typename T>
+std::vector<T> MatrixFile::toDense() const
+{
+    checkType(ScalarTypeOf<T>::value);
+    const std::uint64_t r = rows(), c = cols();
+    std::vector<T> out;
+    out.reserve(std::size_t(r * c));
+    for (std::uint64_t i = 0; i < r; ++i)
+        for (std::uint64_t j = 0; j < c; ++j) {
+            const std::int64_t k = indexOf(i, j);
+            // T() to zero dla wszystkich obsługiwanych typów
+            out.push_back(k >= 0 ? get<T>(std::uint64_t(k)) : T());
+        }
+    return out;
+}
+
+template <typename T>
+void writeVector(const std::string &path, solver::Span<const T> v, mpfr_prec_t precision)
+{
+    MatrixFile f = MatrixFile::create(
+        path, makeHeader(ScalarTypeOf<T>::value, StorageLayout::Dense, v.size(), 1, 0, 0, precision));
+    for (std::size_t k = 0; k < v.size(); ++k)
+        f.set<T>(k, v[k]);
+    f.flush();
+}
+
+template <typename T>
+void writeDense(const std::string &path, solver::MatrixView<const T> A, mpfr_prec_t precision)
+{
+    MatrixFile f = MatrixFile::create(
+        path, makeHeader(ScalarTypeOf<T>::value, StorageLayout::Dense, A.rows(), A.cols(), 0, 0, precision));
+    std::uint64_t k = 0;
+    for (int i = 0; i < A.rows(); ++i)
+        for (int j = 0; j < A.cols(); ++j)
+            f.set<T>(k++, A[i][j]);
+    f.flush();
+}
+
+} // namespace utils
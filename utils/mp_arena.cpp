@@ -0,0 +1,277 @@
+#include "mp_arena.h"
+
+#include <gmp.h>
+#include <mpfr.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kAlign     = 16;
+constexpr std::size_t kChunkSize = std::size_t(1) << 20;
+// Klasy rozmiarów (co kAlign bajtów) z listami wolnych bloków; większe bloki
+// są tylko przesuwane i wracają dopiero przy resecie
+constexpr std::size_t kClasses   = 128;
+// Przesunięcie licznika na czas trwania zakresu – zwolnienia z innych wątków
+// nie mogą go sprowadzić do zera, zanim zakres się zamknie
+constexpr std::size_t kScopeBias = std::size_t(1) << (sizeof(std::size_t) * 8 - 2);
+
+struct Chunk {
+    char *data;
+    std::size_t size;
+};
+
+// Pamięć jednego zakresu. Póki zakres trwa, wątek-właściciel liczy żywe
+// bloki bez atomików (ThreadArena::live); refs zbiera tylko zwolnienia z innych
+// wątków i zwolnienia po zamknięciu zakresu. Kto sprowadzi refs do zera, zwalnia.
+struct Generation {
+    std::vector<Chunk> chunks;
+    std::atomic<std::size_t> refs{kScopeBias};
+};
+
+// Nagłówek przed każdym blokiem: właściciel (nullptr = malloc) i rozmiar
+struct alignas(kAlign) BlockHeader {
+    Generation *owner;
+    std::size_t size;
+};
+static_assert(sizeof(BlockHeader) == kAlign, "nagłówek musi zachować wyrównanie");
+
+struct ThreadArena {
+    Generation *gen = nullptr;
+    int depth = 0;
+    std::size_t chunk = 0;     // indeks bieżącego kawałka w gen->chunks
+    std::size_t offset = 0;    // przesunięcie w bieżącym kawałku
+    std::size_t used = 0;      // bajty zajęte w bieżącym zakresie
+    std::size_t scopePeak = 0;
+    std::size_t live = 0;      // bloki przydzielone minus zwolnione lokalnie
+    void *freeList[kClasses] = {};
+    std::vector<Chunk> spare;  // kawałki odzyskane po resecie
+    MpArena::Stats stats;
+
+    ~ThreadArena() {
+        for (const Chunk &c : spare)
+            std::free(c.data);
+    }
+};
+
+thread_local ThreadArena tls;
+std::atomic<bool> g_enabled{true};
+std::atomic<bool> g_installed{false};
+
+// Funkcje pamięci GMP nie mogą zwrócić NULL ani rzucać (wołane z kodu C)
+[[noreturn]] void outOfMemory()
+{
+    std::fputs("MpArena: out of memory\n", stderr);
+    std::abort();
+}
+
+void releaseChunks(std::vector<Chunk> &chunks)
+{
+    for (const Chunk &c : chunks)
+        std::free(c.data);
+    chunks.clear();
+}
+
+void dropRef(Generation *g)
+{
+    if (g->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        releaseChunks(g->chunks);
+        delete g;
+    }
+}
+
+void *mallocBlock(std::size_t size)
+{
+    auto *h = static_cast<BlockHeader *>(std::malloc(sizeof(BlockHeader) + size));
+    if (!h)
+        outOfMemory();
+    h->owner = nullptr;
+    h->size = size;
+    ++tls.stats.mallocAllocations;
+    return h + 1;
+}
+
+void *arenaBlock(std::size_t size)
+{
+    ThreadArena &a = tls;
+    Generation *g = a.gen;
+    const std::size_t need = (sizeof(BlockHeader) + size + kAlign - 1) / kAlign * kAlign;
+    const std::size_t cls = need / kAlign;
+
+    ++a.live;
+    ++a.stats.arenaAllocations;
+    if (cls < kClasses && a.freeList[cls]) {
+        auto *h = static_cast<BlockHeader *>(a.freeList[cls]);
+        a.freeList[cls] = *reinterpret_cast<void **>(h + 1);
+        h->size = size;
+        return h + 1;
+    }
+
+    while (a.chunk >= g->chunks.size() || a.offset + need > g->chunks[a.chunk].size) {
+        if (a.chunk < g->chunks.size())
+            ++a.chunk;
+        a.offset = 0;
+        if (a.chunk < g->chunks.size())
+            continue;
+        // nowy kawałek: najpierw z odzysku, potem malloc
+        auto it = std::find_if(a.spare.begin(), a.spare.end(),
+                               [need](const Chunk &c) { return c.size >= need; });
+        if (it != a.spare.end()) {
+            g->chunks.push_back(*it);
+            a.spare.erase(it);
+        } else {
+            const std::size_t sz = std::max(kChunkSize, need);
+            char *p = static_cast<char *>(std::malloc(sz));
+            if (!p)
+                outOfMemory();
+            g->chunks.push_back({p, sz});
+            a.stats.reservedBytes += sz;
+        }
+    }
+
+    auto *h = reinterpret_cast<BlockHeader *>(g->chunks[a.chunk].data + a.offset);
+    a.offset += need;
+    a.used += need;
+    a.scopePeak = std::max(a.scopePeak, a.used);
+    h->owner = g;
+    h->size = size;
+    return h + 1;
+}
+
+bool arenaActive()
+{
+    return tls.gen && g_enabled.load(std::memory_order_relaxed);
+}
+
+void *gmpAlloc(std::size_t size)
+{
+    if (arenaActive())
+        return arenaBlock(size);
+    return mallocBlock(size);
+}
+
+void gmpFree(void *p, std::size_t)
+{
+    if (!p)
+        return;
+    BlockHeader *h = static_cast<BlockHeader *>(p) - 1;
+    ThreadArena &a = tls;
+    if (!h->owner) {
+        std::free(h);
+    } else if (h->owner == a.gen) {
+        // blok bieżącego zakresu: na listę wolnych swojej klasy
+        --a.live;
+        const std::size_t cls = (sizeof(BlockHeader) + h->size + kAlign - 1) / kAlign;
+        if (cls < kClasses) {
+            *reinterpret_cast<void **>(p) = a.freeList[cls];
+            a.freeList[cls] = h;
+        }
+    } else {
+        dropRef(h->owner);   // zakres zamknięty albo inny wątek
+    }
+}
+
+void *gmpRealloc(void *p, std::size_t, std::size_t newSize)
+{
+    if (!p)
+        return gmpAlloc(newSize);
+    BlockHeader *h = static_cast<BlockHeader *>(p) - 1;
+    if (!h->owner && !arenaActive()) {
+        auto *n = static_cast<BlockHeader *>(std::realloc(h, sizeof(BlockHeader) + newSize));
+        if (!n)
+            outOfMemory();
+        n->size = newSize;
+        return n + 1;
+    }
+    void *q = gmpAlloc(newSize);
+    std::memcpy(q, p, std::min(h->size, newSize));
+    gmpFree(p, h->size);
+    return q;
+}
+
+} // anonymous
+
+void MpArena::install()
+{
+    if (g_installed.exchange(true))
+        return;
+    if (const char *env = std::getenv("CROUT_MP_ARENA"))
+        g_enabled = std::strcmp(env, "0") != 0;
+    mp_set_memory_functions(gmpAlloc, gmpRealloc, gmpFree);
+    // MPFR buforuje funkcje pamięci GMP – wymuszamy ponowne pobranie
+    mpfr_mp_memory_cleanup();
+}
+
+bool MpArena::installed()
+{
+    return g_installed.load();
+}
+
+void MpArena::setEnabled(bool on)
+{
+    g_enabled = on;
+}
+
+bool MpArena::enabled()
+{
+    return g_enabled.load();
+}
+
+MpArena::Stats MpArena::threadStats()
+{
+    return tls.stats;
+}
+
+MpArenaScope::MpArenaScope()
+{
+    ThreadArena &a = tls;
+    if (a.depth++ > 0 || !g_installed.load())
+        return;
+    outer_ = true;
+    a.gen = new Generation;
+    a.chunk = 0;
+    a.offset = 0;
+    a.used = 0;
+    a.scopePeak = 0;
+    a.live = 0;
+    std::fill(std::begin(a.freeList), std::end(a.freeList), nullptr);
+}
+
+MpArenaScope::~MpArenaScope()
+{
+    ThreadArena &a = tls;
+    --a.depth;
+    if (!outer_)
+        return;
+
+    a.stats.peakBytes = std::max(a.stats.peakBytes, a.scopePeak);
+    Generation *g = a.gen;
+    a.gen = nullptr;
+    std::size_t held = 0;
+    for (const Chunk &c : g->chunks)
+        held += c.size;
+    // refs := live - zwolnienia zdalne (zdejmujemy przesunięcie zakresu)
+    const std::size_t delta = a.live - kScopeBias;
+    if (g->refs.fetch_add(delta, std::memory_order_acq_rel) + delta == 0) {
+        // nic nie przeżyło zakresu – reset hurtowy, kawałki do odzysku
+        a.spare.insert(a.spare.end(), g->chunks.begin(), g->chunks.end());
+        delete g;
+    } else {
+        // żywe bloki poza zakresem: zwolni je ostatni gmpFree (g już nie nasze)
+        a.stats.reservedBytes -= held;
+    }
+}
+
+std::size_t MpArenaScope::peakBytes() const
+{
+    return tls.scopePeak;
+}
+
+} // namespace utils
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+
+namespace utils {
+
+/**
+ * Arena dla limbów GMP/MPFR, podpinana przez mp_set_memory_functions.
+ *
+ * Każdy wątek ma własną arenę typu bump: w obrębie MpArenaScope alokacje
+ * mpreal / Interval<mpreal> przesuwają tylko wskaźnik w dużym kawałku pamięci,
+ * a zwolnienia niczego nie robią. Po zakończeniu zakresu (koniec jednego
+ * rozwiązania) całość jest zerowana naraz i kawałki wracają do ponownego
+ * użycia. Poza zakresem, lub gdy arena jest wyłączona, alokacje idą do malloc.
+ *
+ * Bloki, które przeżyją zakres (np. wynik zwrócony z solvera), pozostają
+ * ważne: pamięć zakresu jest zwalniana dopiero przy ostatnim free.
+ */
+class MpArena {
+public:
+    struct Stats {
+        std::size_t peakBytes = 0;        // maks. zajętość areny w jednym zakresie
+        std::size_t reservedBytes = 0;    // pamięć trzymana przez arenę wątku
+        std::size_t arenaAllocations = 0;
+        std::size_t mallocAllocations = 0;
+    };
+
+    // Instaluje funkcje pamięci GMP. Musi być wywołane przed pierwszą
+    // alokacją GMP/MPFR w procesie (na początku main). Zmienna środowiskowa
+    // CROUT_MP_ARENA=0 od razu włącza tryb malloc.
+    static void install();
+    static bool installed();
+
+    // false → każda alokacja idzie do malloc (debugowanie, valgrind/ASan)
+    static void setEnabled(bool on);
+    static bool enabled();
+
+    // Statystyki bieżącego wątku (skumulowane od startu wątku)
+    static Stats threadStats();
+};
+
+/**
+ * Zakres jednego rozwiązania: aktywuje arenę wątku, a w destruktorze ją
+ * resetuje. Zakresy mogą być zagnieżdżone – liczy się najbardziej zewnętrzny.
+ */
+class MpArenaScope {
+public:
+    MpArenaScope();
+    ~MpArenaScope();
+
+    MpArenaScope(const MpArenaScope &) = delete;
+    MpArenaScope &operator=(const MpArenaScope &) = delete;
+
+    // Maksymalna zajętość areny w tym zakresie (bajty)
+    std::size_t peakBytes() const;
+
+private:
+    bool outer_ = false;
+};
+
+} // namespace utils
@@ -0,0 +1,99 @@
+#include "mp_matrix.h"
+
+#include <new>
+#include <utility>
+
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kBlockAlign = 64;
+
+// Rozmiar limbów jednego elementu, zaokrąglony do wielokrotności mp_limb_t
+std::size_t limbBytes(mpfr_prec_t prec)
+{
+    const std::size_t s = mpfr_custom_get_size(prec);
+    return (s + sizeof(mp_limb_t) - 1) / sizeof(mp_limb_t) * sizeof(mp_limb_t);
+}
+
+// Nagłówki zajmują początek bloku; limby zaczynają się od wyrównanego offsetu
+std::size_t headerBytes(std::size_t count)
+{
+    const std::size_t s = count * sizeof(__mpfr_struct);
+    return (s + kBlockAlign - 1) / kBlockAlign * kBlockAlign;
+}
+
+} // anonymous
+
+MpMatrix::MpMatrix(int rows, int cols, mpfr_prec_t prec)
+    : rows_(rows), cols_(cols), prec_(prec)
+{
+    const std::size_t count = static_cast<std::size_t>(rows) * cols;
+    if (count == 0)
+        return;
+
+    const std::size_t limb = limbBytes(prec);
+    block_ = ::operator new(headerBytes(count) + count * limb, std::align_val_t(kBlockAlign));
+    headers_ = static_cast<mpfr_ptr>(block_);
+
+    char *limbs = static_cast<char *>(block_) + headerBytes(count);
+    for (std::size_t k = 0; k < count; ++k) {
+        void *significand = limbs + k * limb;
+        mpfr_custom_init(significand, prec);
+        mpfr_custom_init_set(headers_ + k, MPFR_ZERO_KIND, 0, prec, significand);
+    }
+}
+
+MpMatrix::~MpMatrix()
+{
+    // Nagłówki nie wymagają mpfr_clear – limby należą do bloku
+    if (block_)
+        ::operator delete(block_, std::align_val_t(kBlockAlign));
+}
+
+MpMatrix::MpMatrix(const MpMatrix &other)
+    : MpMatrix(other.rows_, other.cols_, other.prec_)
+{
+    const std::size_t count = static_cast<std::size_t>(rows_) * cols_;
+    for (std::size_t k = 0; k < count; ++k)
+        mpfr_set(headers_ + k, other.headers_ + k, MPFR_RNDN);  // ta sama precyzja – dokładnie
+}
+
+MpMatrix::MpMatrix(MpMatrix &&other) noexcept
+{
+    swap(*this, other);
+}
+
+MpMatrix &MpMatrix::operator=(MpMatrix other) noexcept
+{
+    swap(*this, other);
+    return *this;
+}
+
+void swap(MpMatrix &a, MpMatrix &b) noexcept
+{
+    std::swap(a.rows_, b.rows_);
+    std::swap(a.cols_, b.cols_);
+    std::swap(a.prec_, b.prec_);
+    std::swap(a.block_, b.block_);
+    std::swap(a.headers_, b.headers_);
+}
+
+void MpMatrix::set(int i, int j, const mpfr::mpreal &v, mpfr_rnd_t rnd)
+{
+    mpfr_set(at(i, j), v.mpfr_srcptr(), rnd);
+}
+
+mpfr::mpreal MpMatrix::get(int i, int j) const
+{
+    return mpfr::mpreal(at(i, j));
+}
+
+void MpMatrix::setZero()
+{
+    const std::size_t count = static_cast<std::size_t>(rows_) * cols_;
+    for (std::size_t k = 0; k < count; ++k)
+        mpfr_set_zero(headers_ + k, 1);
+}
+
+} // namespace utils
@@ -0,0 +1,87 @@
+#pragma once
+#include <cstddef>
+#include <mpfr.h>
+#include "mpreal.h"
+
+namespace utils {
+
+/**
+ * Macierz rows×cols liczb MPFR o wspólnej precyzji, trzymana w jednym
+ * wyrównanym bloku pamięci: najpierw nagłówki __mpfr_struct, potem limby
+ * wszystkich elementów (mpfr_custom_init_set). Zamiast n² osobnych alokacji
+ * mpreal jest jedna, a sąsiednie elementy wiersza leżą obok siebie.
+ *
+ * Elementy udostępniane są jako widoki mpfr_ptr / mpfr_srcptr do użycia
+ * z funkcjami mpfr_*; nie wolno ich przekazywać do mpfr_clear ani
+ * mpfr_set_prec (pamięć należy do macierzy).
+ */
+class MpMatrix {
+public:
+    MpMatrix() = default;
+    MpMatrix(int rows, int cols, mpfr_prec_t prec = mpfr::mpreal::get_default_prec());
+    ~MpMatrix();
+
+    MpMatrix(const MpMatrix &other);
+    MpMatrix(MpMatrix &&other) noexcept;
+    MpMatrix &operator=(MpMatrix other) noexcept;
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    mpfr_prec_t precision() const { return prec_; }
+
+    mpfr_ptr at(int i, int j) { return headers_ + index(i, j); }
+    mpfr_srcptr at(int i, int j) const { return headers_ + index(i, j); }
+
+    // Wiersz i: cols() kolejnych nagłówków
+    mpfr_ptr row(int i) { return headers_ + index(i, 0); }
+    mpfr_srcptr row(int i) const { return headers_ + index(i, 0); }
+
+    void set(int i, int j, const mpfr::mpreal &v,
+             mpfr_rnd_t rnd = mpfr::mpreal::get_default_rnd());
+    mpfr::mpreal get(int i, int j) const;
+
+    // Wszystkie elementy = 0
+    void setZero();
+
+    friend void swap(MpMatrix &a, MpMatrix &b) noexcept;
+
+private:
+    std::size_t index(int i, int j) const {
+        return static_cast<std::size_t>(i) * cols_ + j;
+    }
+
+    int rows_ = 0;
+    int cols_ = 0;
+    mpfr_prec_t prec_ = 0;
+    void *block_ = nullptr;
+    mpfr_ptr headers_ = nullptr;
+};
+
+/**
+ * Wektor MPFR w jednym bloku – MpMatrix o jednej kolumnie.
+ */
+class MpVector {
+public:
+    MpVector() = default;
+    explicit MpVector(int n, mpfr_prec_t prec = mpfr::mpreal::get_default_prec())
+        : m_(n, 1, prec) {}
+
+    int size() const { return m_.rows(); }
+    mpfr_prec_t precision() const { return m_.precision(); }
+
+    mpfr_ptr at(int i) { return m_.at(i, 0); }
+    mpfr_srcptr at(int i) const { return m_.at(i, 0); }
+    mpfr_ptr data() { return m_.row(0); }
+    mpfr_srcptr data() const { return m_.row(0); }
+
+    void set(int i, const mpfr::mpreal &v,
+             mpfr_rnd_t rnd = mpfr::mpreal::get_default_rnd()) { m_.set(i, 0, v, rnd); }
+    mpfr::mpreal get(int i) const { return m_.get(i, 0); }
+
+    void setZero() { m_.setZero(); }
+
+private:
+    MpMatrix m_;
+};
+
+} // namespace utils
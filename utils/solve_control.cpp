@@ -0,0 +1,18 @@
+#include "solve_control.h"
+
+namespace utils {
+
+void SolveControl::step(std::int64_t done, std::int64_t total)
+{
+    if (cancelled())
+        throw SolveCancelled();
+    if (!onProgress || total <= 0)
+        return;
+    const int percent = int(done * 100 / total);
+    if (percent == reported_)
+        return;
+    reported_ = percent;
+    onProgress(done, total);
+}
+
+} // namespace utils
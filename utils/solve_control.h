@@ -0,0 +1,69 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+
+// Przerywanie i postęp rozwiązań uruchomionych w osobnym wątku (GUI).
+//
+// Silniki wołają control::checkpoint(done, total) raz na kolumnę rozkładu
+// (tiled: raz na krok kafelkowy). Bez zainstalowanego SolveControl to jeden
+// odczyt wskaźnika thread_local – wyniki i koszt rozwiązania bez zmian.
+
+namespace utils {
+
+// Rzucany z checkpoint() po SolveControl::cancel(). Celowo nie jest
+// std::runtime_error, żeby nie mylił się z osobliwością macierzy.
+class SolveCancelled : public std::exception {
+public:
+    const char *what() const noexcept override { return "Solve cancelled."; }
+};
+
+/**
+ * Sterowanie rozwiązaniem: cancel() z dowolnego wątku, onProgress wołane
+ * w wątku solvera z liczbą gotowych kolumn rozkładu i n – najwyżej raz na
+ * procent, zawsze na początku i na końcu rozkładu.
+ */
+class SolveControl {
+public:
+    std::function<void(std::int64_t done, std::int64_t total)> onProgress;
+
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    bool cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+    // Dla checkpoint(): SolveCancelled albo zgłoszenie postępu
+    void step(std::int64_t done, std::int64_t total);
+
+private:
+    std::atomic<bool> cancelled_{false};
+    int reported_ = -1;  // ostatni zgłoszony procent
+};
+
+namespace control {
+
+namespace detail {
+// Sterowanie bieżącego rozwiązania w tym wątku (nullptr poza Scope)
+inline thread_local SolveControl *active = nullptr;
+} // namespace detail
+
+// Punkt przerwania w pętli rozkładu
+inline void checkpoint(std::int64_t done, std::int64_t total)
+{
+    if (SolveControl *c = detail::active)
+        c->step(done, total);
+}
+
+// Podpina SolveControl pod solvery wołane w tym wątku do końca zakresu
+class Scope {
+public:
+    explicit Scope(SolveControl &c) : outer_(detail::active) { detail::active = &c; }
+    ~Scope() { detail::active = outer_; }
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+private:
+    SolveControl *outer_;
+};
+
+} // namespace control
+} // namespace utils
@@ -0,0 +1,641 @@
+#include "text_matrix.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+#include <mpfr.h>
+#include "mpreal.h"
+#include "interval.hpp"
+#include "multi_double.hpp"
+#include "float128.hpp"
+#include "trace.h"
+
+namespace utils {
+
+namespace {
+
+namespace IA = interval_arithmetic;
+
+// Kawałek mniejszy niż to nie opłaca się osobnemu wątkowi
+constexpr std::size_t kMinChunk = std::size_t(1) << 20;
+
+bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+const char *skipBlank(const char *p, const char *e)
+{
+    while (p < e && isBlank(*p))
+        ++p;
+    return p;
+}
+
+const char *tokenEnd(const char *p, const char *e)
+{
+    while (p < e && !isBlank(*p))
+        ++p;
+    return p;
+}
+
+// fn(b, e) dla każdej linii danych z [p, e): bez końcowych białych znaków,
+// bez linii pustych i zaczynających się od znaku comment
+template <typename F>
+void forEachLine(const char *p, const char *e, char comment, F fn)
+{
+    while (p < e) {
+        const char *nl = static_cast<const char *>(std::memchr(p, '\n', std::size_t(e - p)));
+        const char *end = nl ? nl : e;
+        const char *b = skipBlank(p, end);
+        const char *t = end;
+        while (t > b && isBlank(t[-1]))
+            --t;
+        if (b < t && *b != comment)
+            fn(b, t);
+        p = nl ? nl + 1 : e;
+    }
+}
+
+// Dzieli [b, e) na najwyżej parts kawałków zaczynających się od początku linii
+template <typename Chunk>
+std::vector<Chunk> split(const char *b, const char *e, std::size_t parts)
+{
+    std::vector<Chunk> out;
+    const char *p = b;
+    for (std::size_t k = 1; k <= parts && p < e; ++k) {
+        const char *q = e;
+        if (k < parts) {
+            q = std::max(p, b + std::size_t(e - b) * k / parts);
+            const void *nl = std::memchr(q, '\n', std::size_t(e - q));
+            q = nl ? static_cast<const char *>(nl) + 1 : e;
+        }
+        out.push_back({p, q, 0});
+        p = q;
+    }
+    return out;
+}
+
+// fn(k) dla k = 0..parts-1, każde na osobnym wątku; pierwszy wyjątek
+// przekazywany wołającemu po zakończeniu wszystkich
+template <typename F>
+void parallel(std::size_t parts, F fn)
+{
+    // domyślna precyzja MPFR jest lokalna dla wątku
+    const mpfr_prec_t prec = mpfr_get_default_prec();
+    std::exception_ptr error;
+    std::mutex lock;
+    auto run = [&](std::size_t k) {
+        mpfr_set_default_prec(prec);
+        utils::trace::Scope task("io", "text chunk", int(k));
+        try {
+            fn(k);
+        } catch (...) {
+            std::lock_guard<std::mutex> g(lock);
+            if (!error)
+                error = std::current_exception();
+        }
+    };
+    std::vector<std::thread> pool;
+    for (std::size_t k = 1; k < parts; ++k)
+        pool.emplace_back(run, k);
+    if (parts)
+        run(0);
+    for (auto &t : pool)
+        t.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+bool parseInt(const char *b, const char *e, std::uint64_t &v)
+{
+    const auto r = std::from_chars(b, e, v);
+    return r.ec == std::errc() && r.ptr == e;
+}
+
+bool equalsLower(const char *b, const char *e, const char *word)
+{
+    for (; b < e && *word; ++b, ++word)
+        if (std::tolower(static_cast<unsigned char>(*b)) != *word)
+            return false;
+    return b == e && !*word;
+}
+
+// Token to zapis zera (dowolnego typu) – elementy poza pasmem trójdiagonalnej
+bool isZeroText(const char *b, const char *e)
+{
+    if (b < e && (*b == '+' || *b == '-'))
+        ++b;
+    double v = 1;
+    const auto r = std::from_chars(b, e, v);
+    return r.ec == std::errc() && r.ptr == e && v == 0;
+}
+
+[[noreturn]] void badNumber(const char *b, const char *e)
+{
+    throw std::invalid_argument("invalid number '" + std::string(b, e) + "'");
+}
+
+// ─────────────────────── parsowanie elementów ─────────────────────────────
+// Jeden obiekt na wątek: trzyma bufory i zmienne MPFR między elementami
+
+// Token jako napis C dla mpfr_strtofr i strtoflt128
+struct TokenBuffer {
+    std::string buf;
+
+    const char *cstr(const char *b, const char *e)
+    {
+        buf.assign(b, e);
+        return buf.c_str();
+    }
+    bool mpfr(mpfr_ptr rop, const char *b, const char *e, mpfr_rnd_t rnd)
+    {
+        const char *s = cstr(b, e);
+        char *end = nullptr;
+        mpfr_strtofr(rop, s, &end, 10, rnd);
+        return end != s && *end == '\0';
+    }
+};
+
+template <typename T>
+struct ScalarParser;
+
+template <>
+struct ScalarParser<double> : TokenBuffer {
+    void operator()(const char *b, const char *e, double &out)
+    {
+        // from_chars nie przyjmuje '+'
+        const char *s = (b < e && *b == '+' && e - b > 1 && b[1] != '-') ? b + 1 : b;
+        const auto r = std::from_chars(s, e, out);
+        if (r.ptr == e && r.ec == std::errc())
+            return;
+        // poza zakresem: ±inf albo ±0 jak strtod
+        if (r.ptr == e && r.ec == std::errc::result_out_of_range) {
+            out = std::strtod(cstr(b, e), nullptr);
+            return;
+        }
+        badNumber(b, e);
+    }
+};
+
+template <>
+struct ScalarParser<mpfr::mpreal> : TokenBuffer {
+    const mpfr_prec_t prec = mpfr_get_default_prec();
+
+    void operator()(const char *b, const char *e, mpfr::mpreal &out)
+    {
+        // od razu w miejsce docelowe
+        if (mpfr_get_prec(out.mpfr_srcptr()) != prec)
+            mpfr_set_prec(out.mpfr_ptr(), prec);
+        if (!mpfr(out.mpfr_ptr(), b, e, MPFR_RNDN))
+            badNumber(b, e);
+    }
+};
+
+// double-double / quad-double: przez mpreal o precyzji większej niż typ
+template <typename T, int Bits>
+struct MultiDoubleParser : TokenBuffer {
+    mpfr::mpreal v{0, Bits};
+
+    void operator()(const char *b, const char *e, T &out)
+    {
+        if (!mpfr(v.mpfr_ptr(), b, e, MPFR_RNDN))
+            badNumber(b, e);
+        out = T(v);
+    }
+};
+
+template <>
+struct ScalarParser<multidouble::DoubleDouble> : MultiDoubleParser<multidouble::DoubleDouble, 256> {};
+template <>
+struct ScalarParser<multidouble::QuadDouble> : MultiDoubleParser<multidouble::QuadDouble, 512> {};
+
+#ifdef CROUT_HAVE_FLOAT128
+template <>
+struct ScalarParser<__float128> : TokenBuffer {
+    void operator()(const char *b, const char *e, __float128 &out)
+    {
+        buf.assign(b, e);
+        if (!float128::parse(buf, out))
+            badNumber(b, e);
+    }
+};
+#endif
+
+// Przedziały: końce zaokrąglane na zewnątrz
+template <typename T>
+struct ScalarParser<IA::Interval<T>> : TokenBuffer {
+    static constexpr bool isMp = std::is_same<T, mpfr::mpreal>::value;
+    const mpfr_prec_t prec = isMp ? mpfr_get_default_prec() : 53;
+    mpfr::mpreal r{0, 53};
+
+    void end(const char *b, const char *e, mpfr_rnd_t rnd, T &out)
+    {
+        if constexpr (isMp) {
+            if (mpfr_get_prec(out.mpfr_srcptr()) != prec)
+                mpfr_set_prec(out.mpfr_ptr(), prec);
+            if (!mpfr(out.mpfr_ptr(), b, e, rnd))
+                badNumber(b, e);
+        } else {
+            if (!mpfr(r.mpfr_ptr(), b, e, rnd))
+                badNumber(b, e);
+            out = mpfr_get_d(r.mpfr_srcptr(), rnd);
+        }
+    }
+    void operator()(const char *b, const char *e, IA::Interval<T> &out)
+    {
+        const char *semi = std::find(b, e, ';');
+        end(b, semi, MPFR_RNDD, out.a);
+        if (semi == e)
+            end(b, e, MPFR_RNDU, out.b);
+        else
+            end(semi + 1, e, MPFR_RNDU, out.b);
+    }
+};
+
+} // anonymous
+
+// ─────────────────────────────── nagłówek ───────────────────────────────────
+
+void TextMatrixReader::fail(const std::string &msg) const
+{
+    throw std::runtime_error(path_ + ": " + msg);
+}
+
+TextMatrixReader TextMatrixReader::open(const std::string &path, TextReadOptions options)
+{
+    TextMatrixReader r;
+    r.path_ = path;
+    r.map_ = MappedFile::openRead(path);
+    const char *p = reinterpret_cast<const char *>(r.map_.data());
+    const char *const e = p + r.map_.size();
+    r.delimiter_ = options.delimiter;
+    r.readHeader(p, e);
+
+    const std::size_t hw = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t nt = options.threads > 0 ? std::size_t(options.threads) : hw;
+    const std::size_t parts = std::max<std::size_t>(1, std::min(nt, std::size_t(e - p) / kMinChunk));
+    r.chunks_ = split<Chunk>(p, e, parts);
+    r.countEntries();
+    return r;
+}
+
+void TextMatrixReader::readHeader(const char *&p, const char *e)
+{
+    static const char banner[] = "%%MatrixMarket";
+    const std::size_t len = sizeof banner - 1;
+
+    // pierwsza linia danych; p przesuwane za nią, gdy to nagłówek
+    auto nextLine = [&](const char *&b, const char *&t, char comment) {
+        while (p < e) {
+            const char *nl = static_cast<const char *>(std::memchr(p, '\n', std::size_t(e - p)));
+            const char *end = nl ? nl : e;
+            b = skipBlank(p, end);
+            t = end;
+            while (t > b && isBlank(t[-1]))
+                --t;
+            const char *next = nl ? nl + 1 : e;
+            if (b < t && *b != comment)
+                return next;
+            p = next;
+        }
+        fail("no data");
+    };
+
+    if (std::size_t(e - p) >= len && std::strncmp(p, banner, len) == 0) {
+        // %%MatrixMarket matrix <format> <field> <symmetry>
+        const char *nl = static_cast<const char *>(std::memchr(p, '\n', std::size_t(e - p)));
+        const char *le = nl ? nl : e;
+        const char *w[4];
+        const char *we[4];
+        const char *q = p + len;
+        for (int k = 0; k < 4; ++k) {
+            w[k] = skipBlank(q, le);
+            we[k] = q = tokenEnd(w[k], le);
+            if (w[k] == we[k])
+                fail("incomplete Matrix Market banner");
+        }
+        if (!equalsLower(w[0], we[0], "matrix"))
+            fail("Matrix Market object must be 'matrix'");
+        if (equalsLower(w[1], we[1], "array"))
+            format_ = TextFormat::MatrixMarketArray;
+        else if (equalsLower(w[1], we[1], "coordinate"))
+            format_ = TextFormat::MatrixMarketCoordinate;
+        else
+            fail("unknown Matrix Market format '" + std::string(w[1], we[1]) + "'");
+        if (equalsLower(w[2], we[2], "pattern"))
+            pattern_ = true;
+        else if (!equalsLower(w[2], we[2], "real") && !equalsLower(w[2], we[2], "double")
+                 && !equalsLower(w[2], we[2], "integer"))
+            fail("unsupported Matrix Market field '" + std::string(w[2], we[2]) + "'");
+        if (pattern_ && format_ == TextFormat::MatrixMarketArray)
+            fail("pattern field requires coordinate format");
+        if (equalsLower(w[3], we[3], "symmetric"))
+            symmetric_ = true;
+        else if (!equalsLower(w[3], we[3], "general"))
+            fail("unsupported Matrix Market symmetry '" + std::string(w[3], we[3]) + "'");
+        p = nl ? nl + 1 : e;
+
+        // wiersz wymiarów: m n (array) albo m n nnz (coordinate)
+        const char *b, *t;
+        const char *next = nextLine(b, t, '%');
+        std::uint64_t dims[3] = {0, 0, 0};
+        const int want = format_ == TextFormat::MatrixMarketArray ? 2 : 3;
+        for (int k = 0; k < want; ++k) {
+            const char *s = skipBlank(b, t);
+            b = tokenEnd(s, t);
+            if (!parseInt(s, b, dims[k]))
+                fail("bad Matrix Market size line");
+        }
+        if (skipBlank(b, t) != t)
+            fail("bad Matrix Market size line");
+        if (dims[0] == 0 || dims[1] == 0 || dims[0] > INT_MAX || dims[1] > INT_MAX)
+            fail("matrix dimensions out of range");
+        rows_ = int(dims[0]);
+        cols_ = int(dims[1]);
+        if (symmetric_ && rows_ != cols_)
+            fail("symmetric matrix must be square");
+        if (format_ == TextFormat::MatrixMarketCoordinate)
+            entries_ = dims[2];
+        else
+            entries_ = symmetric_ ? dims[0] * (dims[0] + 1) / 2 : dims[0] * dims[1];
+        p = next;
+        return;
+    }
+
+    // CSV: separator i liczba kolumn z pierwszej linii danych
+    format_ = TextFormat::Csv;
+    const char *b, *t;
+    const char *next = nextLine(b, t, '#');
+    if (!delimiter_) {
+        if (std::find(b, t, ',') != t)
+            delimiter_ = ',';
+        else if (std::find(b, t, '\t') != t)
+            delimiter_ = '\t';
+        else if (std::find(b, t, ';') != t)
+            delimiter_ = ';';
+        else
+            delimiter_ = ' ';
+    }
+    // nagłówek: pierwsze pole nie zaczyna się liczbą
+    double v;
+    const char *s = (*b == '+') ? b + 1 : b;
+    const auto r = std::from_chars(s, t, v);
+    if (r.ptr == s) {
+        p = next;
+        nextLine(b, t, '#');
+    }
+    const bool ws = delimiter_ == ' ';
+    int fields = 1;
+    bool inField = true;
+    for (const char *q = b; q < t; ++q) {
+        if (ws ? isBlank(*q) : *q == delimiter_) {
+            if (!ws || inField)
+                ++fields;
+            inField = false;
+        } else {
+            inField = true;
+        }
+    }
+    cols_ = fields;
+}
+
+void TextMatrixReader::countEntries()
+{
+    if (format_ == TextFormat::MatrixMarketCoordinate)
+        return;  // elementy wskazują swoje miejsca same
+
+    // wiersze (CSV) albo elementy (array) w każdym kawałku → indeks pierwszego
+    std::vector<std::uint64_t> count(chunks_.size(), 0);
+    const bool csv = format_ == TextFormat::Csv;
+    parallel(chunks_.size(), [&](std::size_t k) {
+        std::uint64_t n = 0;
+        forEachLine(chunks_[k].begin, chunks_[k].end, csv ? '#' : '%', [&](const char *b, const char *e) {
+            if (csv) {
+                ++n;
+                return;
+            }
+            for (const char *q = b; q < e; q = skipBlank(tokenEnd(q, e), e))
+                ++n;
+        });
+        count[k] = n;
+    });
+
+    std::uint64_t total = 0;
+    for (std::size_t k = 0; k < chunks_.size(); ++k) {
+        chunks_[k].first = total;
+        total += count[k];
+    }
+    if (csv) {
+        if (total == 0 || total > INT_MAX)
+            fail("row count out of range");
+        rows_ = int(total);
+        entries_ = total * std::uint64_t(cols_);
+    } else if (total != entries_) {
+        fail("expected " + std::to_string(entries_) + " entries, found " + std::to_string(total));
+    }
+}
+
+// ───────────────────────────── elementy ─────────────────────────────────────
+
+/**
+ * slot(i, j) to miejsce elementu (i, j) albo nullptr, gdy go nie
+ * przechowujemy (wtedy w pliku musi być zero). Każdy kawałek parsuje osobny
+ * wątek ze swoim ScalarParser; symmetric: element kopiowany też do (j, i).
+ */
+template <typename T, typename Slot>
+void TextMatrixReader::forEachEntry(Slot slot) const
+{
+    std::vector<std::uint64_t> found(chunks_.size(), 0);
+    parallel(chunks_.size(), [&](std::size_t k) {
+        ScalarParser<T> parse;
+        const Chunk &ch = chunks_[k];
+
+        auto put = [&](int i, int j, const char *b, const char *e) {
+            auto where = [&] {
+                return "element (" + std::to_string(i + 1) + ", " + std::to_string(j + 1) + "): ";
+            };
+            T *dst = slot(i, j);
+            if (!dst) {
+                if (!isZeroText(b, e))
+                    fail(where() + "nonzero outside the tridiagonal band");
+                return;
+            }
+            try {
+                parse(b, e, *dst);
+            } catch (const std::exception &ex) {
+                fail(where() + ex.what());
+            }
+            if (symmetric_ && i != j) {
+                if (T *m = slot(j, i))
+                    *m = *dst;
+            }
+        };
+
+        std::uint64_t n = 0;
+        switch (format_) {
+        case TextFormat::Csv: {
+            int i = int(ch.first);
+            const bool ws = delimiter_ == ' ';
+            forEachLine(ch.begin, ch.end, '#', [&](const char *b, const char *e) {
+                int j = 0;
+                for (const char *q = b;;) {
+                    const char *fb = skipBlank(q, e);
+                    const char *fe = ws ? tokenEnd(fb, e) : std::find(fb, e, delimiter_);
+                    q = fe;
+                    while (fe > fb && isBlank(fe[-1]))
+                        --fe;
+                    if (fb == fe || j == cols_) {
+                        j = -1;  // puste pole albo za dużo pól
+                        break;
+                    }
+                    put(i, j++, fb, fe);
+                    if (ws)
+                        q = skipBlank(q, e);
+                    if (q == e)
+                        break;
+                    if (!ws)
+                        ++q;  // separator
+                }
+                if (j != cols_)
+                    fail("row " + std::to_string(i + 1) + " does not have "
+                         + std::to_string(cols_) + " fields");
+                ++i;
+                ++n;
+            });
+            break;
+        }
+        case TextFormat::MatrixMarketArray: {
+            // kolumnami; symmetric: kolumna j od wiersza j
+            std::uint64_t idx = ch.first;
+            int i = 0, j = 0;
+            if (!symmetric_) {
+                i = int(idx % std::uint64_t(rows_));
+                j = int(idx / std::uint64_t(rows_));
+            } else {
+                while (idx >= std::uint64_t(rows_ - j)) {
+                    idx -= std::uint64_t(rows_ - j);
+                    ++j;
+                }
+                i = j + int(idx);
+            }
+            forEachLine(ch.begin, ch.end, '%', [&](const char *b, const char *e) {
+                for (const char *q = b; q < e;) {
+                    const char *t = tokenEnd(q, e);
+                    put(i, j, q, t);
+                    ++n;
+                    if (++i == rows_) {
+                        ++j;
+                        i = symmetric_ ? j : 0;
+                    }
+                    q = skipBlank(t, e);
+                }
+            });
+            break;
+        }
+        case TextFormat::MatrixMarketCoordinate: {
+            static const char one[] = "1";
+            forEachLine(ch.begin, ch.end, '%', [&](const char *b, const char *e) {
+                std::uint64_t ij[2];
+                const char *q = b;
+                for (auto &v : ij) {
+                    const char *t = tokenEnd(q, e);
+                    if (!parseInt(q, t, v))
+                        fail("bad coordinate entry '" + std::string(b, e) + "'");
+                    q = skipBlank(t, e);
+                }
+                if (ij[0] == 0 || ij[0] > std::uint64_t(rows_) || ij[1] == 0 || ij[1] > std::uint64_t(cols_))
+                    fail("coordinate entry '" + std::string(b, e) + "' outside the matrix");
+                const char *vb = one, *ve = one + 1;
+                if (!pattern_) {
+                    vb = q;
+                    ve = tokenEnd(q, e);
+                    q = skipBlank(ve, e);
+                }
+                if (vb == ve || q != e)
+                    fail("bad coordinate entry '" + std::string(b, e) + "'");
+                put(int(ij[0] - 1), int(ij[1] - 1), vb, ve);
+                ++n;
+            });
+            break;
+        }
+        }
+        found[k] = n;
+    });
+
+    if (format_ == TextFormat::MatrixMarketCoordinate) {
+        std::uint64_t total = 0;
+        for (auto n : found)
+            total += n;
+        if (total != entries_)
+            fail("expected " + std::to_string(entries_) + " entries, found " + std::to_string(total));
+    }
+}
+
+template <typename T>
+void TextMatrixReader::readDense(solver::MatrixView<T> out) const
+{
+    if (out.rows() != rows_ || out.cols() != cols_)
+        throw std::invalid_argument("Output view does not match matrix dimensions.");
+
+    if (format_ == TextFormat::MatrixMarketCoordinate) {
+        // zera tam, gdzie plik nic nie wpisze – wierszami, też równolegle
+        const std::size_t parts = chunks_.size();
+        parallel(parts, [&](std::size_t k) {
+            const int r0 = int(std::uint64_t(rows_) * k / parts);
+            const int r1 = int(std::uint64_t(rows_) * (k + 1) / parts);
+            for (int i = r0; i < r1; ++i)
+                for (int j = 0; j < cols_; ++j)
+                    out[i][j] = T();
+        });
+    }
+    forEachEntry<T>([&](int i, int j) -> T * { return out[i] + j; });
+}
+
+template <typename T>
+void TextMatrixReader::readTridiagonal(solver::Span<T> a, solver::Span<T> d, solver::Span<T> c) const
+{
+    const std::size_t n = d.size();
+    if (std::size_t(rows_) != n || std::size_t(cols_) != n || a.size() + 1 != n || c.size() + 1 != n)
+        throw std::invalid_argument("Output spans do not match matrix dimensions.");
+
+    for (auto *v : {&a, &d, &c})
+        for (auto &x : *v)
+            x = T();
+    forEachEntry<T>([&](int i, int j) -> T * {
+        if (i == j)
+            return &d[i];
+        if (j + 1 == i)
+            return &a[j];
+        if (j == i + 1)
+            return &c[i];
+        return nullptr;
+    });
+}
+
+#define CROUT_TEXT_MATRIX(T)                                                        \
+    template void TextMatrixReader::readDense<T>(solver::MatrixView<T>) const;      \
+    template void TextMatrixReader::readTridiagonal<T>(solver::Span<T>, solver::Span<T>, \
+                                                       solver::Span<T>) const;
+
+CROUT_TEXT_MATRIX(double)
+CROUT_TEXT_MATRIX(multidouble::DoubleDouble)
+CROUT_TEXT_MATRIX(multidouble::QuadDouble)
+CROUT_TEXT_MATRIX(mpfr::mpreal)
+CROUT_TEXT_MATRIX(IA::Interval<double>)
+CROUT_TEXT_MATRIX(IA::Interval<mpfr::mpreal>)
+#ifdef CROUT_HAVE_FLOAT128
+CROUT_TEXT_MATRIX(__float128)
+#endif
+
+#undef CROUT_TEXT_MATRIX
+
+} // namespace utils
@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "solver/crout_types.h"
+#include "utils/mapped_file.h"
+
+namespace utils {
+
+/**
+ * Równoległy czytnik macierzy tekstowych: Matrix Market (array, coordinate)
+ * i CSV.
+ *
+ * Plik jest mapowany do pamięci (MappedFile) i dzielony na kawałki na
+ * granicach linii; każdy kawałek parsuje osobny wątek – double przez
+ * std::from_chars, typy wysokiej precyzji przez mpfr_strtofr – i wpisuje
+ * liczby od razu w miejsce docelowe: gęstą macierz wierszami (MatrixView,
+ * także zmapowany plik .crm) albo wektory a, d, c trójdiagonalnej. Nie ma
+ * pośrednich napisów ani kopii całego pliku.
+ *
+ * Matrix Market: pole real, double, integer albo pattern (same jedynki),
+ * symetria general albo symmetric (zapisany dolny trójkąt, górny
+ * uzupełniany). complex, skew-symmetric i hermitian są odrzucane.
+ * Powtórzone wpisy coordinate nie są dozwolone.
+ *
+ * CSV: jeden wiersz macierzy na linię, '#' zaczyna komentarz. Pierwsza linia,
+ * która nie zaczyna się liczbą, to nagłówek i jest pomijana. Separator
+ * rozpoznawany z pierwszej linii danych (',', '\t', ';', inaczej białe znaki),
+ * chyba że podany w TextReadOptions.
+ *
+ * Elementy przedziałowe: "lo;hi" albo jedna liczba (najwęższy zawierający ją
+ * przedział), jak w wejściu crout-cli; przy separatorze ';' tylko to drugie.
+ * Typy MPFR czytane są z domyślną precyzją wątku wołającego.
+ *
+ * Błędy formatu i liczb zgłaszane są jako std::runtime_error("ścieżka: opis").
+ */
+enum class TextFormat { MatrixMarketArray, MatrixMarketCoordinate, Csv };
+
+struct TextReadOptions {
+    int threads = 0;     // 0 = hardware_concurrency
+    char delimiter = 0;  // CSV; 0 = rozpoznaj
+};
+
+class TextMatrixReader {
+public:
+    // Mapuje plik, czyta nagłówek i wymiary (CSV: liczy wiersze)
+    static TextMatrixReader open(const std::string &path, TextReadOptions options = {});
+
+    TextFormat format() const { return format_; }
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    bool symmetric() const { return symmetric_; }
+    // Elementy zapisane w pliku (coordinate: nnz z nagłówka)
+    std::uint64_t entries() const { return entries_; }
+
+    // Cała macierz do out (rows × cols); elementy bez wpisu w coordinate to zera
+    template <typename T> void readDense(solver::MatrixView<T> out) const;
+    template <typename T> std::vector<T> readDense() const;
+
+    // Macierz n×n trójdiagonalna do a (n-1), d (n), c (n-1); niezerowy
+    // element poza pasmem to błąd
+    template <typename T>
+    void readTridiagonal(solver::Span<T> a, solver::Span<T> d, solver::Span<T> c) const;
+
+private:
+    // Kawałek danych od początku linii do początku linii; first – indeks
+    // pierwszego wiersza (CSV) albo elementu (array) w kawałku
+    struct Chunk {
+        const char *begin, *end;
+        std::uint64_t first;
+    };
+
+    void readHeader(const char *&p, const char *e);
+    void countEntries();
+    [[noreturn]] void fail(const std::string &msg) const;
+    template <typename T, typename Slot> void forEachEntry(Slot slot) const;
+
+    MappedFile map_;
+    std::string path_;
+    TextFormat format_ = TextFormat::Csv;
+    int rows_ = 0;
+    int cols_ = 0;
+    bool symmetric_ = false;
+    bool pattern_ = false;
+    char delimiter_ = 0;
+    std::uint64_t entries_ = 0;
+    std::vector<Chunk> chunks_;
+};
+
+template <typename T>
+std::vector<T> TextMatrixReader::readDense() const
+{
+    std::vector<T> out(std::size_t(rows_) * std::size_t(cols_));
+    readDense(solver::MatrixView<T>(out.data(), rows_, cols_));
+    return out;
+}
+
+} // namespace utils
@@ -0,0 +1,181 @@
+#include "tile_file.h"
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <cerrno>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace utils {
+
+namespace {
+
+[[noreturn]] void fail(const std::string &path, const std::string &msg)
+{
+    throw std::runtime_error(path + ": " + msg);
+}
+
+std::string systemError()
+{
+#ifdef _WIN32
+    return "system error " + std::to_string(GetLastError());
+#else
+    return std::strerror(errno);
+#endif
+}
+
+// crout-<pid>-<n>.tiles w katalogu tymczasowym
+std::string temporaryPath()
+{
+    static std::atomic<unsigned> counter{0};
+#ifdef _WIN32
+    const unsigned long pid = GetCurrentProcessId();
+#else
+    const unsigned long pid = static_cast<unsigned long>(::getpid());
+#endif
+    const std::string name = "crout-" + std::to_string(pid) + "-" + std::to_string(counter++) + ".tiles";
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+} // anonymous
+
+TileFile TileFile::create(const std::string &path, std::uint64_t tileCount, std::size_t tileBytes)
+{
+    TileFile f;
+    f.path_  = path.empty() ? temporaryPath() : path;
+    f.count_ = tileCount;
+    f.bytes_ = tileBytes;
+    const std::uint64_t size = tileCount * tileBytes;
+#ifdef _WIN32
+    HANDLE h = CreateFileA(f.path_.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                           CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY, nullptr);
+    if (h == INVALID_HANDLE_VALUE)
+        fail(f.path_, systemError());
+    f.handle_ = h;
+    LARGE_INTEGER end;
+    end.QuadPart = static_cast<LONGLONG>(size);
+    if (!SetFilePointerEx(h, end, nullptr, FILE_BEGIN) || !SetEndOfFile(h))
+        fail(f.path_, systemError());
+#else
+    f.fd_ = ::open(f.path_.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (f.fd_ < 0)
+        fail(f.path_, systemError());
+    if (::ftruncate(f.fd_, static_cast<off_t>(size)) != 0)
+        fail(f.path_, systemError());
+#endif
+    return f;
+}
+
+TileFile::~TileFile()
+{
+#ifdef _WIN32
+    if (handle_)
+        CloseHandle(handle_);
+    if (handle_ && !keep_)
+        DeleteFileA(path_.c_str());
+#else
+    if (fd_ >= 0) {
+        ::close(fd_);
+        if (!keep_)
+            ::unlink(path_.c_str());
+    }
+#endif
+}
+
+TileFile::TileFile(TileFile &&other) noexcept
+    : path_(std::move(other.path_)), count_(other.count_), bytes_(other.bytes_), keep_(other.keep_)
+#ifdef _WIN32
+    , handle_(other.handle_)
+#else
+    , fd_(other.fd_)
+#endif
+{
+#ifdef _WIN32
+    other.handle_ = nullptr;
+#else
+    other.fd_ = -1;
+#endif
+}
+
+TileFile &TileFile::operator=(TileFile &&other) noexcept
+{
+    if (this != &other) {
+        this->~TileFile();
+        new (this) TileFile(std::move(other));
+    }
+    return *this;
+}
+
+void TileFile::check(std::uint64_t tile) const
+{
+    if (tile >= count_)
+        throw std::out_of_range("Tile index out of range.");
+}
+
+void TileFile::read(std::uint64_t tile, unsigned char *buf) const
+{
+    check(tile);
+    std::uint64_t offset = tile * bytes_;
+    std::size_t left = bytes_;
+    while (left) {
+#ifdef _WIN32
+        OVERLAPPED ov{};
+        ov.Offset     = DWORD(offset & 0xffffffffu);
+        ov.OffsetHigh = DWORD(offset >> 32);
+        DWORD chunk = DWORD(left > (1u << 30) ? (1u << 30) : left);
+        DWORD got = 0;
+        if (!ReadFile(handle_, buf, chunk, &got, &ov) || got == 0)
+            fail(path_, "tile read failed: " + systemError());
+#else
+        const ssize_t got = ::pread(fd_, buf, left, static_cast<off_t>(offset));
+        if (got < 0 && errno == EINTR)
+            continue;
+        if (got <= 0)
+            fail(path_, "tile read failed: " + (got < 0 ? systemError() : std::string("end of file")));
+#endif
+        buf += got;
+        offset += std::uint64_t(got);
+        left -= std::size_t(got);
+    }
+}
+
+void TileFile::write(std::uint64_t tile, const unsigned char *buf)
+{
+    check(tile);
+    std::uint64_t offset = tile * bytes_;
+    std::size_t left = bytes_;
+    while (left) {
+#ifdef _WIN32
+        OVERLAPPED ov{};
+        ov.Offset     = DWORD(offset & 0xffffffffu);
+        ov.OffsetHigh = DWORD(offset >> 32);
+        DWORD chunk = DWORD(left > (1u << 30) ? (1u << 30) : left);
+        DWORD put = 0;
+        if (!WriteFile(handle_, buf, chunk, &put, &ov) || put == 0)
+            fail(path_, "tile write failed: " + systemError());
+#else
+        const ssize_t put = ::pwrite(fd_, buf, left, static_cast<off_t>(offset));
+        if (put < 0 && errno == EINTR)
+            continue;
+        if (put <= 0)
+            fail(path_, "tile write failed: " + systemError());
+#endif
+        buf += put;
+        offset += std::uint64_t(put);
+        left -= std::size_t(put);
+    }
+}
+
+} // namespace utils
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace utils {
+
+/**
+ * Plik roboczy kafelków o stałym rozmiarze dla rozkładów poza pamięcią.
+ * Kafelek k leży pod offsetem k · tileBytes; czytany i zapisywany jest w całości
+ * (pread / pwrite, na Windows ReadFile / WriteFile z OVERLAPPED), więc w
+ * pamięci jest tylko to, co wołający trzyma w swoich buforach – inaczej niż
+ * przy mmap, gdzie zestaw roboczy ustala system.
+ *
+ * read() i write() różnych kafelków można wołać równolegle z wielu wątków.
+ * Plik tworzony jest od zera (rzadki – niezapisane kafelki to zera) i usuwany
+ * w destruktorze, chyba że keep().
+ */
+class TileFile {
+public:
+    // Pusta ścieżka: plik w katalogu tymczasowym systemu
+    static TileFile create(const std::string &path, std::uint64_t tileCount, std::size_t tileBytes);
+
+    TileFile() = default;
+    ~TileFile();
+    TileFile(TileFile &&other) noexcept;
+    TileFile &operator=(TileFile &&other) noexcept;
+    TileFile(const TileFile &) = delete;
+    TileFile &operator=(const TileFile &) = delete;
+
+    const std::string &path() const { return path_; }
+    std::uint64_t tileCount() const { return count_; }
+    std::size_t tileBytes() const { return bytes_; }
+
+    void read(std::uint64_t tile, unsigned char *buf) const;
+    void write(std::uint64_t tile, const unsigned char *buf);
+
+    // Plik zostaje na dysku po zniszczeniu obiektu
+    void keep() { keep_ = true; }
+
+private:
+    void check(std::uint64_t tile) const;
+
+    std::string path_;
+    std::uint64_t count_ = 0;
+    std::size_t bytes_ = 0;
+    bool keep_ = false;
+#ifdef _WIN32
+    void *handle_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+};
+
+} // namespace utils
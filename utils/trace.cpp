@@ -0,0 +1,234 @@
+#include "trace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+namespace utils {
+namespace trace {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Event {
+    const char *category;
+    const char *name;
+    std::uint64_t begin;     // ns od start()
+    std::uint64_t duration;  // ns
+    std::int32_t i, j;
+    std::uint32_t thread;
+};
+
+// Bufor jednego wątku naraz: pisze tylko właściciel, licznik written rośnie
+// monotonicznie, slot to written % capacity
+struct Buffer {
+    std::unique_ptr<Event[]> events;
+    std::size_t capacity = 0;
+    std::atomic<std::uint64_t> written{0};
+    std::atomic<bool> free{false};  // wątek właściciela się zakończył
+    Buffer *next = nullptr;
+};
+
+// Lista buforów tylko rośnie (push przez CAS); bufory żyją do końca procesu
+std::atomic<Buffer *> buffers{nullptr};
+std::atomic<std::size_t> capacity{kDefaultCapacity};
+std::atomic<std::uint32_t> threadCount{0};
+std::atomic<Clock::rep> epoch{0};
+
+std::mutex namesMutex;
+std::map<std::uint32_t, std::string> names;
+
+Buffer *acquire()
+{
+    for (Buffer *b = buffers.load(std::memory_order_acquire); b; b = b->next) {
+        bool expected = true;
+        if (b->free.load(std::memory_order_relaxed)
+            && b->free.compare_exchange_strong(expected, false, std::memory_order_acq_rel))
+            return b;
+    }
+    auto *b = new Buffer;
+    b->capacity = capacity.load(std::memory_order_relaxed);
+    b->events.reset(new Event[b->capacity]);
+    b->next = buffers.load(std::memory_order_relaxed);
+    while (!buffers.compare_exchange_weak(b->next, b, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    return b;
+}
+
+// Numer wątku w pliku i jego bufor (pobrany przy pierwszym zdarzeniu);
+// po zakończeniu wątku bufor przechodzi do następnego
+struct ThreadSlot {
+    std::uint32_t id = threadCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    Buffer *buffer = nullptr;
+
+    ~ThreadSlot()
+    {
+        if (buffer)
+            buffer->free.store(true, std::memory_order_release);
+    }
+};
+
+ThreadSlot &slot()
+{
+    thread_local ThreadSlot s;
+    return s;
+}
+
+std::string jsonEscape(const std::string &s)
+{
+    std::string r;
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            r += '\\';
+        if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof buf, "\\u%04x", c);
+            r += buf;
+        } else {
+            r += c;
+        }
+    }
+    return r;
+}
+
+// Zdarzenia w buforze: najwyżej capacity ostatnich
+template <typename F>
+void forEachEvent(F fn)
+{
+    for (Buffer *b = buffers.load(std::memory_order_acquire); b; b = b->next) {
+        const std::uint64_t w = b->written.load(std::memory_order_acquire);
+        const std::uint64_t kept = std::min<std::uint64_t>(w, b->capacity);
+        for (std::uint64_t k = w - kept; k < w; ++k)
+            fn(b->events[k % b->capacity]);
+    }
+}
+
+} // anonymous
+
+namespace detail {
+
+void record(const char *category, const char *name, std::int32_t i, std::int32_t j,
+            Clock::time_point begin, Clock::time_point end)
+{
+    ThreadSlot &s = slot();
+    if (!s.buffer)
+        s.buffer = acquire();
+    Buffer &b = *s.buffer;
+    const Clock::rep origin = epoch.load(std::memory_order_relaxed);
+    const std::uint64_t n = b.written.load(std::memory_order_relaxed);
+    Event &e = b.events[n % b.capacity];
+    e.category = category;
+    e.name = name;
+    e.begin = std::uint64_t(std::max<Clock::rep>(0, std::chrono::nanoseconds(begin.time_since_epoch()).count() - origin));
+    e.duration = std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    e.i = i;
+    e.j = j;
+    e.thread = s.id;
+    b.written.store(n + 1, std::memory_order_release);
+}
+
+} // namespace detail
+
+void start(std::size_t eventsPerThread)
+{
+    if (eventsPerThread == 0)
+        throw std::invalid_argument("Trace buffer capacity must be positive.");
+    detail::on.store(false, std::memory_order_relaxed);
+    capacity.store(eventsPerThread, std::memory_order_relaxed);
+    for (Buffer *b = buffers.load(std::memory_order_acquire); b; b = b->next) {
+        if (b->capacity != eventsPerThread) {
+            b->events.reset(new Event[eventsPerThread]);
+            b->capacity = eventsPerThread;
+        }
+        b->written.store(0, std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard<std::mutex> lock(namesMutex);
+        names.clear();
+    }
+    epoch.store(std::chrono::nanoseconds(Clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+    detail::on.store(true, std::memory_order_release);
+}
+
+void stop()
+{
+    detail::on.store(false, std::memory_order_release);
+}
+
+void setThreadName(const std::string &name)
+{
+    if (!enabled())
+        return;
+    const std::uint32_t id = slot().id;
+    std::lock_guard<std::mutex> lock(namesMutex);
+    names[id] = name;
+}
+
+Summary summary()
+{
+    Summary s;
+    for (Buffer *b = buffers.load(std::memory_order_acquire); b; b = b->next) {
+        const std::uint64_t w = b->written.load(std::memory_order_acquire);
+        s.dropped += w - std::min<std::uint64_t>(w, b->capacity);
+    }
+    std::set<std::uint32_t> threads;
+    forEachEvent([&](const Event &e) {
+        ++s.events;
+        threads.insert(e.thread);
+    });
+    s.threads = std::uint32_t(threads.size());
+    return s;
+}
+
+std::string toChromeJson()
+{
+    const Summary sum = summary();
+    std::string out = "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":" + std::to_string(sum.dropped)
+                      + "},\"traceEvents\":[\n"
+                        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"crout\"}}";
+    {
+        std::lock_guard<std::mutex> lock(namesMutex);
+        for (const auto &[id, name] : names)
+            out += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(id)
+                   + ",\"args\":{\"name\":\"" + jsonEscape(name) + "\"}}";
+    }
+
+    // ts i dur w µs (ułamki – rozdzielczość ns)
+    char buf[96];
+    forEachEvent([&](const Event &e) {
+        out += ",\n{\"name\":\"" + jsonEscape(e.name) + "\",\"cat\":\"" + jsonEscape(e.category)
+               + "\",\"ph\":\"X\",\"pid\":1,\"tid\":" + std::to_string(e.thread);
+        std::snprintf(buf, sizeof buf, ",\"ts\":%.3f,\"dur\":%.3f", double(e.begin) * 1e-3, double(e.duration) * 1e-3);
+        out += buf;
+        if (e.i >= 0 || e.j >= 0) {
+            out += ",\"args\":{";
+            if (e.i >= 0)
+                out += "\"i\":" + std::to_string(e.i) + (e.j >= 0 ? "," : "");
+            if (e.j >= 0)
+                out += "\"j\":" + std::to_string(e.j);
+            out += '}';
+        }
+        out += '}';
+    });
+    return out + "\n]}\n";
+}
+
+void writeChromeTrace(const std::string &path)
+{
+    std::ofstream f(path, std::ios::binary);
+    if (!f)
+        throw std::runtime_error("Cannot write trace file '" + path + "'.");
+    f << toChromeJson();
+    f.flush();
+    if (!f)
+        throw std::runtime_error("Cannot write trace file '" + path + "'.");
+}
+
+} // namespace trace
+} // namespace utils
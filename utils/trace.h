@@ -0,0 +1,84 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Oś czasu zadań solverów w formacie Chrome trace (chrome://tracing, Perfetto).
+//
+// Każdy wątek zapisuje zdarzenia do własnego bufora cyklicznego – bez blokad
+// i bez alokacji na zdarzenie. Bufory wątków zakończonych trafiają do ponownego
+// użycia (np. wątki std::async czytania kafelków), a ich zdarzenia zostają do
+// eksportu. Przy przepełnieniu najstarsze zdarzenia wątku są nadpisywane.
+//
+// Śledzenie włącza się w czasie działania (start/stop); wyłączone kosztuje
+// jedno odczytanie flagi atomowej na zadanie.
+
+namespace utils {
+namespace trace {
+
+constexpr std::size_t kDefaultCapacity = std::size_t(1) << 15;  // zdarzeń na wątek
+
+namespace detail {
+inline std::atomic<bool> on{false};
+void record(const char *category, const char *name, std::int32_t i, std::int32_t j,
+            std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end);
+} // namespace detail
+
+// Czyści wcześniejsze zdarzenia i włącza zapis. Wołać, gdy żaden wątek nie
+// wykonuje śledzonych zadań.
+void start(std::size_t eventsPerThread = kDefaultCapacity);
+void stop();
+inline bool enabled() { return detail::on.load(std::memory_order_relaxed); }
+
+// Nazwa ścieżki bieżącego wątku w podglądzie (np. "worker 2"); bez śledzenia nic nie robi
+void setThreadName(const std::string &name);
+
+/**
+ * Jedno zadanie od utworzenia do destrukcji: kategoria i nazwa (literały –
+ * zapamiętywane są wskaźniki), współrzędne kafelka / bloku (−1 = brak),
+ * wątek. W pliku to zdarzenie "X" z początkiem i czasem trwania.
+ */
+class Scope {
+public:
+    Scope(const char *category, const char *name, int i = -1, int j = -1)
+    {
+        if (enabled()) {
+            category_ = category;
+            name_ = name;
+            i_ = i;
+            j_ = j;
+            begin_ = std::chrono::steady_clock::now();
+        }
+    }
+    ~Scope()
+    {
+        if (name_)
+            detail::record(category_, name_, i_, j_, begin_, std::chrono::steady_clock::now());
+    }
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+private:
+    const char *category_ = nullptr;
+    const char *name_ = nullptr;
+    std::int32_t i_ = -1, j_ = -1;
+    std::chrono::steady_clock::time_point begin_;
+};
+
+struct Summary {
+    std::uint64_t events = 0;   // do eksportu
+    std::uint64_t dropped = 0;  // nadpisane w pełnych buforach
+    std::uint32_t threads = 0;  // wątki z co najmniej jednym zdarzeniem
+};
+Summary summary();
+
+// Zdarzenia wszystkich wątków jako JSON Chrome trace ({"traceEvents": [...]}).
+// Eksport po zakończeniu śledzonych zadań – bufory czytane są bez synchronizacji.
+std::string toChromeJson();
+// Jak wyżej, do pliku; std::runtime_error przy błędzie zapisu
+void writeChromeTrace(const std::string &path);
+
+} // namespace trace
+} // namespace utils